@@ -0,0 +1,77 @@
+#pragma once
+
+// asm_dispatch.hpp: Declarations of the hand-written assembly kernels in this folder.
+// The .s files are only assembled when the build enables SENKAID_ENABLE_ASM (CMake option
+// of the same name, OFF by default); SENKAID_ASM_* tells callers which kernels are linked.
+// Without it every caller falls back to the intrinsic kernels in backend/simd.
+
+#include <senkaid/utils/config/root.hpp>
+
+#include <cstddef>
+
+#include <cstdint>
+
+#if defined(SENKAID_ENABLE_ASM) && defined(__x86_64__) && defined(__ELF__)
+    #define SENKAID_ASM_BARRIER 1
+    #if defined(SENKAID_HAS_AVX512)
+        #define SENKAID_ASM_TRANSPOSE_8X8_F64 1
+        #define SENKAID_ASM_DOT_AVX512 1
+    #elif defined(SENKAID_HAS_AVX2) && defined(SENKAID_HAS_FMA)
+        #define SENKAID_ASM_DOT_AVX2 1
+    #endif
+    #if defined(SENKAID_HAS_AVX512)
+        #define SENKAID_ASM_STREAM_AVX512 1
+    #elif defined(SENKAID_HAS_AVX)
+        #define SENKAID_ASM_STREAM_AVX 1
+    #endif
+#endif
+
+extern "C"
+{
+
+#if defined(SENKAID_ASM_TRANSPOSE_8X8_F64)
+// transpose.s: dst[j * ldd + i] = src[i * lds + j] for an 8x8 double block, strides in elements.
+void senkaid_asm_transpose_8x8_f64(const double* src, std::size_t lds, double* dst, std::size_t ldd);
+// Non-temporal variant; every dst line must be 64-byte aligned.
+void senkaid_asm_transpose_8x8_f64_nt(const double* src, std::size_t lds, double* dst, std::size_t ldd);
+#endif
+
+#if defined(SENKAID_ASM_DOT_AVX512)
+// dot_product.s: sum of x[i] * y[i], 8 zmm accumulators, k-masked tail.
+double senkaid_asm_ddot_avx512(const double* x, const double* y, std::size_t n);
+float senkaid_asm_sdot_avx512(const float* x, const float* y, std::size_t n);
+// y[i] += a * x[i].
+void senkaid_asm_daxpy_avx512(std::size_t n, double a, const double* x, double* y);
+void senkaid_asm_saxpy_avx512(std::size_t n, float a, const float* x, float* y);
+#endif
+
+#if defined(SENKAID_ASM_DOT_AVX2)
+// dot_product.s: As above with 12 ymm accumulators and a scalar tail.
+double senkaid_asm_ddot_avx2(const double* x, const double* y, std::size_t n);
+float senkaid_asm_sdot_avx2(const float* x, const float* y, std::size_t n);
+void senkaid_asm_daxpy_avx2(std::size_t n, double a, const double* x, double* y);
+void senkaid_asm_saxpy_avx2(std::size_t n, float a, const float* x, float* y);
+#endif
+
+#if defined(SENKAID_ASM_STREAM_AVX512)
+// memcpy_optimized.s / zero_fill.s: Non-temporal copy / byte fill of whole lines; dst 64-byte
+// aligned, bytes a multiple of 64. Both end with sfence.
+void senkaid_asm_stream_copy_avx512(void* dst, const void* src, std::size_t bytes);
+void senkaid_asm_stream_fill_avx512(void* dst, int value, std::size_t bytes);
+#endif
+
+#if defined(SENKAID_ASM_STREAM_AVX)
+void senkaid_asm_stream_copy_avx(void* dst, const void* src, std::size_t bytes);
+void senkaid_asm_stream_fill_avx(void* dst, int value, std::size_t bytes);
+#endif
+
+#if defined(SENKAID_ASM_BARRIER)
+// barrier.s: Barrier arrival; 1 = last arriver (released the others), 0 = released while
+// spinning, 2 = spin budget exhausted (caller parks).
+std::uint32_t senkaid_asm_barrier_arrive(std::uint32_t* count, std::uint32_t* phase, std::uint32_t seen,
+                                         std::uint32_t parties, std::uint32_t spins);
+// Polls *word with pause; 1 once it differs from `seen`, 0 after `spins` polls.
+std::uint32_t senkaid_asm_spin_until_changed(const std::uint32_t* word, std::uint32_t seen, std::uint32_t spins);
+#endif
+
+} // extern "C"
@@ -0,0 +1,81 @@
+# barrier.s: Spin fast paths of the fork-join runtime (x86-64, System V ABI, AT&T syntax).
+#
+# uint32_t senkaid_asm_barrier_arrive(uint32_t* count, uint32_t* phase, uint32_t seen,
+#                                     uint32_t parties, uint32_t spins)
+#   rdi = count, rsi = phase, edx = phase value read before arriving, ecx = parties, r8d = spins
+#   Sense-reversing (phase counting) barrier arrival:
+#     the last arriver re-arms count and publishes phase = seen + 1 with a full fence -> 1
+#     everyone else spins with pause until phase != seen                             -> 0
+#     or gives up after `spins` polls so the caller can park on the phase futex        -> 2
+#
+# uint32_t senkaid_asm_spin_until_changed(const uint32_t* word, uint32_t seen, uint32_t spins)
+#   rdi = word, esi = seen, edx = spins
+#   Polls *word with pause; 1 once it differs from `seen`, 0 when the budget runs out.
+#
+# Loads on x86-64 already have acquire semantics, so the spin loops need no fences. The
+# release of the last arriver uses xchg, which also orders it before the caller's read of
+# the sleeper count (the futex wake decision).
+
+    .text
+
+    .globl  senkaid_asm_barrier_arrive
+    .type   senkaid_asm_barrier_arrive, @function
+    .p2align 5
+senkaid_asm_barrier_arrive:
+    .cfi_startproc
+    movl    $-1, %eax
+    lock xaddl %eax, (%rdi)                 # eax = count before our arrival
+    cmpl    $1, %eax
+    jne     .Larrive_wait
+
+    movl    %ecx, (%rdi)                    # last: re-arm for the next phase first,
+    leal    1(%rdx), %eax
+    xchgl   %eax, (%rsi)                    # then release everybody
+    movl    $1, %eax
+    ret
+
+.Larrive_wait:
+    testl   %r8d, %r8d
+    jz      .Larrive_park
+    .p2align 4
+.Larrive_spin:
+    pause
+    cmpl    %edx, (%rsi)
+    jne     .Larrive_released
+    decl    %r8d
+    jnz     .Larrive_spin
+.Larrive_park:
+    movl    $2, %eax
+    ret
+.Larrive_released:
+    xorl    %eax, %eax
+    ret
+    .cfi_endproc
+    .size   senkaid_asm_barrier_arrive, .-senkaid_asm_barrier_arrive
+
+    .globl  senkaid_asm_spin_until_changed
+    .type   senkaid_asm_spin_until_changed, @function
+    .p2align 5
+senkaid_asm_spin_until_changed:
+    .cfi_startproc
+    cmpl    %esi, (%rdi)
+    jne     .Lspin_changed
+    testl   %edx, %edx
+    jz      .Lspin_timeout
+    .p2align 4
+.Lspin_loop:
+    pause
+    cmpl    %esi, (%rdi)
+    jne     .Lspin_changed
+    decl    %edx
+    jnz     .Lspin_loop
+.Lspin_timeout:
+    xorl    %eax, %eax
+    ret
+.Lspin_changed:
+    movl    $1, %eax
+    ret
+    .cfi_endproc
+    .size   senkaid_asm_spin_until_changed, .-senkaid_asm_spin_until_changed
+
+    .section .note.GNU-stack,"",@progbits
@@ -0,0 +1,564 @@
+# dot_product.s: FMA dot product and axpy kernels (x86-64, System V ABI, AT&T syntax).
+#
+# double senkaid_asm_ddot_avx512(const double* x, const double* y, size_t n)
+# float  senkaid_asm_sdot_avx512(const float* x, const float* y, size_t n)
+# double senkaid_asm_ddot_avx2(const double* x, const double* y, size_t n)
+# float  senkaid_asm_sdot_avx2(const float* x, const float* y, size_t n)
+#   rdi = x, rsi = y, rdx = n (elements); result in xmm0
+#
+# void senkaid_asm_daxpy_avx512(size_t n, double a, const double* x, double* y)
+# void senkaid_asm_saxpy_avx512(size_t n, float a, const float* x, float* y)
+# void senkaid_asm_daxpy_avx2(size_t n, double a, const double* x, double* y)
+# void senkaid_asm_saxpy_avx2(size_t n, float a, const float* x, float* y)
+#   rdi = n, xmm0 = a, rsi = x, rdx = y; y[i] += a * x[i]
+#
+# The dot loops keep 8 (AVX-512) or 12 (AVX2) independent accumulators and fold one operand
+# straight from memory, so the FMA latency chain never waits on a load. Before the main loop a
+# short head (one masked vector on AVX-512, scalar steps on AVX2) aligns x (dot) or y (axpy) to
+# the vector width: with 16-byte aligned std::vector data every other load otherwise splits a
+# cache line, which is what bounds the intrinsic loops in backend/cpu/dot_cpu.hpp. While more
+# than DOT_PREFETCH_MIN bytes of an operand remain, every line is prefetched DOT_PREFETCH bytes
+# ahead; the last stretch runs without prefetches, which would only spend issue slots on lines
+# that are already cached or past the end. Remainders take one vector at a time, then one
+# k-masked vector (AVX-512) or scalar steps (AVX2). Everything stays in volatile vector
+# registers: no spills, no stack frame. The partial sums are added pairwise, so results may
+# differ from a sequential sum in the last bits.
+
+    .set    DOT_PREFETCH, 1024
+    .set    DOT_PREFETCH_MIN, 262144
+
+    .text
+
+# ---------------------------------------------------------------------------------------
+# AVX-512
+
+# 8 vectors (512 bytes) of x and y into zmm0..7; pf = 1 prefetches the 8 lines ahead.
+.macro DOT_AVX512_STEP op, pf
+.if \pf
+    prefetcht0 DOT_PREFETCH(%rdi)
+    prefetcht0 DOT_PREFETCH(%rsi)
+    prefetcht0 DOT_PREFETCH+64(%rdi)
+    prefetcht0 DOT_PREFETCH+64(%rsi)
+    prefetcht0 DOT_PREFETCH+128(%rdi)
+    prefetcht0 DOT_PREFETCH+128(%rsi)
+    prefetcht0 DOT_PREFETCH+192(%rdi)
+    prefetcht0 DOT_PREFETCH+192(%rsi)
+.endif
+    vmovu\op (%rdi), %zmm8
+    vmovu\op 64(%rdi), %zmm9
+    vmovu\op 128(%rdi), %zmm10
+    vmovu\op 192(%rdi), %zmm11
+    vfmadd231\op (%rsi), %zmm8, %zmm0
+    vfmadd231\op 64(%rsi), %zmm9, %zmm1
+    vfmadd231\op 128(%rsi), %zmm10, %zmm2
+    vfmadd231\op 192(%rsi), %zmm11, %zmm3
+.if \pf
+    prefetcht0 DOT_PREFETCH+256(%rdi)
+    prefetcht0 DOT_PREFETCH+256(%rsi)
+    prefetcht0 DOT_PREFETCH+320(%rdi)
+    prefetcht0 DOT_PREFETCH+320(%rsi)
+    prefetcht0 DOT_PREFETCH+384(%rdi)
+    prefetcht0 DOT_PREFETCH+384(%rsi)
+    prefetcht0 DOT_PREFETCH+448(%rdi)
+    prefetcht0 DOT_PREFETCH+448(%rsi)
+.endif
+    vmovu\op 256(%rdi), %zmm12
+    vmovu\op 320(%rdi), %zmm13
+    vmovu\op 384(%rdi), %zmm14
+    vmovu\op 448(%rdi), %zmm15
+    vfmadd231\op 256(%rsi), %zmm12, %zmm4
+    vfmadd231\op 320(%rsi), %zmm13, %zmm5
+    vfmadd231\op 384(%rsi), %zmm14, %zmm6
+    vfmadd231\op 448(%rsi), %zmm15, %zmm7
+    addq    $512, %rdi
+    addq    $512, %rsi
+.endm
+
+# k1 = low rcx bits set (rcx < 16).
+.macro FIRST_N_MASK
+    movl    $1, %eax
+    shll    %cl, %eax
+    decl    %eax
+    kmovw   %eax, %k1
+.endm
+
+# DOT_AVX512 name, op (pd | ps), lanes (elements per zmm), shift (log2 of the element size)
+.macro DOT_AVX512 name, op, lanes, shift
+    .globl  \name
+    .type   \name, @function
+    .p2align 5
+\name:
+    .cfi_startproc
+    vxorpd  %xmm0, %xmm0, %xmm0             # VEX zeroing clears the full zmm
+    vxorpd  %xmm1, %xmm1, %xmm1
+    vxorpd  %xmm2, %xmm2, %xmm2
+    vxorpd  %xmm3, %xmm3, %xmm3
+    vxorpd  %xmm4, %xmm4, %xmm4
+    vxorpd  %xmm5, %xmm5, %xmm5
+    vxorpd  %xmm6, %xmm6, %xmm6
+    vxorpd  %xmm7, %xmm7, %xmm7
+    cmpq    $(8 * \lanes), %rdx
+    jb      .L\name\()_vec
+
+    movl    %edi, %ecx                      # masked head up to the next line of x
+    negl    %ecx
+    andl    $63, %ecx
+    shrl    $\shift, %ecx
+    jz      .L\name\()_far_check
+    FIRST_N_MASK
+    vmovu\op (%rdi), %zmm8{%k1}{z}
+    vmovu\op (%rsi), %zmm9{%k1}{z}
+    vfmadd231\op %zmm9, %zmm8, %zmm1
+    leaq    (%rdi,%rcx,1 << \shift), %rdi
+    leaq    (%rsi,%rcx,1 << \shift), %rsi
+    subq    %rcx, %rdx
+
+.L\name\()_far_check:
+    cmpq    $(DOT_PREFETCH_MIN >> \shift), %rdx
+    jb      .L\name\()_near_check
+
+    .p2align 4
+.L\name\()_far:
+    DOT_AVX512_STEP \op, 1
+    subq    $(8 * \lanes), %rdx
+    cmpq    $(DOT_PREFETCH_MIN >> \shift), %rdx
+    jae     .L\name\()_far
+
+.L\name\()_near_check:
+    cmpq    $(8 * \lanes), %rdx
+    jb      .L\name\()_vec
+
+    .p2align 4
+.L\name\()_near:
+    DOT_AVX512_STEP \op, 0
+    subq    $(8 * \lanes), %rdx
+    cmpq    $(8 * \lanes), %rdx
+    jae     .L\name\()_near
+
+.L\name\()_vec:                             # whole vectors left
+    cmpq    $\lanes, %rdx
+    jb      .L\name\()_tail
+    vmovu\op (%rdi), %zmm8
+    vfmadd231\op (%rsi), %zmm8, %zmm2
+    addq    $64, %rdi
+    addq    $64, %rsi
+    subq    $\lanes, %rdx
+    jmp     .L\name\()_vec
+
+.L\name\()_tail:                            # 0 < rdx < lanes: one masked vector
+    testq   %rdx, %rdx
+    jz      .L\name\()_reduce
+    movl    %edx, %ecx
+    FIRST_N_MASK
+    vmovu\op (%rdi), %zmm8{%k1}{z}
+    vmovu\op (%rsi), %zmm9{%k1}{z}
+    vfmadd231\op %zmm9, %zmm8, %zmm3
+
+.L\name\()_reduce:
+    vadd\op %zmm4, %zmm0, %zmm0
+    vadd\op %zmm5, %zmm1, %zmm1
+    vadd\op %zmm6, %zmm2, %zmm2
+    vadd\op %zmm7, %zmm3, %zmm3
+    vadd\op %zmm2, %zmm0, %zmm0
+    vadd\op %zmm3, %zmm1, %zmm1
+    vadd\op %zmm1, %zmm0, %zmm0
+    vextractf64x4 $1, %zmm0, %ymm1
+    vadd\op %ymm1, %ymm0, %ymm0
+    vextractf128 $1, %ymm0, %xmm1
+    vadd\op %xmm1, %xmm0, %xmm0
+.ifc \op, pd
+    vunpckhpd %xmm0, %xmm0, %xmm1
+    vaddsd  %xmm1, %xmm0, %xmm0
+.else
+    vmovhlps %xmm0, %xmm0, %xmm1
+    vaddps  %xmm1, %xmm0, %xmm0
+    vmovshdup %xmm0, %xmm1
+    vaddss  %xmm1, %xmm0, %xmm0
+.endif
+    vzeroupper
+    ret
+    .cfi_endproc
+    .size   \name, .-\name
+.endm
+
+# 4 vectors (256 bytes): y = a * x + y with a in zmm0.
+.macro AXPY_AVX512_STEP op, pf
+.if \pf
+    prefetcht0 DOT_PREFETCH(%rsi)
+    prefetcht0 DOT_PREFETCH+64(%rsi)
+    prefetcht0 DOT_PREFETCH+128(%rsi)
+    prefetcht0 DOT_PREFETCH+192(%rsi)
+    prefetchw DOT_PREFETCH(%rdx)
+    prefetchw DOT_PREFETCH+64(%rdx)
+    prefetchw DOT_PREFETCH+128(%rdx)
+    prefetchw DOT_PREFETCH+192(%rdx)
+.endif
+    vmovu\op (%rsi), %zmm1
+    vmovu\op 64(%rsi), %zmm2
+    vmovu\op 128(%rsi), %zmm3
+    vmovu\op 192(%rsi), %zmm4
+    vfmadd213\op (%rdx), %zmm0, %zmm1
+    vfmadd213\op 64(%rdx), %zmm0, %zmm2
+    vfmadd213\op 128(%rdx), %zmm0, %zmm3
+    vfmadd213\op 192(%rdx), %zmm0, %zmm4
+    vmovu\op %zmm1, (%rdx)
+    vmovu\op %zmm2, 64(%rdx)
+    vmovu\op %zmm3, 128(%rdx)
+    vmovu\op %zmm4, 192(%rdx)
+    addq    $256, %rsi
+    addq    $256, %rdx
+.endm
+
+# AXPY_AVX512 name, op (pd | ps), lanes, shift
+.macro AXPY_AVX512 name, op, lanes, shift
+    .globl  \name
+    .type   \name, @function
+    .p2align 5
+\name:
+    .cfi_startproc
+.ifc \op, pd
+    vbroadcastsd %xmm0, %zmm0
+.else
+    vbroadcastss %xmm0, %zmm0
+.endif
+    cmpq    $(4 * \lanes), %rdi
+    jb      .L\name\()_vec
+
+    movl    %edx, %ecx                      # masked head up to the next line of y, so no
+    negl    %ecx                            # store in the loops splits a line
+    andl    $63, %ecx
+    shrl    $\shift, %ecx
+    jz      .L\name\()_far_check
+    FIRST_N_MASK
+    vmovu\op (%rsi), %zmm1{%k1}{z}
+    vmovu\op (%rdx), %zmm2{%k1}{z}
+    vfmadd213\op %zmm2, %zmm0, %zmm1
+    vmovu\op %zmm1, (%rdx){%k1}
+    leaq    (%rsi,%rcx,1 << \shift), %rsi
+    leaq    (%rdx,%rcx,1 << \shift), %rdx
+    subq    %rcx, %rdi
+
+.L\name\()_far_check:
+    cmpq    $(DOT_PREFETCH_MIN >> \shift), %rdi
+    jb      .L\name\()_near_check
+
+    .p2align 4
+.L\name\()_far:
+    AXPY_AVX512_STEP \op, 1
+    subq    $(4 * \lanes), %rdi
+    cmpq    $(DOT_PREFETCH_MIN >> \shift), %rdi
+    jae     .L\name\()_far
+
+.L\name\()_near_check:
+    cmpq    $(4 * \lanes), %rdi
+    jb      .L\name\()_vec
+
+    .p2align 4
+.L\name\()_near:
+    AXPY_AVX512_STEP \op, 0
+    subq    $(4 * \lanes), %rdi
+    cmpq    $(4 * \lanes), %rdi
+    jae     .L\name\()_near
+
+.L\name\()_vec:
+    cmpq    $\lanes, %rdi
+    jb      .L\name\()_tail
+    vmovu\op (%rsi), %zmm1
+    vfmadd213\op (%rdx), %zmm0, %zmm1
+    vmovu\op %zmm1, (%rdx)
+    addq    $64, %rsi
+    addq    $64, %rdx
+    subq    $\lanes, %rdi
+    jmp     .L\name\()_vec
+
+.L\name\()_tail:
+    testq   %rdi, %rdi
+    jz      .L\name\()_done
+    movl    %edi, %ecx
+    FIRST_N_MASK
+    vmovu\op (%rsi), %zmm1{%k1}{z}
+    vmovu\op (%rdx), %zmm2{%k1}{z}
+    vfmadd213\op %zmm2, %zmm0, %zmm1
+    vmovu\op %zmm1, (%rdx){%k1}
+
+.L\name\()_done:
+    vzeroupper
+    ret
+    .cfi_endproc
+    .size   \name, .-\name
+.endm
+
+    DOT_AVX512  senkaid_asm_ddot_avx512, pd, 8, 3
+    DOT_AVX512  senkaid_asm_sdot_avx512, ps, 16, 2
+    AXPY_AVX512 senkaid_asm_daxpy_avx512, pd, 8, 3
+    AXPY_AVX512 senkaid_asm_saxpy_avx512, ps, 16, 2
+
+# ---------------------------------------------------------------------------------------
+# AVX2 + FMA3 (16 ymm registers: 12 accumulators, 4 for loads)
+
+# 12 vectors (384 bytes) of x and y into ymm0..11.
+.macro DOT_AVX2_STEP op, pf
+.if \pf
+    prefetcht0 DOT_PREFETCH(%rdi)
+    prefetcht0 DOT_PREFETCH(%rsi)
+    prefetcht0 DOT_PREFETCH+64(%rdi)
+    prefetcht0 DOT_PREFETCH+64(%rsi)
+.endif
+    vmovu\op (%rdi), %ymm12
+    vmovu\op 32(%rdi), %ymm13
+    vmovu\op 64(%rdi), %ymm14
+    vmovu\op 96(%rdi), %ymm15
+    vfmadd231\op (%rsi), %ymm12, %ymm0
+    vfmadd231\op 32(%rsi), %ymm13, %ymm1
+    vfmadd231\op 64(%rsi), %ymm14, %ymm2
+    vfmadd231\op 96(%rsi), %ymm15, %ymm3
+.if \pf
+    prefetcht0 DOT_PREFETCH+128(%rdi)
+    prefetcht0 DOT_PREFETCH+128(%rsi)
+    prefetcht0 DOT_PREFETCH+192(%rdi)
+    prefetcht0 DOT_PREFETCH+192(%rsi)
+.endif
+    vmovu\op 128(%rdi), %ymm12
+    vmovu\op 160(%rdi), %ymm13
+    vmovu\op 192(%rdi), %ymm14
+    vmovu\op 224(%rdi), %ymm15
+    vfmadd231\op 128(%rsi), %ymm12, %ymm4
+    vfmadd231\op 160(%rsi), %ymm13, %ymm5
+    vfmadd231\op 192(%rsi), %ymm14, %ymm6
+    vfmadd231\op 224(%rsi), %ymm15, %ymm7
+.if \pf
+    prefetcht0 DOT_PREFETCH+256(%rdi)
+    prefetcht0 DOT_PREFETCH+256(%rsi)
+    prefetcht0 DOT_PREFETCH+320(%rdi)
+    prefetcht0 DOT_PREFETCH+320(%rsi)
+.endif
+    vmovu\op 256(%rdi), %ymm12
+    vmovu\op 288(%rdi), %ymm13
+    vmovu\op 320(%rdi), %ymm14
+    vmovu\op 352(%rdi), %ymm15
+    vfmadd231\op 256(%rsi), %ymm12, %ymm8
+    vfmadd231\op 288(%rsi), %ymm13, %ymm9
+    vfmadd231\op 320(%rsi), %ymm14, %ymm10
+    vfmadd231\op 352(%rsi), %ymm15, %ymm11
+    addq    $384, %rdi
+    addq    $384, %rsi
+.endm
+
+# DOT_AVX2 name, op (pd | ps), s (sd | ss), lanes (elements per ymm), shift
+.macro DOT_AVX2 name, op, s, lanes, shift
+    .globl  \name
+    .type   \name, @function
+    .p2align 5
+\name:
+    .cfi_startproc
+    vxorpd  %xmm0, %xmm0, %xmm0
+    vxorpd  %xmm1, %xmm1, %xmm1
+    vxorpd  %xmm2, %xmm2, %xmm2
+    vxorpd  %xmm3, %xmm3, %xmm3
+    vxorpd  %xmm4, %xmm4, %xmm4
+    vxorpd  %xmm5, %xmm5, %xmm5
+    vxorpd  %xmm6, %xmm6, %xmm6
+    vxorpd  %xmm7, %xmm7, %xmm7
+    vxorpd  %xmm8, %xmm8, %xmm8
+    vxorpd  %xmm9, %xmm9, %xmm9
+    vxorpd  %xmm10, %xmm10, %xmm10
+    vxorpd  %xmm11, %xmm11, %xmm11
+    cmpq    $(12 * \lanes), %rdx
+    jb      .L\name\()_vec
+
+    movl    %edi, %ecx                      # scalar head up to 32-byte alignment of x;
+    negl    %ecx                            # accumulates into the low lane of ymm0, whose
+    andl    $31, %ecx                       # upper lanes are still zero
+    shrl    $\shift, %ecx
+    subq    %rcx, %rdx
+.L\name\()_head:
+    testl   %ecx, %ecx
+    jz      .L\name\()_far_check
+    vmov\s  (%rdi), %xmm12
+    vfmadd231\s (%rsi), %xmm12, %xmm0
+    addq    $(1 << \shift), %rdi
+    addq    $(1 << \shift), %rsi
+    decl    %ecx
+    jmp     .L\name\()_head
+
+.L\name\()_far_check:
+    cmpq    $(DOT_PREFETCH_MIN >> \shift), %rdx
+    jb      .L\name\()_near_check
+
+    .p2align 4
+.L\name\()_far:
+    DOT_AVX2_STEP \op, 1
+    subq    $(12 * \lanes), %rdx
+    cmpq    $(DOT_PREFETCH_MIN >> \shift), %rdx
+    jae     .L\name\()_far
+
+.L\name\()_near_check:
+    cmpq    $(12 * \lanes), %rdx
+    jb      .L\name\()_vec
+
+    .p2align 4
+.L\name\()_near:
+    DOT_AVX2_STEP \op, 0
+    subq    $(12 * \lanes), %rdx
+    cmpq    $(12 * \lanes), %rdx
+    jae     .L\name\()_near
+
+.L\name\()_vec:
+    cmpq    $\lanes, %rdx
+    jb      .L\name\()_reduce
+    vmovu\op (%rdi), %ymm12
+    vfmadd231\op (%rsi), %ymm12, %ymm1
+    addq    $32, %rdi
+    addq    $32, %rsi
+    subq    $\lanes, %rdx
+    jmp     .L\name\()_vec
+
+.L\name\()_reduce:
+    vadd\op %ymm6, %ymm0, %ymm0
+    vadd\op %ymm7, %ymm1, %ymm1
+    vadd\op %ymm8, %ymm2, %ymm2
+    vadd\op %ymm9, %ymm3, %ymm3
+    vadd\op %ymm10, %ymm4, %ymm4
+    vadd\op %ymm11, %ymm5, %ymm5
+    vadd\op %ymm3, %ymm0, %ymm0
+    vadd\op %ymm4, %ymm1, %ymm1
+    vadd\op %ymm5, %ymm2, %ymm2
+    vadd\op %ymm1, %ymm0, %ymm0
+    vadd\op %ymm2, %ymm0, %ymm0
+    vextractf128 $1, %ymm0, %xmm1
+    vadd\op %xmm1, %xmm0, %xmm0
+.ifc \op, pd
+    vunpckhpd %xmm0, %xmm0, %xmm1
+    vaddsd  %xmm1, %xmm0, %xmm0
+.else
+    vmovhlps %xmm0, %xmm0, %xmm1
+    vaddps  %xmm1, %xmm0, %xmm0
+    vmovshdup %xmm0, %xmm1
+    vaddss  %xmm1, %xmm0, %xmm0
+.endif
+
+.L\name\()_tail:                            # rdx < lanes elements, scalar FMA into xmm0
+    testq   %rdx, %rdx
+    jz      .L\name\()_done
+    vmov\s  (%rdi), %xmm1
+    vfmadd231\s (%rsi), %xmm1, %xmm0
+    addq    $(1 << \shift), %rdi
+    addq    $(1 << \shift), %rsi
+    decq    %rdx
+    jmp     .L\name\()_tail
+
+.L\name\()_done:
+    vzeroupper
+    ret
+    .cfi_endproc
+    .size   \name, .-\name
+.endm
+
+# 4 vectors (128 bytes): y = a * x + y with a in ymm15.
+.macro AXPY_AVX2_STEP op, pf
+.if \pf
+    prefetcht0 DOT_PREFETCH(%rsi)
+    prefetcht0 DOT_PREFETCH+64(%rsi)
+    prefetchw DOT_PREFETCH(%rdx)
+    prefetchw DOT_PREFETCH+64(%rdx)
+.endif
+    vmovu\op (%rsi), %ymm1
+    vmovu\op 32(%rsi), %ymm2
+    vmovu\op 64(%rsi), %ymm3
+    vmovu\op 96(%rsi), %ymm4
+    vfmadd213\op (%rdx), %ymm15, %ymm1
+    vfmadd213\op 32(%rdx), %ymm15, %ymm2
+    vfmadd213\op 64(%rdx), %ymm15, %ymm3
+    vfmadd213\op 96(%rdx), %ymm15, %ymm4
+    vmovu\op %ymm1, (%rdx)
+    vmovu\op %ymm2, 32(%rdx)
+    vmovu\op %ymm3, 64(%rdx)
+    vmovu\op %ymm4, 96(%rdx)
+    addq    $128, %rsi
+    addq    $128, %rdx
+.endm
+
+# AXPY_AVX2 name, op (pd | ps), s (sd | ss), lanes, shift
+.macro AXPY_AVX2 name, op, s, lanes, shift
+    .globl  \name
+    .type   \name, @function
+    .p2align 5
+\name:
+    .cfi_startproc
+    vbroadcast\s %xmm0, %ymm15
+    cmpq    $(4 * \lanes), %rdi
+    jb      .L\name\()_vec
+
+    movl    %edx, %ecx                      # scalar head up to 32-byte alignment of y
+    negl    %ecx
+    andl    $31, %ecx
+    shrl    $\shift, %ecx
+    subq    %rcx, %rdi
+.L\name\()_head:
+    testl   %ecx, %ecx
+    jz      .L\name\()_far_check
+    vmov\s  (%rsi), %xmm1
+    vfmadd213\s (%rdx), %xmm15, %xmm1
+    vmov\s  %xmm1, (%rdx)
+    addq    $(1 << \shift), %rsi
+    addq    $(1 << \shift), %rdx
+    decl    %ecx
+    jmp     .L\name\()_head
+
+.L\name\()_far_check:
+    cmpq    $(DOT_PREFETCH_MIN >> \shift), %rdi
+    jb      .L\name\()_near_check
+
+    .p2align 4
+.L\name\()_far:
+    AXPY_AVX2_STEP \op, 1
+    subq    $(4 * \lanes), %rdi
+    cmpq    $(DOT_PREFETCH_MIN >> \shift), %rdi
+    jae     .L\name\()_far
+
+.L\name\()_near_check:
+    cmpq    $(4 * \lanes), %rdi
+    jb      .L\name\()_vec
+
+    .p2align 4
+.L\name\()_near:
+    AXPY_AVX2_STEP \op, 0
+    subq    $(4 * \lanes), %rdi
+    cmpq    $(4 * \lanes), %rdi
+    jae     .L\name\()_near
+
+.L\name\()_vec:
+    cmpq    $\lanes, %rdi
+    jb      .L\name\()_tail
+    vmovu\op (%rsi), %ymm1
+    vfmadd213\op (%rdx), %ymm15, %ymm1
+    vmovu\op %ymm1, (%rdx)
+    addq    $32, %rsi
+    addq    $32, %rdx
+    subq    $\lanes, %rdi
+    jmp     .L\name\()_vec
+
+.L\name\()_tail:
+    testq   %rdi, %rdi
+    jz      .L\name\()_done
+    vmov\s  (%rsi), %xmm1
+    vfmadd213\s (%rdx), %xmm15, %xmm1
+    vmov\s  %xmm1, (%rdx)
+    addq    $(1 << \shift), %rsi
+    addq    $(1 << \shift), %rdx
+    decq    %rdi
+    jmp     .L\name\()_tail
+
+.L\name\()_done:
+    vzeroupper
+    ret
+    .cfi_endproc
+    .size   \name, .-\name
+.endm
+
+    DOT_AVX2    senkaid_asm_ddot_avx2, pd, sd, 4, 3
+    DOT_AVX2    senkaid_asm_sdot_avx2, ps, ss, 8, 2
+    AXPY_AVX2   senkaid_asm_daxpy_avx2, pd, sd, 4, 3
+    AXPY_AVX2   senkaid_asm_saxpy_avx2, ps, ss, 8, 2
+
+    .section .note.GNU-stack,"",@progbits
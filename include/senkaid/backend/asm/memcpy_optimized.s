@@ -0,0 +1,63 @@
+# memcpy_optimized.s: Non-temporal block copy for large buffers (x86-64, System V ABI, AT&T syntax).
+#
+# void senkaid_asm_stream_copy_avx512(void* dst, const void* src, size_t bytes)
+# void senkaid_asm_stream_copy_avx(void* dst, const void* src, size_t bytes)
+#   rdi = dst (64-byte aligned), rsi = src (any alignment), rdx = bytes (multiple of 64)
+#
+# Copies whole cache lines with unaligned loads and vmovntdq stores, four lines per step and
+# then one line at a time. The stores bypass the caches, so the destination lines are never
+# read for ownership (saving a third of the memory traffic of a plain copy) and the working
+# set is not evicted. Ends with sfence, so the data is globally visible on return. Head and
+# tail bytes that do not fill a line are left to the caller (utils/memory/utils.hpp).
+
+    .text
+
+.macro STREAM_COPY name, load, reg, width
+    .globl  \name
+    .type   \name, @function
+    .p2align 5
+\name:
+    .cfi_startproc
+    cmpq    $256, %rdx
+    jb      .L\name\()_line
+
+    .p2align 4
+.L\name\()_block:                           # 4 lines
+.set off, 0
+.rept 256 / \width
+    \load (off)(%rsi), %\reg\()0
+    vmovntdq %\reg\()0, (off)(%rdi)
+.set off, off + \width
+.endr
+    addq    $256, %rsi
+    addq    $256, %rdi
+    subq    $256, %rdx
+    cmpq    $256, %rdx
+    jae     .L\name\()_block
+
+.L\name\()_line:
+    testq   %rdx, %rdx
+    jz      .L\name\()_done
+.set off, 0
+.rept 64 / \width
+    \load (off)(%rsi), %\reg\()0
+    vmovntdq %\reg\()0, (off)(%rdi)
+.set off, off + \width
+.endr
+    addq    $64, %rsi
+    addq    $64, %rdi
+    subq    $64, %rdx
+    jmp     .L\name\()_line
+
+.L\name\()_done:
+    sfence
+    vzeroupper
+    ret
+    .cfi_endproc
+    .size   \name, .-\name
+.endm
+
+    STREAM_COPY senkaid_asm_stream_copy_avx512, vmovdqu64, zmm, 64
+    STREAM_COPY senkaid_asm_stream_copy_avx, vmovdqu, ymm, 32
+
+    .section .note.GNU-stack,"",@progbits
@@ -0,0 +1,91 @@
+# transpose.s: AVX-512 8x8 double block transpose (x86-64, System V ABI, AT&T syntax).
+#
+# void senkaid_asm_transpose_8x8_f64(const double* src, size_t lds, double* dst, size_t ldd)
+#   rdi = src, rsi = lds (elements), rdx = dst, rcx = ldd (elements)
+#   dst[j * ldd + i] = src[i * lds + j] for i, j in [0, 8)
+#
+# Same network as backend/simd/simd_transpose.hpp: unpack row pairs, then two rounds of
+# 128-bit lane shuffles (vshuff64x2 0x88 / 0xDD). All 8 rows stay in registers; only
+# volatile zmm registers are used, so no spills and no stack frame.
+#
+# void senkaid_asm_transpose_8x8_f64_nt(...)
+#   Same, with non-temporal stores. Every dst line must be 64-byte aligned.
+
+    .text
+
+.macro TRANSPOSE_8X8_F64 store
+    shlq    $3, %rsi                        # strides in bytes
+    shlq    $3, %rcx
+    leaq    (%rsi,%rsi,2), %r8              # 3 * lds
+    leaq    (%rcx,%rcx,2), %r9              # 3 * ldd
+
+    vmovupd (%rdi), %zmm0                   # rows 0..3
+    vmovupd (%rdi,%rsi), %zmm1
+    vmovupd (%rdi,%rsi,2), %zmm2
+    vmovupd (%rdi,%r8), %zmm3
+    leaq    (%rdi,%rsi,4), %rdi
+    vmovupd (%rdi), %zmm4                   # rows 4..7
+    vmovupd (%rdi,%rsi), %zmm5
+    vmovupd (%rdi,%rsi,2), %zmm6
+    vmovupd (%rdi,%r8), %zmm7
+
+    vunpcklpd %zmm1, %zmm0, %zmm8           # t0 = 00 10 02 12 04 14 06 16
+    vunpckhpd %zmm1, %zmm0, %zmm9           # t1 = 01 11 03 13 05 15 07 17
+    vunpcklpd %zmm3, %zmm2, %zmm10          # t2
+    vunpckhpd %zmm3, %zmm2, %zmm11          # t3
+    vunpcklpd %zmm5, %zmm4, %zmm12          # t4
+    vunpckhpd %zmm5, %zmm4, %zmm13          # t5
+    vunpcklpd %zmm7, %zmm6, %zmm14          # t6
+    vunpckhpd %zmm7, %zmm6, %zmm15          # t7
+
+    vshuff64x2 $0x88, %zmm10, %zmm8, %zmm0  # s0 (even t, lanes 0/2)
+    vshuff64x2 $0x88, %zmm14, %zmm12, %zmm1 # s1
+    vshuff64x2 $0xDD, %zmm10, %zmm8, %zmm2  # s2 (even t, lanes 1/3)
+    vshuff64x2 $0xDD, %zmm14, %zmm12, %zmm3 # s3
+    vshuff64x2 $0x88, %zmm11, %zmm9, %zmm4  # odd t
+    vshuff64x2 $0x88, %zmm15, %zmm13, %zmm5
+    vshuff64x2 $0xDD, %zmm11, %zmm9, %zmm6
+    vshuff64x2 $0xDD, %zmm15, %zmm13, %zmm7
+
+    vshuff64x2 $0x88, %zmm1, %zmm0, %zmm16  # column 0
+    vshuff64x2 $0xDD, %zmm1, %zmm0, %zmm20  # column 4
+    vshuff64x2 $0x88, %zmm3, %zmm2, %zmm18  # column 2
+    vshuff64x2 $0xDD, %zmm3, %zmm2, %zmm22  # column 6
+    vshuff64x2 $0x88, %zmm5, %zmm4, %zmm17  # column 1
+    vshuff64x2 $0xDD, %zmm5, %zmm4, %zmm21  # column 5
+    vshuff64x2 $0x88, %zmm7, %zmm6, %zmm19  # column 3
+    vshuff64x2 $0xDD, %zmm7, %zmm6, %zmm23  # column 7
+
+    \store  %zmm16, (%rdx)
+    \store  %zmm17, (%rdx,%rcx)
+    \store  %zmm18, (%rdx,%rcx,2)
+    \store  %zmm19, (%rdx,%r9)
+    leaq    (%rdx,%rcx,4), %rdx
+    \store  %zmm20, (%rdx)
+    \store  %zmm21, (%rdx,%rcx)
+    \store  %zmm22, (%rdx,%rcx,2)
+    \store  %zmm23, (%rdx,%r9)
+
+    vzeroupper
+    ret
+.endm
+
+    .globl  senkaid_asm_transpose_8x8_f64
+    .type   senkaid_asm_transpose_8x8_f64, @function
+    .p2align 5
+senkaid_asm_transpose_8x8_f64:
+    .cfi_startproc
+    TRANSPOSE_8X8_F64 vmovupd
+    .cfi_endproc
+    .size   senkaid_asm_transpose_8x8_f64, .-senkaid_asm_transpose_8x8_f64
+
+    .globl  senkaid_asm_transpose_8x8_f64_nt
+    .type   senkaid_asm_transpose_8x8_f64_nt, @function
+    .p2align 5
+senkaid_asm_transpose_8x8_f64_nt:
+    .cfi_startproc
+    TRANSPOSE_8X8_F64 vmovntpd
+    .cfi_endproc
+    .size   senkaid_asm_transpose_8x8_f64_nt, .-senkaid_asm_transpose_8x8_f64_nt
+
+    .section .note.GNU-stack,"",@progbits
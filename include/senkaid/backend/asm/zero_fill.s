@@ -0,0 +1,95 @@
+# zero_fill.s: Non-temporal byte fill for large buffers (x86-64, System V ABI, AT&T syntax).
+#
+# void senkaid_asm_stream_fill_avx512(void* dst, int value, size_t bytes)
+# void senkaid_asm_stream_fill_avx(void* dst, int value, size_t bytes)
+#   rdi = dst (64-byte aligned), esi = byte value (low 8 bits), rdx = bytes (multiple of 64)
+#
+# Zero-initialization is value = 0. The byte is spread over a dword with imul and broadcast
+# from there (vpbroadcastd from a GPR is AVX-512F; the byte form would need AVX-512BW), then
+# written four lines per step with vmovntdq, which needs no read-for-ownership of the target
+# lines. Ends with sfence. Head and tail bytes are left to the caller (utils/memory/utils.hpp).
+
+    .text
+
+    .globl  senkaid_asm_stream_fill_avx512
+    .type   senkaid_asm_stream_fill_avx512, @function
+    .p2align 5
+senkaid_asm_stream_fill_avx512:
+    .cfi_startproc
+    movzbl  %sil, %eax
+    imull   $0x01010101, %eax, %eax
+    vpbroadcastd %eax, %zmm0
+    cmpq    $256, %rdx
+    jb      .Lfill512_line
+
+    .p2align 4
+.Lfill512_block:
+    vmovntdq %zmm0, (%rdi)
+    vmovntdq %zmm0, 64(%rdi)
+    vmovntdq %zmm0, 128(%rdi)
+    vmovntdq %zmm0, 192(%rdi)
+    addq    $256, %rdi
+    subq    $256, %rdx
+    cmpq    $256, %rdx
+    jae     .Lfill512_block
+
+.Lfill512_line:
+    testq   %rdx, %rdx
+    jz      .Lfill512_done
+    vmovntdq %zmm0, (%rdi)
+    addq    $64, %rdi
+    subq    $64, %rdx
+    jmp     .Lfill512_line
+
+.Lfill512_done:
+    sfence
+    vzeroupper
+    ret
+    .cfi_endproc
+    .size   senkaid_asm_stream_fill_avx512, .-senkaid_asm_stream_fill_avx512
+
+    .globl  senkaid_asm_stream_fill_avx
+    .type   senkaid_asm_stream_fill_avx, @function
+    .p2align 5
+senkaid_asm_stream_fill_avx:
+    .cfi_startproc
+    movzbl  %sil, %eax
+    imull   $0x01010101, %eax, %eax
+    vmovd   %eax, %xmm0
+    vpshufd $0, %xmm0, %xmm0
+    vinsertf128 $1, %xmm0, %ymm0, %ymm0
+    cmpq    $256, %rdx
+    jb      .Lfillavx_line
+
+    .p2align 4
+.Lfillavx_block:
+    vmovntdq %ymm0, (%rdi)
+    vmovntdq %ymm0, 32(%rdi)
+    vmovntdq %ymm0, 64(%rdi)
+    vmovntdq %ymm0, 96(%rdi)
+    vmovntdq %ymm0, 128(%rdi)
+    vmovntdq %ymm0, 160(%rdi)
+    vmovntdq %ymm0, 192(%rdi)
+    vmovntdq %ymm0, 224(%rdi)
+    addq    $256, %rdi
+    subq    $256, %rdx
+    cmpq    $256, %rdx
+    jae     .Lfillavx_block
+
+.Lfillavx_line:
+    testq   %rdx, %rdx
+    jz      .Lfillavx_done
+    vmovntdq %ymm0, (%rdi)
+    vmovntdq %ymm0, 32(%rdi)
+    addq    $64, %rdi
+    subq    $64, %rdx
+    jmp     .Lfillavx_line
+
+.Lfillavx_done:
+    sfence
+    vzeroupper
+    ret
+    .cfi_endproc
+    .size   senkaid_asm_stream_fill_avx, .-senkaid_asm_stream_fill_avx
+
+    .section .note.GNU-stack,"",@progbits
@@ -0,0 +1,377 @@
+#pragma once
+
+// batched_cpu.hpp: Kernels for one group of the compact interleaved layout.
+// A group holds L small matrices with element (i, j) of all of them stored contiguously
+// (see core/layout/layout_policy.hpp). Every kernel runs the plain scalar algorithm once per
+// group on whole L-lane vectors (one vector per matrix element), so every operation is full
+// width; data-dependent choices (pivot rows, failed lanes) become per-lane selects.
+
+#include <senkaid/utils/config/root.hpp>
+#include <senkaid/utils/debug/root.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+
+namespace senkaid::backend::cpu::compact
+{
+
+namespace detail
+{
+
+#if defined(SENKAID_COMPILER_GCC) || defined(SENKAID_COMPILER_CLANG)
+
+// Lanes: One interleaved element, L values wide, as a native vector. The loop-over-lanes form
+// is not reliably vectorized (GCC scalarizes the pivot search and the small GEMM), so the
+// kernels use vector-extension types directly, like the GEMM micro-kernel.
+template <typename TN, std::size_t L>
+struct Lanes
+{
+    typedef TN type __attribute__((vector_size(L * sizeof(TN)), aligned(sizeof(TN)), may_alias));
+};
+
+template <typename V>
+SENKAID_FORCE_INLINE V select(decltype(V{} < V{}) mask, V a, V b) noexcept
+{
+    return mask ? a : b;
+}
+
+template <typename V>
+SENKAID_FORCE_INLINE V abs(V v) noexcept
+{
+    return v < V{} ? -v : v;
+}
+
+template <typename M>
+SENKAID_FORCE_INLINE bool any(M mask, std::size_t lanes) noexcept
+{
+    for (std::size_t l = 0; l < lanes; ++l)
+        if (mask[l])
+            return true;
+    return false;
+}
+
+#else
+
+// Portable stand-in with element-wise operators for compilers without vector extensions.
+template <typename TN, std::size_t L>
+struct LaneArray
+{
+    TN v[L];
+
+    TN& operator[](std::size_t l) noexcept { return v[l]; }
+    const TN& operator[](std::size_t l) const noexcept { return v[l]; }
+
+#define SENKAID_LANE_OP(op)                                                                 \
+    friend LaneArray operator op(LaneArray a, const LaneArray& b) noexcept                  \
+    {                                                                                       \
+        for (std::size_t l = 0; l < L; ++l) a.v[l] = a.v[l] op b.v[l];                      \
+        return a;                                                                           \
+    }                                                                                       \
+    friend LaneArray operator op(LaneArray a, TN b) noexcept                                \
+    {                                                                                       \
+        for (std::size_t l = 0; l < L; ++l) a.v[l] = a.v[l] op b;                           \
+        return a;                                                                           \
+    }                                                                                       \
+    LaneArray& operator op##=(const LaneArray& b) noexcept { return *this = *this op b; }
+    SENKAID_LANE_OP(+)
+    SENKAID_LANE_OP(-)
+    SENKAID_LANE_OP(*)
+    SENKAID_LANE_OP(/)
+#undef SENKAID_LANE_OP
+
+    friend LaneArray operator-(LaneArray a) noexcept
+    {
+        for (std::size_t l = 0; l < L; ++l) a.v[l] = -a.v[l];
+        return a;
+    }
+
+    struct Mask
+    {
+        bool m[L];
+        bool operator[](std::size_t l) const noexcept { return m[l]; }
+
+        friend Mask operator&(Mask a, const Mask& b) noexcept
+        {
+            for (std::size_t l = 0; l < L; ++l) a.m[l] = a.m[l] && b.m[l];
+            return a;
+        }
+
+        friend Mask operator!(Mask a) noexcept
+        {
+            for (std::size_t l = 0; l < L; ++l) a.m[l] = !a.m[l];
+            return a;
+        }
+    };
+
+#define SENKAID_LANE_CMP(op)                                                                \
+    friend Mask operator op(const LaneArray& a, const LaneArray& b) noexcept                \
+    {                                                                                       \
+        Mask r;                                                                             \
+        for (std::size_t l = 0; l < L; ++l) r.m[l] = a.v[l] op b.v[l];                      \
+        return r;                                                                           \
+    }
+    SENKAID_LANE_CMP(<)
+    SENKAID_LANE_CMP(>)
+    SENKAID_LANE_CMP(==)
+    SENKAID_LANE_CMP(!=)
+#undef SENKAID_LANE_CMP
+};
+
+template <typename TN, std::size_t L>
+struct Lanes
+{
+    using type = LaneArray<TN, L>;
+};
+
+template <typename V>
+SENKAID_FORCE_INLINE V select(const typename V::Mask& mask, V a, V b) noexcept
+{
+    for (std::size_t l = 0; l < sizeof(a.v) / sizeof(a.v[0]); ++l)
+        a.v[l] = mask[l] ? a.v[l] : b.v[l];
+    return a;
+}
+
+template <typename V>
+SENKAID_FORCE_INLINE V abs(V v) noexcept
+{
+    for (auto& x : v.v)
+        x = x < 0 ? -x : x;
+    return v;
+}
+
+template <typename M>
+SENKAID_FORCE_INLINE bool any(const M& mask, std::size_t lanes) noexcept
+{
+    for (std::size_t l = 0; l < lanes; ++l)
+        if (mask[l])
+            return true;
+    return false;
+}
+
+#endif
+
+template <typename TN, std::size_t L>
+using lanes_t = typename Lanes<TN, L>::type;
+
+template <typename TN, std::size_t L>
+SENKAID_FORCE_INLINE lanes_t<TN, L> splat(TN x) noexcept
+{
+    lanes_t<TN, L> v;
+    for (std::size_t l = 0; l < L; ++l)
+        v[l] = x;
+    return v;
+}
+
+} // namespace detail
+
+// gemm: C := alpha * A * B + beta * C for one group; A is M x K, B is K x N, C is M x N.
+// beta == 0 ignores C's contents.
+template <std::size_t M, std::size_t N, std::size_t K, std::size_t L, typename TN>
+void gemm(TN alpha, const TN* a, const TN* b, TN beta, TN* c)
+{
+    using V = detail::lanes_t<TN, L>;
+    const V* av = reinterpret_cast<const V*>(a);
+    const V* bv = reinterpret_cast<const V*>(b);
+    V* cv = reinterpret_cast<V*>(c);
+
+    for (std::size_t j = 0; j < N; ++j)
+    {
+        V acc[M];
+        for (std::size_t i = 0; i < M; ++i)
+            acc[i] = detail::splat<TN, L>(TN(0));
+
+        for (std::size_t p = 0; p < K; ++p)
+        {
+            const V bp = bv[p + j * K];
+            for (std::size_t i = 0; i < M; ++i)
+                acc[i] += av[i + p * M] * bp;
+        }
+
+        V* cj = cv + j * M;
+        if (beta == TN(0))
+            for (std::size_t i = 0; i < M; ++i)
+                cj[i] = acc[i] * alpha;
+        else
+            for (std::size_t i = 0; i < M; ++i)
+                cj[i] = acc[i] * alpha + cj[i] * beta;
+    }
+}
+
+// swap_rows: Per lane, exchanges row j with row piv[l] (>= j) over columns [0, Cols).
+// Row indices are stored as TN so the comparison stays in the same vector domain.
+template <std::size_t Rows, std::size_t Cols, std::size_t L, typename V>
+SENKAID_FORCE_INLINE void swap_rows(V* g, std::size_t j, V piv)
+{
+    using TN = std::remove_cvref_t<decltype(piv[0])>;
+
+    if (!detail::any(piv != detail::splat<TN, L>(TN(j)), L))
+        return;
+
+    for (std::size_t i = j + 1; i < Rows; ++i)
+    {
+        const auto hit = piv == detail::splat<TN, L>(TN(i));
+        if (!detail::any(hit, L))
+            continue;
+
+        for (std::size_t c = 0; c < Cols; ++c)
+        {
+            V& rj = g[j + c * Rows];
+            V& ri = g[i + c * Rows];
+            const V x = rj;
+            rj = detail::select(hit, ri, x);
+            ri = detail::select(hit, x, ri);
+        }
+    }
+}
+
+// getrf: LU with partial pivoting of N x N matrices, P * A = L * U, per lane.
+// piv receives N pivot rows per lane (as TN, 0-based); info receives, per lane, the
+// 1-based index of the first exactly zero pivot or 0.
+template <std::size_t N, std::size_t L, typename TN>
+void getrf(TN* a, TN* piv, TN* info)
+{
+    using V = detail::lanes_t<TN, L>;
+    V* av = reinterpret_cast<V*>(a);
+    V* pv = reinterpret_cast<V*>(piv);
+    const V zero = detail::splat<TN, L>(TN(0));
+    const V one = detail::splat<TN, L>(TN(1));
+    V status = zero;
+
+    for (std::size_t j = 0; j < N; ++j)
+    {
+        V* colj = av + j * N;
+        V best = detail::abs(colj[j]);
+        V p = detail::splat<TN, L>(TN(j));
+
+        for (std::size_t i = j + 1; i < N; ++i)
+        {
+            const V v = detail::abs(colj[i]);
+            const auto gt = v > best;
+            best = detail::select(gt, v, best);
+            p = detail::select(gt, detail::splat<TN, L>(TN(i)), p);
+        }
+        pv[j] = p;
+
+        swap_rows<N, N, L>(av, j, p);
+
+        const auto singular = colj[j] == zero;
+        status = detail::select(singular & (status == zero), detail::splat<TN, L>(TN(j + 1)), status);
+        const V inv = one / detail::select(singular, one, colj[j]);
+
+        for (std::size_t i = j + 1; i < N; ++i)
+            colj[i] *= inv;
+
+        for (std::size_t c = j + 1; c < N; ++c)
+        {
+            V* colc = av + c * N;
+            const V u = colc[j];
+            for (std::size_t i = j + 1; i < N; ++i)
+                colc[i] -= colj[i] * u;
+        }
+    }
+
+    std::memcpy(info, &status, sizeof(V));
+}
+
+// getrs: Solves A * X = B from the getrf factors; B (N x NRHS) is overwritten by X.
+template <std::size_t N, std::size_t NRHS, std::size_t L, typename TN>
+void getrs(const TN* lu, const TN* piv, TN* b)
+{
+    using V = detail::lanes_t<TN, L>;
+    const V* lv = reinterpret_cast<const V*>(lu);
+    const V* pv = reinterpret_cast<const V*>(piv);
+    V* bv = reinterpret_cast<V*>(b);
+
+    for (std::size_t j = 0; j < N; ++j)
+        swap_rows<N, NRHS, L>(bv, j, pv[j]);
+
+    for (std::size_t c = 0; c < NRHS; ++c)
+    {
+        V* x = bv + c * N;
+
+        // L * y = b (unit diagonal)
+        for (std::size_t j = 0; j < N; ++j)
+            for (std::size_t i = j + 1; i < N; ++i)
+                x[i] -= lv[i + j * N] * x[j];
+
+        // U * x = y
+        for (std::size_t j = N; j-- > 0;)
+        {
+            x[j] /= lv[j + j * N];
+            for (std::size_t i = 0; i < j; ++i)
+                x[i] -= lv[i + j * N] * x[j];
+        }
+    }
+}
+
+// potrf: Cholesky A = L * L^T of N x N matrices per lane, lower triangle only.
+// info receives, per lane, the order of the first non-positive leading minor or 0; the factor
+// of a failed lane is not meaningful.
+template <std::size_t N, std::size_t L, typename TN>
+void potrf(TN* a, TN* info)
+{
+    using V = detail::lanes_t<TN, L>;
+    V* av = reinterpret_cast<V*>(a);
+    const V zero = detail::splat<TN, L>(TN(0));
+    const V one = detail::splat<TN, L>(TN(1));
+    V status = zero;
+
+    for (std::size_t j = 0; j < N; ++j)
+    {
+        V* colj = av + j * N;
+
+        for (std::size_t p = 0; p < j; ++p)
+        {
+            const V* colp = av + p * N;
+            const V ljp = colp[j];
+            for (std::size_t i = j; i < N; ++i)
+                colj[i] -= colp[i] * ljp;
+        }
+
+        const auto bad = !(colj[j] > zero);
+        status = detail::select(bad & (status == zero), detail::splat<TN, L>(TN(j + 1)), status);
+        V d = detail::select(bad, one, colj[j]);
+        for (std::size_t l = 0; l < L; ++l)
+            d[l] = std::sqrt(d[l]);
+        colj[j] = d;
+
+        const V inv = one / d;
+        for (std::size_t i = j + 1; i < N; ++i)
+            colj[i] *= inv;
+    }
+
+    std::memcpy(info, &status, sizeof(V));
+}
+
+// potrs: Solves A * X = B from the potrf factor; B (N x NRHS) is overwritten by X.
+template <std::size_t N, std::size_t NRHS, std::size_t L, typename TN>
+void potrs(const TN* l_factor, TN* b)
+{
+    using V = detail::lanes_t<TN, L>;
+    const V* lv = reinterpret_cast<const V*>(l_factor);
+    V* bv = reinterpret_cast<V*>(b);
+
+    for (std::size_t c = 0; c < NRHS; ++c)
+    {
+        V* x = bv + c * N;
+
+        // L * y = b
+        for (std::size_t j = 0; j < N; ++j)
+        {
+            x[j] /= lv[j + j * N];
+            for (std::size_t i = j + 1; i < N; ++i)
+                x[i] -= lv[i + j * N] * x[j];
+        }
+
+        // L^T * x = y
+        for (std::size_t j = N; j-- > 0;)
+        {
+            for (std::size_t i = j + 1; i < N; ++i)
+                x[j] -= lv[i + j * N] * x[i];
+            x[j] /= lv[j + j * N];
+        }
+    }
+}
+
+} // namespace senkaid::backend::cpu::compact
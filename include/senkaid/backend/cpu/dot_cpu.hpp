@@ -0,0 +1,334 @@
+#pragma once
+
+// dot_cpu.hpp: Level-1 BLAS kernels (dot, axpy, rot and fused compounds) on float / double buffers.
+// The main loops move four native packs per step with independent accumulators, prefetch
+// prefetch_distance<TN> elements ahead, and finish with one masked step from
+// simd_load_store.hpp, so odd lengths (17, 1001, ...) pay no scalar remainder loop.
+// Other element types take a plain loop. Builds with SENKAID_ENABLE_ASM route float / double
+// dot, and axpy up to asm_axpy_max_bytes, to the hand-written kernels in
+// backend/asm/dot_product.s (wider unroll, aligned main loop); the intrinsic loops below remain
+// the fallback everywhere else.
+//
+// The fused kernels (axpby, xpby, waxpby, scal_copy, axpy_dot) do in one pass what would
+// otherwise be two or three level-1 calls, e.g. axpy_dot updates y and returns y . y while y is
+// still in registers. Iterative solvers are bound by memory traffic, and CG's
+// r -= alpha A p; rr = r . r; p = r + beta p reads r three times unfused but only twice fused.
+
+#include <senkaid/utils/config/root.hpp>
+#include <senkaid/backend/simd/simd_common.hpp>
+#include <senkaid/backend/simd/simd_load_store.hpp>
+#include <senkaid/backend/asm/asm_dispatch.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+namespace senkaid::backend::cpu
+{
+
+namespace detail
+{
+
+template <typename TN>
+inline constexpr bool simd_level1 = std::is_same_v<TN, float> || std::is_same_v<TN, double>;
+
+// level1_unroll: Packs per main-loop step; also the number of dot accumulators.
+inline constexpr std::size_t level1_unroll = 4;
+
+// asm_dot / asm_axpy: Forward to backend/asm/dot_product.s; deleted where it is not linked.
+template <typename TN>
+TN asm_dot(const TN*, const TN*, std::size_t) = delete;
+template <typename TN>
+void asm_axpy(TN, const TN*, TN*, std::size_t) = delete;
+
+#if defined(SENKAID_ASM_DOT_AVX512)
+SENKAID_FORCE_INLINE double asm_dot(const double* x, const double* y, std::size_t n) noexcept { return senkaid_asm_ddot_avx512(x, y, n); }
+SENKAID_FORCE_INLINE float asm_dot(const float* x, const float* y, std::size_t n) noexcept { return senkaid_asm_sdot_avx512(x, y, n); }
+SENKAID_FORCE_INLINE void asm_axpy(double a, const double* x, double* y, std::size_t n) noexcept { senkaid_asm_daxpy_avx512(n, a, x, y); }
+SENKAID_FORCE_INLINE void asm_axpy(float a, const float* x, float* y, std::size_t n) noexcept { senkaid_asm_saxpy_avx512(n, a, x, y); }
+#elif defined(SENKAID_ASM_DOT_AVX2)
+SENKAID_FORCE_INLINE double asm_dot(const double* x, const double* y, std::size_t n) noexcept { return senkaid_asm_ddot_avx2(x, y, n); }
+SENKAID_FORCE_INLINE float asm_dot(const float* x, const float* y, std::size_t n) noexcept { return senkaid_asm_sdot_avx2(x, y, n); }
+SENKAID_FORCE_INLINE void asm_axpy(double a, const double* x, double* y, std::size_t n) noexcept { senkaid_asm_daxpy_avx2(n, a, x, y); }
+SENKAID_FORCE_INLINE void asm_axpy(float a, const float* x, float* y, std::size_t n) noexcept { senkaid_asm_saxpy_avx2(n, a, x, y); }
+#endif
+
+// level1_loop: body(k, u, io) over [0, n): level1_unroll packs per main-loop step, u being the
+// pack's slot in the step (0 in the tail), with `streams` prefetched ahead; then one masked step.
+template <typename TN, typename Body, typename... Streams>
+SENKAID_FORCE_INLINE void level1_loop(std::size_t n, Body&& body, const Streams*... streams)
+{
+    using P = simd::pack<TN>;
+    constexpr std::size_t L = P::lanes;
+    constexpr std::size_t step = level1_unroll * L;
+    constexpr std::size_t ahead = simd::prefetch_distance<TN>;
+
+    std::size_t i = 0;
+    for (; i + step <= n; i += step)
+    {
+        (simd::prefetch(streams + i + ahead), ...);
+        for (std::size_t u = 0; u < level1_unroll; ++u)
+            body(i + u * L, u, simd::full_io<P>{});
+    }
+    simd::for_each_pack<TN>(i, n, [&](std::size_t k, auto io) { body(k, 0, io); });
+}
+
+// asm_level1: The asm kernels cover TN in this build.
+template <typename TN>
+inline constexpr bool asm_level1 =
+#if defined(SENKAID_ASM_DOT_AVX512) || defined(SENKAID_ASM_DOT_AVX2)
+    simd_level1<TN>;
+#else
+    false;
+#endif
+
+// dot_simd / axpy_simd: The intrinsic loops for float / double, whatever the build routes to.
+template <typename TN>
+TN dot_simd(const TN* SENKAID_RESTRICT x, const TN* SENKAID_RESTRICT y, std::size_t n)
+{
+    using P = simd::pack<TN>;
+    constexpr std::size_t L = P::lanes;
+    constexpr std::size_t step = level1_unroll * L;
+    constexpr std::size_t ahead = simd::prefetch_distance<TN>;
+
+    P s0 = P::zero(), s1 = P::zero(), s2 = P::zero(), s3 = P::zero();
+
+    std::size_t i = 0;
+    for (; i + step <= n; i += step)
+    {
+        simd::prefetch(x + i + ahead);
+        simd::prefetch(y + i + ahead);
+        s0 = fma(P::loadu(x + i), P::loadu(y + i), s0);
+        s1 = fma(P::loadu(x + i + L), P::loadu(y + i + L), s1);
+        s2 = fma(P::loadu(x + i + 2 * L), P::loadu(y + i + 2 * L), s2);
+        s3 = fma(P::loadu(x + i + 3 * L), P::loadu(y + i + 3 * L), s3);
+    }
+    simd::for_each_pack<TN>(i, n, [&](std::size_t k, auto io) {
+        s0 = fma(io.load(x + k), io.load(y + k), s0);
+    });
+
+    return reduce_add((s0 + s1) + (s2 + s3));
+}
+
+template <typename TN>
+void axpy_simd(TN a, const TN* SENKAID_RESTRICT x, TN* SENKAID_RESTRICT y, std::size_t n)
+{
+    using P = simd::pack<TN>;
+    constexpr std::size_t L = P::lanes;
+    constexpr std::size_t step = level1_unroll * L;
+    constexpr std::size_t ahead = simd::prefetch_distance<TN>;
+
+    const P va(a);
+
+    std::size_t i = 0;
+    for (; i + step <= n; i += step)
+    {
+        simd::prefetch(x + i + ahead);
+        simd::prefetch_write(y + i + ahead);
+        for (std::size_t u = 0; u < step; u += L)
+            fma(va, P::loadu(x + i + u), P::loadu(y + i + u)).storeu(y + i + u);
+    }
+    simd::for_each_pack<TN>(i, n, [&](std::size_t k, auto io) {
+        io.store(y + k, fma(va, io.load(x + k), io.load(y + k)));
+    });
+}
+
+// asm_axpy_max_bytes: Largest x for which axpy() takes the asm kernel. From a few hundred KiB on
+// the asm loop is no faster than the intrinsic one, and slower from DRAM
+// (tests/benchmark/bench_level1.cpp); only dot is routed at every size.
+inline constexpr std::size_t asm_axpy_max_bytes = 64 * 1024;
+
+} // namespace detail
+
+// dot: sum of x[i] * y[i].
+template <typename TN>
+TN dot(const TN* SENKAID_RESTRICT x, const TN* SENKAID_RESTRICT y, std::size_t n)
+{
+    if constexpr (detail::asm_level1<TN>)
+        return detail::asm_dot(x, y, n);
+    else if constexpr (detail::simd_level1<TN>)
+        return detail::dot_simd(x, y, n);
+    else
+    {
+        TN s = TN(0);
+        for (std::size_t i = 0; i < n; ++i)
+            s += x[i] * y[i];
+        return s;
+    }
+}
+
+// axpy: y[i] += a * x[i].
+template <typename TN>
+void axpy(TN a, const TN* SENKAID_RESTRICT x, TN* SENKAID_RESTRICT y, std::size_t n)
+{
+    if constexpr (detail::asm_level1<TN>)
+    {
+        if (n * sizeof(TN) <= detail::asm_axpy_max_bytes)
+            detail::asm_axpy(a, x, y, n);
+        else
+            detail::axpy_simd(a, x, y, n);
+    }
+    else if constexpr (detail::simd_level1<TN>)
+        detail::axpy_simd(a, x, y, n);
+    else
+    {
+        for (std::size_t i = 0; i < n; ++i)
+            y[i] += a * x[i];
+    }
+}
+
+// rot: Plane rotation, x[i] = c x[i] + s y[i], y[i] = c y[i] - s x[i].
+template <typename TN>
+void rot(TN* SENKAID_RESTRICT x, TN* SENKAID_RESTRICT y, std::size_t n, TN c, TN s)
+{
+    if constexpr (detail::simd_level1<TN>)
+    {
+        using P = simd::pack<TN>;
+        constexpr std::size_t L = P::lanes;
+        constexpr std::size_t step = detail::level1_unroll * L;
+        constexpr std::size_t ahead = simd::prefetch_distance<TN>;
+
+        const P vc(c), vs(s);
+
+        const auto body = [&](std::size_t k, auto io) {
+            const P xi = io.load(x + k), yi = io.load(y + k);
+            io.store(x + k, fma(vc, xi, vs * yi));
+            io.store(y + k, fnma(vs, xi, vc * yi));
+        };
+
+        std::size_t i = 0;
+        for (; i + step <= n; i += step)
+        {
+            simd::prefetch_write(x + i + ahead);
+            simd::prefetch_write(y + i + ahead);
+            for (std::size_t u = 0; u < step; u += L)
+                body(i + u, simd::full_io<P>{});
+        }
+        simd::for_each_pack<TN>(i, n, body);
+    }
+    else
+    {
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const TN xi = x[i];
+            const TN yi = y[i];
+            x[i] = c * xi + s * yi;
+            y[i] = -s * xi + c * yi;
+        }
+    }
+}
+
+// axpby: y[i] = a x[i] + b y[i].
+template <typename TN>
+void axpby(TN a, const TN* SENKAID_RESTRICT x, TN b, TN* SENKAID_RESTRICT y, std::size_t n)
+{
+    if constexpr (detail::simd_level1<TN>)
+    {
+        using P = simd::pack<TN>;
+        const P va(a), vb(b);
+        detail::level1_loop<TN>(n, [&](std::size_t k, std::size_t, auto io) {
+            io.store(y + k, fma(va, io.load(x + k), vb * io.load(y + k)));
+        }, x, y);
+    }
+    else
+    {
+        for (std::size_t i = 0; i < n; ++i)
+            y[i] = a * x[i] + b * y[i];
+    }
+}
+
+// xpby: y[i] = x[i] + b y[i] (CG's p = r + beta p).
+template <typename TN>
+void xpby(const TN* SENKAID_RESTRICT x, TN b, TN* SENKAID_RESTRICT y, std::size_t n)
+{
+    if constexpr (detail::simd_level1<TN>)
+    {
+        using P = simd::pack<TN>;
+        const P vb(b);
+        detail::level1_loop<TN>(n, [&](std::size_t k, std::size_t, auto io) {
+            io.store(y + k, fma(vb, io.load(y + k), io.load(x + k)));
+        }, x, y);
+    }
+    else
+    {
+        for (std::size_t i = 0; i < n; ++i)
+            y[i] = x[i] + b * y[i];
+    }
+}
+
+// waxpby: w[i] = a x[i] + b y[i]; w must not overlap x or y.
+template <typename TN>
+void waxpby(TN a, const TN* SENKAID_RESTRICT x, TN b, const TN* SENKAID_RESTRICT y, TN* SENKAID_RESTRICT w, std::size_t n)
+{
+    if constexpr (detail::simd_level1<TN>)
+    {
+        using P = simd::pack<TN>;
+        const P va(a), vb(b);
+        detail::level1_loop<TN>(n, [&](std::size_t k, std::size_t, auto io) {
+            io.store(w + k, fma(va, io.load(x + k), vb * io.load(y + k)));
+        }, x, y);
+    }
+    else
+    {
+        for (std::size_t i = 0; i < n; ++i)
+            w[i] = a * x[i] + b * y[i];
+    }
+}
+
+// scal_copy: y[i] = a x[i].
+template <typename TN>
+void scal_copy(TN a, const TN* SENKAID_RESTRICT x, TN* SENKAID_RESTRICT y, std::size_t n)
+{
+    if constexpr (detail::simd_level1<TN>)
+    {
+        using P = simd::pack<TN>;
+        const P va(a);
+        detail::level1_loop<TN>(n, [&](std::size_t k, std::size_t, auto io) { io.store(y + k, va * io.load(x + k)); }, x);
+    }
+    else
+    {
+        for (std::size_t i = 0; i < n; ++i)
+            y[i] = a * x[i];
+    }
+}
+
+// axpy_dot: y[i] += a x[i], returning the sum of y[i] * z[i] over the updated y. z may be y.
+template <typename TN>
+TN axpy_dot(TN a, const TN* SENKAID_RESTRICT x, TN* y, const TN* z, std::size_t n)
+{
+    if constexpr (detail::simd_level1<TN>)
+    {
+        using P = simd::pack<TN>;
+        const P va(a);
+        P s[detail::level1_unroll];
+        for (auto& v : s)
+            v = P::zero();
+
+        detail::level1_loop<TN>(n, [&](std::size_t k, std::size_t u, auto io) {
+            const P yk = fma(va, io.load(x + k), io.load(y + k));
+            io.store(y + k, yk);
+            s[u] = fma(yk, z == y ? yk : io.load(z + k), s[u]);
+        }, x, y, z);
+
+        return reduce_add((s[0] + s[1]) + (s[2] + s[3]));
+    }
+    else
+    {
+        TN s = TN(0);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            y[i] += a * x[i];
+            s += y[i] * z[i];
+        }
+        return s;
+    }
+}
+
+// axpy_dot: y[i] += a x[i], returning the squared 2-norm of the updated y (CG's r -= alpha A p;
+// rr = r . r).
+template <typename TN>
+TN axpy_dot(TN a, const TN* SENKAID_RESTRICT x, TN* y, std::size_t n)
+{
+    return axpy_dot(a, x, y, y, n);
+}
+
+} // namespace senkaid::backend::cpu
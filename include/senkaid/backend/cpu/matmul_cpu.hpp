@@ -0,0 +1,391 @@
+#pragma once
+
+// matmul_cpu.hpp: Portable blocked GEMM for the CPU backend.
+// BLAS conventions: column-major storage, leading dimensions, op(A)/op(B) selection.
+// C := alpha * op(A) * op(B) + beta * C, with op(A) m x k and op(B) k x n.
+// Operands are packed into cache-sized panels and multiplied by a register-tiled
+// micro-kernel written so the compiler vectorizes it for the target ISA.
+// An optional epilogue (bias, activation, residual, ...) runs on each MR x NR tile of C right
+// after its last update, while the tile is still in L1, instead of in extra passes over C.
+// An operand reused across many calls (a weight matrix) can be packed once with pack_panels()
+// and passed to gemm_packed(), which then only packs the other operand.
+
+#include <senkaid/utils/config/root.hpp>
+#include <senkaid/utils/debug/root.hpp>
+#include <senkaid/core/layout/layout_hash.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+namespace senkaid::backend::cpu
+{
+
+// Op: Operand transformation applied by BLAS-style kernels.
+enum class Op : std::uint8_t
+{
+    NoTrans = 0x01,
+    Trans = 0x02
+};
+
+// Side: Whether an operand multiplies from the left (A) or the right (B).
+enum class Side : std::uint8_t
+{
+    Left = 0x01,
+    Right = 0x02
+};
+
+// NoEpilogue: Leaves C as alpha * op(A) * op(B) + beta * C.
+// An epilogue is called as epilogue(c, i, j, len) on the finished entries C(i:i+len, j), c
+// pointing at C(i, j), with len <= MR; it may be called concurrently for different tiles.
+struct NoEpilogue
+{
+    template <typename TN>
+    SENKAID_FORCE_INLINE void operator()(TN*, std::size_t, std::size_t, std::size_t) const noexcept
+    {
+    }
+};
+
+// GemmPanels: A whole gemm() operand packed ahead of time by pack_panels(). Each KC-deep block
+// of op(A) (or op(B)) holds every MR-row (NR-column) sliver of the padded extent in turn, so the
+// sliver at row (column) x of the block starting at depth pc is at data + pc * extent + x * kc.
+// `first` offsets into the extent, so a column chunk of C can read its part of packed B.
+template <typename TN>
+struct GemmPanels
+{
+    const TN* data = nullptr;
+    std::size_t extent = 0;                                 // Padded to whole slivers.
+    std::size_t first = 0;
+
+    SENKAID_FORCE_INLINE const TN* at(std::size_t pc, std::size_t x, std::size_t kc) const noexcept
+    {
+        return data + pc * extent + (first + x) * kc;
+    }
+};
+
+namespace detail
+{
+
+#if defined(SENKAID_HAS_AVX512)
+    inline constexpr std::size_t gemm_vector_bytes = 64;
+#elif defined(SENKAID_HAS_AVX)
+    inline constexpr std::size_t gemm_vector_bytes = 32;
+#else
+    inline constexpr std::size_t gemm_vector_bytes = 16;
+#endif
+
+// GemmBlocking: Register tile (MR x NR) and cache blocks (MC, KC, NC) per element type.
+// MR spans two vector registers; NR is chosen so MR * NR accumulators fit the register file.
+template <typename TN>
+struct GemmBlocking
+{
+    static constexpr std::size_t MR = 2 * gemm_vector_bytes / sizeof(TN);
+    static constexpr std::size_t NR = gemm_vector_bytes == 64 ? 8 : 6;
+    static constexpr std::size_t KC = 256;
+    static constexpr std::size_t MC = MR * (gemm_vector_bytes == 64 ? 8 : 12);
+    static constexpr std::size_t NC = NR * 512;
+};
+
+template <typename TN>
+SENKAID_FORCE_INLINE TN op_at(Op op, const TN* x, std::size_t ld, std::size_t i, std::size_t j)
+{
+    return op == Op::NoTrans ? x[i + j * ld] : x[j + i * ld];
+}
+
+// pack_a: Copies op(A)(ic:ic+mc, pc:pc+kc) into MR-row slivers, k-major, zero padded.
+template <typename TN, std::size_t MR>
+void pack_a(Op op, const TN* a, std::size_t lda, std::size_t ic, std::size_t pc,
+            std::size_t mc, std::size_t kc, TN* SENKAID_RESTRICT out)
+{
+    for (std::size_t ir = 0; ir < mc; ir += MR)
+    {
+        const std::size_t mr = std::min(MR, mc - ir);
+        for (std::size_t p = 0; p < kc; ++p)
+        {
+            if (op == Op::NoTrans)
+            {
+                const TN* src = a + (ic + ir) + (pc + p) * lda;
+                for (std::size_t i = 0; i < mr; ++i)
+                    out[i] = src[i];
+            }
+            else
+            {
+                const TN* src = a + (pc + p) + (ic + ir) * lda;
+                for (std::size_t i = 0; i < mr; ++i)
+                    out[i] = src[i * lda];
+            }
+            for (std::size_t i = mr; i < MR; ++i)
+                out[i] = TN(0);
+            out += MR;
+        }
+    }
+}
+
+// pack_b: Copies op(B)(pc:pc+kc, jc:jc+nc) into NR-column slivers, k-major, zero padded.
+template <typename TN, std::size_t NR>
+void pack_b(Op op, const TN* b, std::size_t ldb, std::size_t pc, std::size_t jc,
+            std::size_t kc, std::size_t nc, TN* SENKAID_RESTRICT out)
+{
+    for (std::size_t jr = 0; jr < nc; jr += NR)
+    {
+        const std::size_t nr = std::min(NR, nc - jr);
+        for (std::size_t p = 0; p < kc; ++p)
+        {
+            for (std::size_t j = 0; j < nr; ++j)
+                out[j] = op_at(op, b, ldb, pc + p, jc + jr + j);
+            for (std::size_t j = nr; j < NR; ++j)
+                out[j] = TN(0);
+            out += NR;
+        }
+    }
+}
+
+// gemm_micro: c(0:mr, 0:nr) += alpha * Apanel * Bpanel over kc steps.
+// GCC/Clang get explicit vector-extension accumulators: relying on the auto-vectorizer here is
+// fragile (it fully unrolls the MR loop into scalars for double before vectorizing).
+template <typename TN, std::size_t MR, std::size_t NR>
+SENKAID_FORCE_INLINE void gemm_micro(std::size_t kc, const TN* SENKAID_RESTRICT a, const TN* SENKAID_RESTRICT b,
+                                     TN alpha, TN* c, std::size_t ldc, std::size_t mr, std::size_t nr)
+{
+#if defined(SENKAID_COMPILER_GCC) || defined(SENKAID_COMPILER_CLANG)
+    constexpr std::size_t W = gemm_vector_bytes / sizeof(TN);
+    constexpr std::size_t MV = MR / W;
+    typedef TN vec_t __attribute__((vector_size(gemm_vector_bytes), aligned(sizeof(TN))));
+
+    vec_t acc[NR][MV] = {};
+
+    for (std::size_t p = 0; p < kc; ++p)
+    {
+        vec_t av[MV];
+        for (std::size_t v = 0; v < MV; ++v)
+            std::memcpy(&av[v], a + v * W, gemm_vector_bytes);
+
+        for (std::size_t j = 0; j < NR; ++j)
+        {
+            const TN bj = b[j];
+            for (std::size_t v = 0; v < MV; ++v)
+                acc[j][v] += av[v] * bj;
+        }
+        a += MR;
+        b += NR;
+    }
+
+    auto at = [&acc](std::size_t i, std::size_t j) { return acc[j][i / W][i % W]; };
+#else
+    TN acc[NR][MR] = {};
+
+    for (std::size_t p = 0; p < kc; ++p)
+    {
+        for (std::size_t j = 0; j < NR; ++j)
+        {
+            const TN bj = b[j];
+            for (std::size_t i = 0; i < MR; ++i)
+                acc[j][i] += a[i] * bj;
+        }
+        a += MR;
+        b += NR;
+    }
+
+    auto at = [&acc](std::size_t i, std::size_t j) { return acc[j][i]; };
+#endif
+
+    if (mr == MR && nr == NR)
+    {
+        for (std::size_t j = 0; j < NR; ++j)
+            for (std::size_t i = 0; i < MR; ++i)
+                c[i + j * ldc] += alpha * at(i, j);
+    }
+    else
+    {
+        for (std::size_t j = 0; j < nr; ++j)
+            for (std::size_t i = 0; i < mr; ++i)
+                c[i + j * ldc] += alpha * at(i, j);
+    }
+}
+
+template <typename TN>
+void scale_c(std::size_t m, std::size_t n, TN beta, TN* c, std::size_t ldc)
+{
+    if (beta == TN(1))
+        return;
+
+    for (std::size_t j = 0; j < n; ++j)
+    {
+        TN* col = c + j * ldc;
+        if (beta == TN(0))
+            std::fill(col, col + m, TN(0));
+        else
+            for (std::size_t i = 0; i < m; ++i)
+                col[i] *= beta;
+    }
+}
+
+// finish_tile: Runs the epilogue over the mr x nr tile of C at (i, j).
+template <typename TN, typename Epilogue>
+SENKAID_FORCE_INLINE void finish_tile(const Epilogue& epilogue, TN* c, std::size_t ldc, std::size_t i, std::size_t j,
+                                      std::size_t mr, std::size_t nr)
+{
+    for (std::size_t jj = 0; jj < nr; ++jj)
+        epilogue(c + jj * ldc, i, j + jj, mr);
+}
+
+// gemm_driver: gemm() with either operand optionally pre-packed (ap, bp non-null); a packed
+// operand's pointer and leading dimension are not read.
+template <typename TN, typename Epilogue>
+void gemm_driver(Op opa, Op opb, std::size_t m, std::size_t n, std::size_t k, TN alpha, const TN* a, std::size_t lda,
+                 const GemmPanels<TN>* ap, const TN* b, std::size_t ldb, const GemmPanels<TN>* bp, TN beta, TN* c,
+                 std::size_t ldc, const Epilogue& epilogue)
+{
+    using Blocking = GemmBlocking<TN>;
+    constexpr std::size_t MR = Blocking::MR;
+    constexpr std::size_t NR = Blocking::NR;
+    constexpr bool finish = !std::is_same_v<Epilogue, NoEpilogue>;
+
+    if (m == 0 || n == 0)
+        return;
+
+    scale_c(m, n, beta, c, ldc);
+
+    if (k == 0 || alpha == TN(0))
+    {
+        if constexpr (finish)
+            for (std::size_t i = 0; i < m; i += MR)
+                finish_tile(epilogue, c + i, ldc, i, 0, std::min(MR, m - i), n);
+        return;
+    }
+
+    static thread_local std::vector<TN> a_pack;
+    static thread_local std::vector<TN> b_pack;
+
+    const std::size_t kc_max = std::min(k, Blocking::KC);
+    if (ap == nullptr)
+        a_pack.resize(std::min((m + MR - 1) / MR * MR, Blocking::MC) * kc_max);
+    if (bp == nullptr)
+        b_pack.resize(std::min((n + NR - 1) / NR * NR, Blocking::NC) * kc_max);
+
+    for (std::size_t jc = 0; jc < n; jc += Blocking::NC)
+    {
+        const std::size_t nc = std::min(Blocking::NC, n - jc);
+
+        for (std::size_t pc = 0; pc < k; pc += Blocking::KC)
+        {
+            const std::size_t kc = std::min(Blocking::KC, k - pc);
+            const bool last = pc + kc == k;
+            const TN* bpanel = b_pack.data();
+            if (bp != nullptr)
+                bpanel = bp->at(pc, jc, kc);
+            else
+                pack_b<TN, NR>(opb, b, ldb, pc, jc, kc, nc, b_pack.data());
+
+            for (std::size_t ic = 0; ic < m; ic += Blocking::MC)
+            {
+                const std::size_t mc = std::min(Blocking::MC, m - ic);
+                const TN* apanel = a_pack.data();
+                if (ap != nullptr)
+                    apanel = ap->at(pc, ic, kc);
+                else
+                    pack_a<TN, MR>(opa, a, lda, ic, pc, mc, kc, a_pack.data());
+
+                for (std::size_t jr = 0; jr < nc; jr += NR)
+                {
+                    const std::size_t nr = std::min(NR, nc - jr);
+
+                    for (std::size_t ir = 0; ir < mc; ir += MR)
+                    {
+                        const std::size_t mr = std::min(MR, mc - ir);
+                        TN* ct = c + (ic + ir) + (jc + jr) * ldc;
+                        gemm_micro<TN, MR, NR>(kc, apanel + ir * kc, bpanel + jr * kc, alpha, ct, ldc, mr, nr);
+                        if constexpr (finish)
+                            if (last)
+                                finish_tile(epilogue, ct, ldc, ic + ir, jc + jr, mr, nr);
+                    }
+                }
+            }
+        }
+    }
+}
+
+} // namespace detail
+
+// gemm: General matrix-matrix product, column-major.
+// Parameters:
+//   opa, opb - Transformations applied to A and B.
+//   m, n, k  - op(A) is m x k, op(B) is k x n, C is m x n.
+//   alpha    - Scale applied to op(A) * op(B).
+//   a, lda   - Matrix A and its leading dimension.
+//   b, ldb   - Matrix B and its leading dimension.
+//   beta     - Scale applied to C before accumulation. beta == 0 ignores C's contents (NaNs included).
+//   c, ldc   - Output matrix C and its leading dimension.
+//   epilogue - Applied once to every entry of C after the product (see NoEpilogue).
+// Single-threaded; callers parallelize over independent output blocks.
+template <typename TN, typename Epilogue = NoEpilogue>
+void gemm(Op opa, Op opb, std::size_t m, std::size_t n, std::size_t k,
+          TN alpha, const TN* a, std::size_t lda, const TN* b, std::size_t ldb,
+          TN beta, TN* c, std::size_t ldc, const Epilogue& epilogue = Epilogue{})
+{
+    detail::gemm_driver(opa, opb, m, n, k, alpha, a, lda, static_cast<const GemmPanels<TN>*>(nullptr), b, ldb,
+                        static_cast<const GemmPanels<TN>*>(nullptr), beta, c, ldc, epilogue);
+}
+
+// gemm_kernel_key: Identifies the packed panel format of gemm() for TN in this build (register
+// tile, cache blocks, vector width). Panels packed under another key do not fit the kernel.
+template <typename TN>
+constexpr std::uint64_t gemm_kernel_key() noexcept
+{
+    using Blocking = detail::GemmBlocking<TN>;
+    std::uint64_t h = core::layout::hash_mix(0, core::layout::element_tag<TN>());
+    h = core::layout::hash_mix(h, Blocking::MR);
+    h = core::layout::hash_mix(h, Blocking::NR);
+    h = core::layout::hash_mix(h, Blocking::KC);
+    h = core::layout::hash_mix(h, Blocking::MC);
+    h = core::layout::hash_mix(h, Blocking::NC);
+    return core::layout::hash_mix(h, detail::gemm_vector_bytes);
+}
+
+// panels_size: Elements needed by pack_panels() for an operand of `extent` rows of op(A) (Side::Left)
+// or columns of op(B) (Side::Right) and depth k.
+template <typename TN>
+constexpr std::size_t panels_size(Side side, std::size_t extent, std::size_t k) noexcept
+{
+    using Blocking = detail::GemmBlocking<TN>;
+    const std::size_t tile = side == Side::Left ? Blocking::MR : Blocking::NR;
+    return (extent + tile - 1) / tile * tile * k;
+}
+
+// pack_panels: Packs the whole of op(A) (Side::Left, extent x k) or op(B) (Side::Right, k x extent)
+// into `out` (panels_size() elements) in the layout gemm_packed() reads.
+template <typename TN>
+void pack_panels(Side side, Op op, std::size_t extent, std::size_t k, const TN* x, std::size_t ldx, TN* SENKAID_RESTRICT out)
+{
+    using Blocking = detail::GemmBlocking<TN>;
+    const std::size_t padded = panels_size<TN>(side, extent, 1);
+
+    for (std::size_t pc = 0; pc < k; pc += Blocking::KC)
+    {
+        const std::size_t kc = std::min(Blocking::KC, k - pc);
+        if (side == Side::Left)
+            detail::pack_a<TN, Blocking::MR>(op, x, ldx, 0, pc, extent, kc, out + pc * padded);
+        else
+            detail::pack_b<TN, Blocking::NR>(op, x, ldx, pc, 0, kc, extent, out + pc * padded);
+    }
+}
+
+// gemm_packed: gemm() with one operand taken from panels packed by pack_panels(): A if `side` is
+// Side::Left (x, ldx, opx are then B), B if Side::Right (x, ldx, opx are A). The panels must come
+// from an operand of the same m x k or k x n shape, packed under the same gemm_kernel_key().
+template <typename TN, typename Epilogue = NoEpilogue>
+void gemm_packed(Side side, Op opx, std::size_t m, std::size_t n, std::size_t k, TN alpha, const GemmPanels<TN>& packed,
+                 const TN* x, std::size_t ldx, TN beta, TN* c, std::size_t ldc, const Epilogue& epilogue = Epilogue{})
+{
+    if (side == Side::Left)
+        detail::gemm_driver(Op::NoTrans, opx, m, n, k, alpha, static_cast<const TN*>(nullptr), 0, &packed, x, ldx,
+                            static_cast<const GemmPanels<TN>*>(nullptr), beta, c, ldc, epilogue);
+    else
+        detail::gemm_driver(opx, Op::NoTrans, m, n, k, alpha, x, ldx, static_cast<const GemmPanels<TN>*>(nullptr),
+                            static_cast<const TN*>(nullptr), 0, &packed, beta, c, ldc, epilogue);
+}
+
+} // namespace senkaid::backend::cpu
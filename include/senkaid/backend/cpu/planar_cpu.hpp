@@ -0,0 +1,389 @@
+#pragma once
+
+// planar_cpu.hpp: Complex kernels on split (planar) storage.
+// Every operand is a pair of real arrays (re, im) of the same shape, as held by SDPlanarMatrix.
+// A complex product on planar data is four real products on whole vectors, so the element-wise
+// kernels below use only the real pack arithmetic of backend/simd and no lane shuffles.
+//
+// gemm() reduces a complex product to real GEMMs (matmul_cpu.hpp) on the planes:
+//   4M: Re = Ar Br - Ai Bi, Im = Ar Bi + Ai Br                      (4 real GEMMs)
+//   3M: T1 = Ar Br, T2 = Ai Bi, T3 = (Ar + Ai)(Br + Bi),
+//       Re = T1 - T2, Im = T3 - T1 - T2                              (3 real GEMMs)
+// 3M saves a quarter of the multiplies at the cost of O(mk + kn + mn) extra additions, three
+// m x n temporaries, and a weaker error bound on the imaginary part (T3 - T1 - T2 cancels when
+// |Im| is small against |A||B|). Auto picks 3M only for large products; pass FourM when the
+// imaginary part must be accurate to the usual GEMM bound.
+
+#include <senkaid/utils/config/root.hpp>
+#include <senkaid/utils/debug/root.hpp>
+#include <senkaid/core/complex/complex.hpp>
+#include <senkaid/core/matrix/planar.hpp>
+#include <senkaid/backend/simd/simd_complex.hpp>
+#include <senkaid/backend/simd/simd_load_store.hpp>
+#include <senkaid/backend/parallel/parallel_for.hpp>
+#include "matmul_cpu.hpp"
+#include "transform_cpu.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace senkaid::backend::cpu::planar
+{
+
+using core::complex::complex;
+
+// GemmMethod: Real-GEMM decomposition used by gemm().
+enum class GemmMethod : std::uint8_t
+{
+    Auto = 0x00,
+    FourM = 0x01,
+    ThreeM = 0x02
+};
+
+// three_m_threshold: Auto uses 3M once m, n and k all reach this size. Below it the extra
+// additions and temporaries eat most of the saved multiplies.
+inline constexpr std::size_t three_m_threshold = 256;
+
+namespace detail
+{
+
+// for_each_pack_parallel: simd::for_each_pack split across the pool for large n.
+template <typename TN, typename Body>
+void for_each_pack_parallel(std::size_t n, Body&& body)
+{
+    if (n == 0)
+        return;
+
+    parallel::parallel_for(0, n, transform_grain, [&](std::size_t lo, std::size_t hi) {
+        simd::for_each_pack<TN>(lo, hi, body);
+    });
+}
+
+// combine: C := alpha * P + beta * C on column-major m x n planes; beta == 0 ignores C's contents.
+template <typename TN>
+void combine(std::size_t m, std::size_t n, complex<TN> alpha, const TN* pr, const TN* pi, std::size_t ldp,
+             complex<TN> beta, TN* cr, TN* ci, std::size_t ldc)
+{
+    using P = simd::pack<TN>;
+
+    const P ar(alpha._re), ai(alpha._im), br(beta._re), bi(beta._im);
+    const bool keep = !(beta._re == TN(0) && beta._im == TN(0));
+
+    for (std::size_t j = 0; j < n; ++j)
+    {
+        const TN* xr = pr + j * ldp;
+        const TN* xi = pi + j * ldp;
+        TN* yr = cr + j * ldc;
+        TN* yi = ci + j * ldc;
+
+        simd::for_each_pack<TN>(0, m, [&](std::size_t i, auto io) {
+            const P vr = io.load(xr + i), vi = io.load(xi + i);
+            P outr = fnma(ai, vi, ar * vr);
+            P outi = fma(ai, vr, ar * vi);
+            if (keep)
+            {
+                const P wr = io.load(yr + i), wi = io.load(yi + i);
+                outr = fnma(bi, wi, fma(br, wr, outr));
+                outi = fma(bi, wr, fma(br, wi, outi));
+            }
+            io.store(yr + i, outr);
+            io.store(yi + i, outi);
+        });
+    }
+}
+
+// add_planes: s := x + y on column-major rows x cols planes (used for the 3M operand sums).
+template <typename TN>
+void add_planes(std::size_t rows, std::size_t cols, const TN* x, const TN* y, std::size_t ld, TN* s)
+{
+    for (std::size_t j = 0; j < cols; ++j)
+        simd::for_each_pack<TN>(0, rows, [&](std::size_t i, auto io) {
+            io.store(s + i + j * rows, io.load(x + i + j * ld) + io.load(y + i + j * ld));
+        });
+}
+
+// dot4: The four real dot products of two planar vectors.
+template <typename TN>
+void dot4(const TN* ar, const TN* ai, const TN* br, const TN* bi, std::size_t n,
+          TN& rr, TN& ii, TN& ri, TN& ir)
+{
+    using P = simd::pack<TN>;
+
+    P srr = P::zero(), sii = P::zero(), sri = P::zero(), sir = P::zero();
+    simd::for_each_pack<TN>(0, n, [&](std::size_t i, auto io) {
+        const P xr = io.load(ar + i), xi = io.load(ai + i);
+        const P yr = io.load(br + i), yi = io.load(bi + i);
+        srr = fma(xr, yr, srr);
+        sii = fma(xi, yi, sii);
+        sri = fma(xr, yi, sri);
+        sir = fma(xi, yr, sir);
+    });
+
+    rr = reduce_add(srr);
+    ii = reduce_add(sii);
+    ri = reduce_add(sri);
+    ir = reduce_add(sir);
+}
+
+} // namespace detail
+
+// mul: c = a * b element-wise; c may alias a or b.
+template <typename TN>
+void mul(const TN* ar, const TN* ai, const TN* br, const TN* bi, TN* cr, TN* ci, std::size_t n)
+{
+    using P = simd::pack<TN>;
+
+    detail::for_each_pack_parallel<TN>(n, [=](std::size_t i, auto io) {
+        const P xr = io.load(ar + i), xi = io.load(ai + i);
+        const P yr = io.load(br + i), yi = io.load(bi + i);
+        io.store(cr + i, fnma(xi, yi, xr * yr));
+        io.store(ci + i, fma(xi, yr, xr * yi));
+    });
+}
+
+// mul_conj: c = conj(a) * b element-wise; c may alias a or b.
+template <typename TN>
+void mul_conj(const TN* ar, const TN* ai, const TN* br, const TN* bi, TN* cr, TN* ci, std::size_t n)
+{
+    using P = simd::pack<TN>;
+
+    detail::for_each_pack_parallel<TN>(n, [=](std::size_t i, auto io) {
+        const P xr = io.load(ar + i), xi = io.load(ai + i);
+        const P yr = io.load(br + i), yi = io.load(bi + i);
+        io.store(cr + i, fma(xi, yi, xr * yr));
+        io.store(ci + i, fnma(xi, yr, xr * yi));
+    });
+}
+
+// axpy: y += alpha * x.
+template <typename TN>
+void axpy(complex<TN> alpha, const TN* xr, const TN* xi, TN* yr, TN* yi, std::size_t n)
+{
+    using P = simd::pack<TN>;
+
+    const P ar(alpha._re), ai(alpha._im);
+    detail::for_each_pack_parallel<TN>(n, [=](std::size_t i, auto io) {
+        const P vr = io.load(xr + i), vi = io.load(xi + i);
+        io.store(yr + i, fnma(ai, vi, fma(ar, vr, io.load(yr + i))));
+        io.store(yi + i, fma(ai, vr, fma(ar, vi, io.load(yi + i))));
+    });
+}
+
+// abs: out = |x| element-wise.
+template <typename TN>
+void abs(const TN* xr, const TN* xi, TN* out, std::size_t n)
+{
+    detail::for_each_pack_parallel<TN>(n, [=](std::size_t i, auto io) {
+        io.store(out + i, simd::hypot(io.load(xr + i), io.load(xi + i)));
+    });
+}
+
+// dotu / dotc: sum of a[i] * b[i] and of conj(a[i]) * b[i].
+template <typename TN>
+complex<TN> dotu(const TN* ar, const TN* ai, const TN* br, const TN* bi, std::size_t n)
+{
+    TN rr, ii, ri, ir;
+    detail::dot4(ar, ai, br, bi, n, rr, ii, ri, ir);
+    return { rr - ii, ri + ir };
+}
+
+template <typename TN>
+complex<TN> dotc(const TN* ar, const TN* ai, const TN* br, const TN* bi, std::size_t n)
+{
+    TN rr, ii, ri, ir;
+    detail::dot4(ar, ai, br, bi, n, rr, ii, ri, ir);
+    return { rr + ii, ri - ir };
+}
+
+// gemv: y := alpha * op(A) * x + beta * y, A column-major m x n.
+// Parameters:
+//   op       - NoTrans (y has m elements) or Trans (y has n elements).
+//   ar, ai   - Planes of A, leading dimension lda.
+//   xr, xi   - Planes of x.
+//   yr, yi   - Planes of y. beta == 0 ignores y's contents.
+template <typename TN>
+void gemv(Op op, std::size_t m, std::size_t n, complex<TN> alpha, const TN* ar, const TN* ai, std::size_t lda,
+          const TN* xr, const TN* xi, complex<TN> beta, TN* yr, TN* yi)
+{
+    using P = simd::pack<TN>;
+
+    const std::size_t len = op == Op::NoTrans ? m : n;
+    if (len == 0)
+        return;
+
+    static thread_local std::vector<TN> t;
+    t.assign(2 * len, TN(0));
+    TN* tr = t.data();
+    TN* ti = t.data() + len;
+
+    if (op == Op::NoTrans)
+    {
+        // Column sweeps: t += A(:, j) * x[j] as real axpys on both planes.
+        for (std::size_t j = 0; j < n; ++j)
+        {
+            const P sr(xr[j]), si(xi[j]);
+            const TN* cr = ar + j * lda;
+            const TN* cim = ai + j * lda;
+
+            simd::for_each_pack<TN>(0, m, [&](std::size_t i, auto io) {
+                const P vr = io.load(cr + i), vi = io.load(cim + i);
+                io.store(tr + i, fnma(vi, si, fma(vr, sr, io.load(tr + i))));
+                io.store(ti + i, fma(vi, sr, fma(vr, si, io.load(ti + i))));
+            });
+        }
+    }
+    else
+    {
+        for (std::size_t j = 0; j < n; ++j)
+        {
+            TN rr, ii, ri, ir;
+            detail::dot4(ar + j * lda, ai + j * lda, xr, xi, m, rr, ii, ri, ir);
+            tr[j] = rr - ii;
+            ti[j] = ri + ir;
+        }
+    }
+
+    detail::combine(len, 1, alpha, tr, ti, len, beta, yr, yi, len);
+}
+
+// gemm: C := alpha * op(A) * op(B) + beta * C on planar, column-major operands.
+// Parameters mirror the real gemm() in matmul_cpu.hpp, with one leading dimension per operand
+// shared by both of its planes. beta == 0 ignores C's contents. Single-threaded, like gemm().
+template <typename TN>
+void gemm(Op opa, Op opb, std::size_t m, std::size_t n, std::size_t k,
+          complex<TN> alpha, const TN* ar, const TN* ai, std::size_t lda,
+          const TN* br, const TN* bi, std::size_t ldb,
+          complex<TN> beta, TN* cr, TN* ci, std::size_t ldc, GemmMethod method = GemmMethod::Auto)
+{
+    if (m == 0 || n == 0)
+        return;
+
+    if (method == GemmMethod::Auto)
+        method = m >= three_m_threshold && n >= three_m_threshold && k >= three_m_threshold ? GemmMethod::ThreeM
+                                                                                            : GemmMethod::FourM;
+
+    const bool real_scalars = alpha._im == TN(0) && beta._im == TN(0);
+
+    if (k == 0 || (alpha._re == TN(0) && alpha._im == TN(0)))
+    {
+        static thread_local std::vector<TN> zero;
+        zero.assign(m, TN(0));
+        detail::combine(m, n, complex<TN>(), zero.data(), zero.data(), 0, beta, cr, ci, ldc);
+        return;
+    }
+
+    if (method == GemmMethod::FourM && real_scalars)
+    {
+        // Real alpha and beta scale the four products directly into C.
+        const TN a = alpha._re, b = beta._re;
+        cpu::gemm(opa, opb, m, n, k, a, ar, lda, br, ldb, b, cr, ldc);
+        cpu::gemm(opa, opb, m, n, k, -a, ai, lda, bi, ldb, TN(1), cr, ldc);
+        cpu::gemm(opa, opb, m, n, k, a, ar, lda, bi, ldb, b, ci, ldc);
+        cpu::gemm(opa, opb, m, n, k, a, ai, lda, br, ldb, TN(1), ci, ldc);
+        return;
+    }
+
+    static thread_local std::vector<TN> work;
+
+    if (method == GemmMethod::FourM)
+    {
+        work.resize(2 * m * n);
+        TN* pr = work.data();
+        TN* pi = work.data() + m * n;
+
+        cpu::gemm(opa, opb, m, n, k, TN(1), ar, lda, br, ldb, TN(0), pr, m);
+        cpu::gemm(opa, opb, m, n, k, TN(-1), ai, lda, bi, ldb, TN(1), pr, m);
+        cpu::gemm(opa, opb, m, n, k, TN(1), ar, lda, bi, ldb, TN(0), pi, m);
+        cpu::gemm(opa, opb, m, n, k, TN(1), ai, lda, br, ldb, TN(1), pi, m);
+        detail::combine(m, n, alpha, pr, pi, m, beta, cr, ci, ldc);
+        return;
+    }
+
+    // 3M. The operand sums keep A's and B's stored orientation, so op() still applies to them.
+    const std::size_t a_rows = opa == Op::NoTrans ? m : k, a_cols = opa == Op::NoTrans ? k : m;
+    const std::size_t b_rows = opb == Op::NoTrans ? k : n, b_cols = opb == Op::NoTrans ? n : k;
+
+    work.resize(3 * m * n + a_rows * a_cols + b_rows * b_cols);
+    TN* t1 = work.data();
+    TN* t2 = t1 + m * n;
+    TN* t3 = t2 + m * n;
+    TN* as = t3 + m * n;
+    TN* bs = as + a_rows * a_cols;
+
+    detail::add_planes(a_rows, a_cols, ar, ai, lda, as);
+    detail::add_planes(b_rows, b_cols, br, bi, ldb, bs);
+
+    cpu::gemm(opa, opb, m, n, k, TN(1), ar, lda, br, ldb, TN(0), t1, m);
+    cpu::gemm(opa, opb, m, n, k, TN(1), ai, lda, bi, ldb, TN(0), t2, m);
+    cpu::gemm(opa, opb, m, n, k, TN(1), as, a_rows, bs, b_rows, TN(0), t3, m);
+
+    // t1 := T1 - T2 (real part), t3 := T3 - T1 - T2 (imaginary part).
+    using P = simd::pack<TN>;
+    simd::for_each_pack<TN>(0, m * n, [&](std::size_t i, auto io) {
+        const P v1 = io.load(t1 + i), v2 = io.load(t2 + i);
+        io.store(t3 + i, io.load(t3 + i) - (v1 + v2));
+        io.store(t1 + i, v1 - v2);
+    });
+
+    detail::combine(m, n, alpha, t1, t3, m, beta, cr, ci, ldc);
+}
+
+// Matrix-level entry points. Row-major operands are handled as their column-major transposes:
+// C = A B is C^T = B^T A^T on the same buffers.
+
+// gemm: C := alpha * A * B + beta * C; beta == 0 ignores C's contents.
+template <int M, int N, int K, typename TN, core::matrix::SDMajor Major>
+void gemm(complex<TN> alpha, const core::matrix::SDPlanarMatrix<M, K, TN, Major>& a,
+          const core::matrix::SDPlanarMatrix<K, N, TN, Major>& b, complex<TN> beta,
+          core::matrix::SDPlanarMatrix<M, N, TN, Major>& c, GemmMethod method = GemmMethod::Auto)
+{
+    if (SENKAID_UNLIKELY(a.cols() != b.rows() || c.rows() != a.rows() || c.cols() != b.cols()))
+    {
+        SENKAID_LOG_ERROR("planar::gemm: shapes do not match");
+        return;
+    }
+
+    if constexpr (Major == core::matrix::SDMajor::ColumnMajor)
+        gemm(Op::NoTrans, Op::NoTrans, a.rows(), b.cols(), a.cols(), alpha, a.real(), a.imag(), a.ld(),
+             b.real(), b.imag(), b.ld(), beta, c.real(), c.imag(), c.ld(), method);
+    else
+        gemm(Op::NoTrans, Op::NoTrans, b.cols(), a.rows(), a.cols(), alpha, b.real(), b.imag(), b.ld(),
+             a.real(), a.imag(), a.ld(), beta, c.real(), c.imag(), c.ld(), method);
+}
+
+// matmul: A * B as a new planar matrix.
+template <int M, int N, int K, typename TN, core::matrix::SDMajor Major>
+core::matrix::SDPlanarMatrix<M, N, TN, Major> matmul(const core::matrix::SDPlanarMatrix<M, K, TN, Major>& a,
+                                                     const core::matrix::SDPlanarMatrix<K, N, TN, Major>& b,
+                                                     GemmMethod method = GemmMethod::Auto)
+{
+    core::matrix::SDPlanarMatrix<M, N, TN, Major> c(a.rows(), b.cols());
+    gemm(complex<TN>(1), a, b, complex<TN>(), c, method);
+    return c;
+}
+
+// matvec: y := alpha * A * x + beta * y for planar vectors x (A.cols()) and y (A.rows()).
+template <int M, int N, typename TN, core::matrix::SDMajor Major>
+void matvec(complex<TN> alpha, const core::matrix::SDPlanarMatrix<M, N, TN, Major>& a,
+            const TN* xr, const TN* xi, complex<TN> beta, TN* yr, TN* yi)
+{
+    if constexpr (Major == core::matrix::SDMajor::ColumnMajor)
+        gemv(Op::NoTrans, a.rows(), a.cols(), alpha, a.real(), a.imag(), a.ld(), xr, xi, beta, yr, yi);
+    else
+        gemv(Op::Trans, a.cols(), a.rows(), alpha, a.real(), a.imag(), a.ld(), xr, xi, beta, yr, yi);
+}
+
+// mul: Element-wise product of two planar matrices of the same shape.
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+core::matrix::SDPlanarMatrix<Rows, Cols, TN, Major> mul(const core::matrix::SDPlanarMatrix<Rows, Cols, TN, Major>& a,
+                                                        const core::matrix::SDPlanarMatrix<Rows, Cols, TN, Major>& b)
+{
+    SENKAID_ASSERT(a.rows() == b.rows() && a.cols() == b.cols(), "planar::mul: shapes do not match");
+
+    core::matrix::SDPlanarMatrix<Rows, Cols, TN, Major> c(a.rows(), a.cols());
+    mul(a.real(), a.imag(), b.real(), b.imag(), c.real(), c.imag(), a.size());
+    return c;
+}
+
+} // namespace senkaid::backend::cpu::planar
@@ -0,0 +1,201 @@
+#pragma once
+
+// reduce_cpu.hpp: Whole-buffer reductions (sums, min, max, norms, moments) across the thread pool.
+// The buffer is cut into fixed blocks of reduce_grain elements whatever the pool size, each block
+// is reduced by the single-threaded kernels of backend/simd/simd_reduction.hpp, and the block
+// results are merged in block order (sums through sum_parts, keeping their error terms). The
+// result therefore does not depend on the number of threads or on scheduling.
+//
+//   double s = backend::cpu::sum<backend::simd::summation::Compensated>(x, n);
+//   double r = backend::cpu::norm(x, n, 2.0);
+
+#include <senkaid/utils/config/root.hpp>
+#include <senkaid/backend/simd/simd_reduction.hpp>
+#include <senkaid/backend/parallel/parallel_for.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace senkaid::backend::cpu
+{
+
+// reduce_grain: Elements per block; one block streams through in tens of microseconds.
+inline constexpr std::size_t reduce_grain = 256 * 1024;
+
+namespace detail
+{
+
+// reduce_blocks: kernel(p, m) on every reduce_grain block of x[0, n), folded with merge(acc, r)
+// in block order. Buffers of one block skip the pool and the partials vector.
+template <typename TN, typename Kernel, typename Merge>
+auto reduce_blocks(const TN* x, std::size_t n, Kernel kernel, Merge merge)
+{
+    const std::size_t blocks = (n + reduce_grain - 1) / reduce_grain;
+    if (blocks <= 1)
+        return kernel(x, n);
+
+    using R = decltype(kernel(x, n));
+    std::vector<R> partial(blocks);
+    parallel::parallel_for(0, blocks, 1, [&](std::size_t b0, std::size_t b1) {
+        for (std::size_t b = b0; b < b1; ++b)
+        {
+            const std::size_t lo = b * reduce_grain;
+            partial[b] = kernel(x + lo, std::min(reduce_grain, n - lo));
+        }
+    });
+
+    R acc = partial[0];
+    for (std::size_t b = 1; b < blocks; ++b)
+        merge(acc, partial[b]);
+    return acc;
+}
+
+// unordered: r is NaN; a NaN accumulator never compares below or above r, so it sticks.
+template <typename TN>
+SENKAID_FORCE_INLINE bool unordered(TN r) noexcept
+{
+    if constexpr (std::is_floating_point_v<TN>)
+        return r != r;
+    else
+        return false;
+}
+
+} // namespace detail
+
+// sum: x[0] + ... + x[n - 1]; see simd_reduction.hpp for the accuracy of each summation.
+template <simd::summation S = simd::summation::Blocked, typename TN>
+TN sum(const TN* x, std::size_t n)
+{
+    return detail::reduce_blocks(
+               x, n, [](const TN* p, std::size_t m) { return simd::sum_partial<S>(p, m); },
+               [](simd::sum_parts<TN>& acc, const simd::sum_parts<TN>& r) { acc.merge(r); })
+        .value();
+}
+
+// sum_sq: x[0]^2 + ... + x[n - 1]^2.
+template <simd::summation S = simd::summation::Blocked, typename TN>
+TN sum_sq(const TN* x, std::size_t n)
+{
+    return detail::reduce_blocks(
+               x, n, [](const TN* p, std::size_t m) { return simd::sum_sq_partial<S>(p, m); },
+               [](simd::sum_parts<TN>& acc, const simd::sum_parts<TN>& r) { acc.merge(r); })
+        .value();
+}
+
+// min / max: Smallest / largest element; NaN if any element is NaN, the identity if n == 0.
+template <typename TN>
+TN min(const TN* x, std::size_t n)
+{
+    return detail::reduce_blocks(
+        x, n, [](const TN* p, std::size_t m) { return simd::reduce_min(p, m); },
+        [](TN& acc, TN r) { acc = detail::unordered(r) || r < acc ? r : acc; });
+}
+
+template <typename TN>
+TN max(const TN* x, std::size_t n)
+{
+    return detail::reduce_blocks(
+        x, n, [](const TN* p, std::size_t m) { return simd::reduce_max(p, m); },
+        [](TN& acc, TN r) { acc = detail::unordered(r) || acc < r ? r : acc; });
+}
+
+// argmin / argmax: Smallest / largest element and its first position (the first NaN if any);
+// index npos if n == 0. Blocks merge in order, a later block only winning strictly.
+template <typename TN>
+simd::extremum_at<TN> argmin(const TN* x, std::size_t n)
+{
+    return detail::reduce_blocks(
+        x, n,
+        [x](const TN* p, std::size_t m) {
+            auto r = simd::reduce_argmin(p, m);
+            r.index += static_cast<std::size_t>(p - x);
+            return r;
+        },
+        [](simd::extremum_at<TN>& acc, const simd::extremum_at<TN>& r) { simd::detail::arg_take<false>(acc, r); });
+}
+
+template <typename TN>
+simd::extremum_at<TN> argmax(const TN* x, std::size_t n)
+{
+    return detail::reduce_blocks(
+        x, n,
+        [x](const TN* p, std::size_t m) {
+            auto r = simd::reduce_argmax(p, m);
+            r.index += static_cast<std::size_t>(p - x);
+            return r;
+        },
+        [](simd::extremum_at<TN>& acc, const simd::extremum_at<TN>& r) { simd::detail::arg_take<true>(acc, r); });
+}
+
+// asum: |x[0]| + ... + |x[n - 1]|.
+template <typename TN>
+TN asum(const TN* x, std::size_t n)
+{
+    return detail::reduce_blocks(
+               x, n, [](const TN* p, std::size_t m) { return simd::abs_sum_partial(p, m); },
+               [](simd::sum_parts<TN>& acc, const simd::sum_parts<TN>& r) { acc.merge(r); })
+        .value();
+}
+
+// amax: max |x[i]|; NaN if any element is NaN, 0 if n == 0.
+template <typename TN>
+TN amax(const TN* x, std::size_t n)
+{
+    return detail::reduce_blocks(
+        x, n, [](const TN* p, std::size_t m) { return simd::reduce_max_abs(p, m); },
+        [](TN& acc, TN r) { acc = detail::unordered(r) || acc < r ? r : acc; });
+}
+
+// nrm2: Euclidean norm, one pass, no intermediate overflow or underflow (Blue's algorithm).
+template <typename TN>
+TN nrm2(const TN* x, std::size_t n)
+{
+    return detail::reduce_blocks(
+               x, n, [](const TN* p, std::size_t m) { return simd::nrm2_partial(p, m); },
+               [](simd::nrm2_parts<TN>& acc, const simd::nrm2_parts<TN>& r) { acc.merge(r); })
+        .value();
+}
+
+// moments: Count, mean and m2 of x[0, n) in one pass (simd::moment_parts; integers in double),
+// blocks merged with Chan's update.
+template <typename TN>
+simd::moment_parts<simd::moment_value_t<TN>> moments(const TN* x, std::size_t n)
+{
+    using R = simd::moment_parts<simd::moment_value_t<TN>>;
+    return detail::reduce_blocks(
+        x, n, [](const TN* p, std::size_t m) { return simd::moments_partial(p, m); }, [](R& acc, const R& r) { acc.merge(r); });
+}
+
+// norm: (|x[0]|^p + ... + |x[n - 1]|^p)^(1/p) for p >= 1, p = inf giving amax. p = 1, 2 and inf
+// take the dedicated one-pass kernels; other orders divide by amax first (a second pass), so
+// they do not overflow or underflow either. NaN for p < 1 or NaN p.
+template <typename TN>
+TN norm(const TN* x, std::size_t n, TN p)
+{
+    static_assert(std::is_floating_point_v<TN>, "norm: floating-point element types only");
+
+    if (p == TN(2))
+        return nrm2(x, n);
+    if (p == TN(1))
+        return asum(x, n);
+    if (p == std::numeric_limits<TN>::infinity())
+        return amax(x, n);
+    if (!(p >= TN(1)))
+        return std::numeric_limits<TN>::quiet_NaN();
+
+    const TN d = amax(x, n);
+    if (d == TN(0) || d == std::numeric_limits<TN>::infinity() || d != d)
+        return d;
+
+    const TN s = detail::reduce_blocks(
+                     x, n, [p, d](const TN* q, std::size_t m) { return simd::pow_sum_partial(q, m, p, d); },
+                     [](simd::sum_parts<TN>& acc, const simd::sum_parts<TN>& r) { acc.merge(r); })
+                     .value();
+    return d * std::pow(s, TN(1) / p);
+}
+
+} // namespace senkaid::backend::cpu
@@ -0,0 +1,226 @@
+#pragma once
+
+// transform_cpu.hpp: Element-wise transforms over contiguous buffers and dense matrices.
+// transform() runs a pack functor (anything callable as pack<TN> -> pack<TN>) over a buffer
+// one native vector at a time, finishes the ragged end with a masked load/store instead of a
+// scalar loop, and splits large buffers across the thread pool. The named functors wrap the
+// vectorized elementary functions of backend/simd/simd_math.hpp; their accuracy is listed there.
+//
+//   backend::cpu::transform(x, y, n, backend::cpu::Sigmoid{});
+//   auto p = backend::cpu::exp(logits);
+
+#include <senkaid/utils/config/root.hpp>
+#include <senkaid/utils/debug/root.hpp>
+#include <senkaid/core/matrix/dense.hpp>
+#include <senkaid/backend/simd/simd_math.hpp>
+#include <senkaid/backend/parallel/parallel_for.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+namespace senkaid::backend::cpu
+{
+
+// transform_grain: Elements per parallel chunk. Below this a transform stays on the calling
+// thread; an exp over 16K doubles takes only a few microseconds.
+inline constexpr std::size_t transform_grain = 16 * 1024;
+
+namespace detail
+{
+
+template <typename TN, typename Fn>
+SENKAID_FORCE_INLINE void transform_range(const TN* x, TN* y, std::size_t lo, std::size_t hi, Fn& fn)
+{
+    using P = simd::pack<TN>;
+
+    std::size_t i = lo;
+    for (; i + P::lanes <= hi; i += P::lanes)
+        fn(P::loadu(x + i)).storeu(y + i);
+
+    if (i < hi)
+    {
+        const auto tail = P::mask_type::first_n(hi - i);
+        fn(P::load(x + i, tail)).store(y + i, tail);
+    }
+}
+
+} // namespace detail
+
+// transform: y[i] = fn(x[i]) for i < n.
+// Parameters:
+//   x  - Input buffer.
+//   y  - Output buffer; may be x itself (in place) but must not partially overlap it.
+//   n  - Element count.
+//   fn - Pack functor; called concurrently from pool workers for large n.
+template <typename TN, typename Fn>
+void transform(const TN* x, TN* y, std::size_t n, Fn fn)
+{
+    static_assert(std::is_same_v<TN, float> || std::is_same_v<TN, double>,
+                  "transform: only float and double buffers are supported");
+
+    if (n == 0)
+        return;
+
+    parallel::parallel_for(0, n, transform_grain, [&](std::size_t lo, std::size_t hi) {
+        detail::transform_range(x, y, lo, hi, fn);
+    });
+}
+
+// apply: In-place transform of n elements.
+template <typename TN, typename Fn>
+void apply(TN* x, std::size_t n, Fn fn)
+{
+    transform(x, x, n, fn);
+}
+
+// Pack functors for transform(); each also accepts a single pack directly.
+struct Exp
+{
+    template <typename P>
+    SENKAID_FORCE_INLINE P operator()(P x) const noexcept { return simd::exp(x); }
+};
+
+struct Expm1
+{
+    template <typename P>
+    SENKAID_FORCE_INLINE P operator()(P x) const noexcept { return simd::expm1(x); }
+};
+
+struct Log
+{
+    template <typename P>
+    SENKAID_FORCE_INLINE P operator()(P x) const noexcept { return simd::log(x); }
+};
+
+struct Sin
+{
+    template <typename P>
+    SENKAID_FORCE_INLINE P operator()(P x) const noexcept { return simd::sin(x); }
+};
+
+struct Cos
+{
+    template <typename P>
+    SENKAID_FORCE_INLINE P operator()(P x) const noexcept { return simd::cos(x); }
+};
+
+struct Tanh
+{
+    template <typename P>
+    SENKAID_FORCE_INLINE P operator()(P x) const noexcept { return simd::tanh(x); }
+};
+
+struct Erf
+{
+    template <typename P>
+    SENKAID_FORCE_INLINE P operator()(P x) const noexcept { return simd::erf(x); }
+};
+
+struct Sigmoid
+{
+    template <typename P>
+    SENKAID_FORCE_INLINE P operator()(P x) const noexcept { return simd::sigmoid(x); }
+};
+
+// Gelu: x * Phi(x), the exact (erf-based) form, x / 2 * (1 + erf(x / sqrt(2))).
+struct Gelu
+{
+    template <typename P>
+    SENKAID_FORCE_INLINE P operator()(P x) const noexcept
+    {
+        using T = typename P::value_type;
+        const P half = x * P(T(0.5));
+        return fma(half, simd::erf(x * P(T(0.70710678118654752440))), half);
+    }
+};
+
+struct Sqrt
+{
+    template <typename P>
+    SENKAID_FORCE_INLINE P operator()(P x) const noexcept { return simd::sqrt(x); }
+};
+
+struct Rsqrt
+{
+    template <typename P>
+    SENKAID_FORCE_INLINE P operator()(P x) const noexcept { return simd::rsqrt(x); }
+};
+
+// transform: Element-wise fn(a) as a new matrix of the same shape and storage order.
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major, typename Fn>
+core::matrix::SDDenseMatrix<Rows, Cols, TN, Major> transform(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a,
+                                                             Fn fn)
+{
+    core::matrix::SDDenseMatrix<Rows, Cols, TN, Major> result(a.rows(), a.cols());
+    transform(a.data(), result.data(), a.size(), fn);
+    return result;
+}
+
+// apply: Element-wise fn on `a` in place.
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major, typename Fn>
+void apply(core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a, Fn fn)
+{
+    transform(a.data(), a.data(), a.size(), fn);
+}
+
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+core::matrix::SDDenseMatrix<Rows, Cols, TN, Major> exp(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a)
+{
+    return transform(a, Exp{});
+}
+
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+core::matrix::SDDenseMatrix<Rows, Cols, TN, Major> expm1(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a)
+{
+    return transform(a, Expm1{});
+}
+
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+core::matrix::SDDenseMatrix<Rows, Cols, TN, Major> log(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a)
+{
+    return transform(a, Log{});
+}
+
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+core::matrix::SDDenseMatrix<Rows, Cols, TN, Major> sin(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a)
+{
+    return transform(a, Sin{});
+}
+
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+core::matrix::SDDenseMatrix<Rows, Cols, TN, Major> cos(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a)
+{
+    return transform(a, Cos{});
+}
+
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+core::matrix::SDDenseMatrix<Rows, Cols, TN, Major> tanh(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a)
+{
+    return transform(a, Tanh{});
+}
+
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+core::matrix::SDDenseMatrix<Rows, Cols, TN, Major> erf(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a)
+{
+    return transform(a, Erf{});
+}
+
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+core::matrix::SDDenseMatrix<Rows, Cols, TN, Major> sigmoid(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a)
+{
+    return transform(a, Sigmoid{});
+}
+
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+core::matrix::SDDenseMatrix<Rows, Cols, TN, Major> gelu(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a)
+{
+    return transform(a, Gelu{});
+}
+
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+core::matrix::SDDenseMatrix<Rows, Cols, TN, Major> rsqrt(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a)
+{
+    return transform(a, Rsqrt{});
+}
+
+} // namespace senkaid::backend::cpu
@@ -0,0 +1,344 @@
+#pragma once
+
+// trsm_cpu.hpp: Blocked triangular solve (TRSM) and multiply (TRMM) for the CPU backend.
+// BLAS conventions: column-major storage, leading dimensions, side / uplo / op / diag selection.
+//   trsm: B := alpha * op(A)^-1 * B (Left) or alpha * B * op(A)^-1 (Right),
+//   trmm: B := alpha * op(A) * B    (Left) or alpha * B * op(A)    (Right),
+// with A triangular, m x m on the left and n x n on the right, and B m x n.
+// The triangle is cut into trsm_block diagonal blocks. Each block is copied once into a small
+// column-major tile (reciprocal diagonal for the solve) and applied to B directly; everything
+// off the diagonal blocks is a gemm() update of the rest of B, so for many right-hand sides
+// almost all of the work runs in the packed GEMM micro-kernel.
+
+#include <senkaid/utils/config/root.hpp>
+#include <senkaid/utils/debug/root.hpp>
+#include "matmul_cpu.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace senkaid::backend::cpu
+{
+
+// Uplo: Triangle of A that is referenced; the other one is never read.
+enum class Uplo : std::uint8_t
+{
+    Upper = 0x01,
+    Lower = 0x02
+};
+
+// Diag: Unit assumes ones on the diagonal of A without reading it.
+enum class Diag : std::uint8_t
+{
+    NonUnit = 0x01,
+    Unit = 0x02
+};
+
+// trsm_block: Edge of the diagonal blocks handled outside GEMM.
+inline constexpr std::size_t trsm_block = 128;
+
+namespace detail
+{
+
+// tri_lower: op(A) is lower triangular.
+SENKAID_FORCE_INLINE bool tri_lower(Uplo uplo, Op op) noexcept
+{
+    return (uplo == Uplo::Lower) == (op == Op::NoTrans);
+}
+
+// op_block: Address of op(A)(i, j), as the origin of a gemm() operand with the same op.
+template <typename TN>
+SENKAID_FORCE_INLINE const TN* op_block(Op op, const TN* a, std::size_t lda, std::size_t i, std::size_t j) noexcept
+{
+    return op == Op::NoTrans ? a + i + j * lda : a + j + i * lda;
+}
+
+// pack_tri: t = scale * op(A)(k0:k0+kb, k0:k0+kb), column-major with ld kb and the unused triangle
+// zeroed. The diagonal is 1 for Diag::Unit, and its reciprocal (before scaling) if Invert.
+template <bool Invert, typename TN>
+void pack_tri(Op op, Diag diag, bool lower, const TN* a, std::size_t lda, std::size_t k0, std::size_t kb, TN scale,
+              TN* SENKAID_RESTRICT t)
+{
+    for (std::size_t j = 0; j < kb; ++j)
+        for (std::size_t i = 0; i < kb; ++i)
+        {
+            TN v = TN(0);
+            if (i == j)
+            {
+                v = diag == Diag::Unit ? TN(1) : op_at(op, a, lda, k0 + i, k0 + j);
+                if constexpr (Invert)
+                    v = TN(1) / v;
+            }
+            else if ((i > j) == lower)
+                v = op_at(op, a, lda, k0 + i, k0 + j);
+            t[i + j * kb] = scale * v;
+        }
+}
+
+// tile_columns: Columns of B a left tile kernel carries together, each load of T serving all of them.
+inline constexpr std::size_t tile_columns = 4;
+
+// trsm_left_group: x[c] := T^-1 x[c] for G columns of length kb, T as in trsm_left_tile().
+template <std::size_t G, typename TN>
+SENKAID_FORCE_INLINE void trsm_left_group(bool lower, std::size_t kb, const TN* SENKAID_RESTRICT t, TN* const* x)
+{
+    for (std::size_t s = 0; s < kb; ++s)
+    {
+        const std::size_t j = lower ? s : kb - 1 - s;
+        const TN* tj = t + j * kb;
+        TN xj[G];
+        for (std::size_t c = 0; c < G; ++c)
+        {
+            xj[c] = x[c][j] * tj[j];
+            x[c][j] = xj[c];
+        }
+        const std::size_t i0 = lower ? j + 1 : 0, i1 = lower ? kb : j;
+        for (std::size_t i = i0; i < i1; ++i)
+        {
+            const TN ti = tj[i];
+            for (std::size_t c = 0; c < G; ++c)
+                x[c][i] -= xj[c] * ti;
+        }
+    }
+}
+
+// trsm_left_tile: B := T^-1 B for the kb x kb tile T (reciprocal diagonal), B kb x n.
+template <typename TN>
+void trsm_left_tile(bool lower, std::size_t kb, std::size_t n, const TN* SENKAID_RESTRICT t, TN* b, std::size_t ldb)
+{
+    constexpr std::size_t G = tile_columns;
+
+    std::size_t c0 = 0;
+    for (; c0 + G <= n; c0 += G)
+    {
+        TN* x[G];
+        for (std::size_t c = 0; c < G; ++c)
+            x[c] = b + (c0 + c) * ldb;
+        trsm_left_group<G>(lower, kb, t, x);
+    }
+    for (; c0 < n; ++c0)
+    {
+        TN* x = b + c0 * ldb;
+        trsm_left_group<1>(lower, kb, t, &x);
+    }
+}
+
+// trsm_right_tile: B := B T^-1 for the kb x kb tile T (reciprocal diagonal), B m x kb. Rows go
+// in strips that keep the kb columns in cache.
+template <typename TN>
+void trsm_right_tile(bool lower, std::size_t m, std::size_t kb, const TN* SENKAID_RESTRICT t, TN* b, std::size_t ldb)
+{
+    constexpr std::size_t strip = 256;
+
+    for (std::size_t r0 = 0; r0 < m; r0 += strip)
+    {
+        const std::size_t mr = std::min(strip, m - r0);
+        for (std::size_t s = 0; s < kb; ++s)
+        {
+            // Upper: column j depends on the columns before it; lower: on those after it.
+            const std::size_t j = lower ? kb - 1 - s : s;
+            TN* SENKAID_RESTRICT xj = b + r0 + j * ldb;
+            const std::size_t p0 = lower ? j + 1 : 0, p1 = lower ? kb : j;
+            for (std::size_t p = p0; p < p1; ++p)
+            {
+                const TN tpj = t[p + j * kb];
+                const TN* SENKAID_RESTRICT xp = b + r0 + p * ldb;
+                for (std::size_t i = 0; i < mr; ++i)
+                    xj[i] -= tpj * xp[i];
+            }
+            const TN d = t[j + j * kb];
+            for (std::size_t i = 0; i < mr; ++i)
+                xj[i] *= d;
+        }
+    }
+}
+
+// trmm_left_group: x[c] := T x[c] for G columns of length kb.
+template <std::size_t G, typename TN>
+SENKAID_FORCE_INLINE void trmm_left_group(bool lower, std::size_t kb, const TN* SENKAID_RESTRICT t, TN* const* x)
+{
+    // Column p of T scatters x[p] into the entries it has not been read by yet.
+    for (std::size_t s = 0; s < kb; ++s)
+    {
+        const std::size_t p = lower ? kb - 1 - s : s;
+        const TN* tp = t + p * kb;
+        TN xp[G];
+        for (std::size_t c = 0; c < G; ++c)
+            xp[c] = x[c][p];
+        const std::size_t i0 = lower ? p + 1 : 0, i1 = lower ? kb : p;
+        for (std::size_t i = i0; i < i1; ++i)
+        {
+            const TN ti = tp[i];
+            for (std::size_t c = 0; c < G; ++c)
+                x[c][i] += xp[c] * ti;
+        }
+        for (std::size_t c = 0; c < G; ++c)
+            x[c][p] = xp[c] * tp[p];
+    }
+}
+
+// trmm_left_tile: B := T B for the kb x kb tile T, B kb x n.
+template <typename TN>
+void trmm_left_tile(bool lower, std::size_t kb, std::size_t n, const TN* SENKAID_RESTRICT t, TN* b, std::size_t ldb)
+{
+    constexpr std::size_t G = tile_columns;
+
+    std::size_t c0 = 0;
+    for (; c0 + G <= n; c0 += G)
+    {
+        TN* x[G];
+        for (std::size_t c = 0; c < G; ++c)
+            x[c] = b + (c0 + c) * ldb;
+        trmm_left_group<G>(lower, kb, t, x);
+    }
+    for (; c0 < n; ++c0)
+    {
+        TN* x = b + c0 * ldb;
+        trmm_left_group<1>(lower, kb, t, &x);
+    }
+}
+
+// trmm_right_tile: B := B T for the kb x kb tile T, B m x kb.
+template <typename TN>
+void trmm_right_tile(bool lower, std::size_t m, std::size_t kb, const TN* SENKAID_RESTRICT t, TN* b, std::size_t ldb)
+{
+    constexpr std::size_t strip = 256;
+
+    for (std::size_t r0 = 0; r0 < m; r0 += strip)
+    {
+        const std::size_t mr = std::min(strip, m - r0);
+        for (std::size_t s = 0; s < kb; ++s)
+        {
+            // Column j is rebuilt from columns that are still unchanged: before it (upper, right to
+            // left) or after it (lower, left to right).
+            const std::size_t j = lower ? s : kb - 1 - s;
+            TN* SENKAID_RESTRICT xj = b + r0 + j * ldb;
+            const TN d = t[j + j * kb];
+            for (std::size_t i = 0; i < mr; ++i)
+                xj[i] *= d;
+            const std::size_t p0 = lower ? j + 1 : 0, p1 = lower ? kb : j;
+            for (std::size_t p = p0; p < p1; ++p)
+            {
+                const TN tpj = t[p + j * kb];
+                const TN* SENKAID_RESTRICT xp = b + r0 + p * ldb;
+                for (std::size_t i = 0; i < mr; ++i)
+                    xj[i] += tpj * xp[i];
+            }
+        }
+    }
+}
+
+} // namespace detail
+
+// trsm: Triangular solve with many right-hand sides, column-major, in place.
+// Parameters:
+//   side     - Left: B := alpha op(A)^-1 B (A m x m); Right: B := alpha B op(A)^-1 (A n x n).
+//   uplo     - Triangle of A that holds it.
+//   opa      - Transformation applied to A.
+//   diag     - Unit ignores A's diagonal and takes it as ones.
+//   m, n     - B is m x n.
+//   alpha    - Scale applied to B first; alpha == 0 zero-fills B.
+//   a, lda   - Matrix A and its leading dimension.
+//   b, ldb   - Right-hand sides on entry, the solution on exit.
+// Single-threaded, like gemm(); the columns (Left) or rows (Right) of B are independent problems
+// that callers may split across threads.
+template <typename TN>
+void trsm(Side side, Uplo uplo, Op opa, Diag diag, std::size_t m, std::size_t n, TN alpha,
+          const TN* a, std::size_t lda, TN* b, std::size_t ldb)
+{
+    constexpr std::size_t NB = trsm_block;
+
+    if (m == 0 || n == 0)
+        return;
+
+    detail::scale_c(m, n, alpha, b, ldb);
+    if (alpha == TN(0))
+        return;
+
+    static thread_local std::vector<TN> tile;
+    tile.resize(NB * NB);
+    const bool lower = detail::tri_lower(uplo, opa);
+    const std::size_t k = side == Side::Left ? m : n;
+    const std::size_t blocks = (k + NB - 1) / NB;
+
+    for (std::size_t s = 0; s < blocks; ++s)
+    {
+        // A lower op(A) is eliminated first block first on the left, last block first on the right.
+        const std::size_t blk = lower == (side == Side::Left) ? s : blocks - 1 - s;
+        const std::size_t k0 = blk * NB, kb = std::min(NB, k - k0), k1 = k0 + kb;
+        detail::pack_tri<true>(opa, diag, lower, a, lda, k0, kb, TN(1), tile.data());
+
+        if (side == Side::Left)
+        {
+            detail::trsm_left_tile(lower, kb, n, tile.data(), b + k0, ldb);
+            if (lower)
+                gemm(opa, Op::NoTrans, m - k1, n, kb, TN(-1), detail::op_block(opa, a, lda, k1, k0), lda, b + k0, ldb, TN(1), b + k1, ldb);
+            else
+                gemm(opa, Op::NoTrans, k0, n, kb, TN(-1), detail::op_block(opa, a, lda, std::size_t(0), k0), lda, b + k0, ldb, TN(1), b, ldb);
+        }
+        else
+        {
+            detail::trsm_right_tile(lower, m, kb, tile.data(), b + k0 * ldb, ldb);
+            if (lower)
+                gemm(Op::NoTrans, opa, m, k0, kb, TN(-1), b + k0 * ldb, ldb, detail::op_block(opa, a, lda, k0, std::size_t(0)), lda, TN(1), b, ldb);
+            else
+                gemm(Op::NoTrans, opa, m, k - k1, kb, TN(-1), b + k0 * ldb, ldb, detail::op_block(opa, a, lda, k0, k1), lda, TN(1), b + k1 * ldb,
+                     ldb);
+        }
+    }
+}
+
+// trmm: Triangular matrix product, column-major, in place.
+// Parameters as for trsm(): B := alpha op(A) B (Left) or alpha B op(A) (Right).
+// Single-threaded; split the columns (Left) or rows (Right) of B across threads.
+template <typename TN>
+void trmm(Side side, Uplo uplo, Op opa, Diag diag, std::size_t m, std::size_t n, TN alpha,
+          const TN* a, std::size_t lda, TN* b, std::size_t ldb)
+{
+    constexpr std::size_t NB = trsm_block;
+
+    if (m == 0 || n == 0)
+        return;
+
+    if (alpha == TN(0))
+    {
+        detail::scale_c(m, n, alpha, b, ldb);
+        return;
+    }
+
+    static thread_local std::vector<TN> tile;
+    tile.resize(NB * NB);
+    const bool lower = detail::tri_lower(uplo, opa);
+    const std::size_t k = side == Side::Left ? m : n;
+    const std::size_t blocks = (k + NB - 1) / NB;
+
+    for (std::size_t s = 0; s < blocks; ++s)
+    {
+        // Each block reads the blocks it depends on before they are overwritten.
+        const std::size_t blk = lower == (side == Side::Left) ? blocks - 1 - s : s;
+        const std::size_t k0 = blk * NB, kb = std::min(NB, k - k0), k1 = k0 + kb;
+        detail::pack_tri<false>(opa, diag, lower, a, lda, k0, kb, alpha, tile.data());
+
+        if (side == Side::Left)
+        {
+            detail::trmm_left_tile(lower, kb, n, tile.data(), b + k0, ldb);
+            if (lower)
+                gemm(opa, Op::NoTrans, kb, n, k0, alpha, detail::op_block(opa, a, lda, k0, std::size_t(0)), lda, b, ldb, TN(1), b + k0, ldb);
+            else
+                gemm(opa, Op::NoTrans, kb, n, k - k1, alpha, detail::op_block(opa, a, lda, k0, k1), lda, b + k1, ldb, TN(1), b + k0, ldb);
+        }
+        else
+        {
+            detail::trmm_right_tile(lower, m, kb, tile.data(), b + k0 * ldb, ldb);
+            if (lower)
+                gemm(Op::NoTrans, opa, m, kb, k - k1, alpha, b + k1 * ldb, ldb, detail::op_block(opa, a, lda, k1, k0), lda, TN(1), b + k0 * ldb,
+                     ldb);
+            else
+                gemm(Op::NoTrans, opa, m, kb, k0, alpha, b, ldb, detail::op_block(opa, a, lda, std::size_t(0), k0), lda, TN(1), b + k0 * ldb, ldb);
+        }
+    }
+}
+
+} // namespace senkaid::backend::cpu
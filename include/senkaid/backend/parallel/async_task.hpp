@@ -0,0 +1,461 @@
+#pragma once
+
+// async_task.hpp: C++20 coroutine front-end for long-running kernels.
+// Task<T> is a lazy, move-only awaitable. Work is moved onto the shared ThreadPool with
+// schedule_on(), results are chained with then(), and blocked algorithms poll a
+// CancellationToken between blocks so an in-flight operation can be abandoned early.
+//
+// Typical use from an event-loop service:
+//   auto t = async_invoke(pool, token, [&] { return factorize(a, n, lda); })
+//                .then([](int info) { return info == 0; });
+//   spawn(std::move(t), [](std::expected<bool, std::exception_ptr> r) { ... });
+
+#include <senkaid/utils/config/root.hpp>
+#include <senkaid/utils/debug/root.hpp>
+#include "parallel_std.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <expected>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace senkaid::backend::parallel
+{
+
+// --- Cancellation ---
+
+// CancelledError: Thrown by CancellationToken::throw_if_cancelled() and surfaces
+// from co_await / sync_wait of a cancelled task.
+class CancelledError : public std::runtime_error
+{
+public:
+    CancelledError() : std::runtime_error("senkaid: operation cancelled") {}
+};
+
+// CancellationToken: Read-only view of a cancellation flag.
+// A default-constructed token is never cancelled and costs a single null check.
+class CancellationToken
+{
+public:
+    CancellationToken() noexcept = default;
+
+    SENKAID_FORCE_INLINE bool cancelled() const noexcept
+    {
+        return _flag && _flag->load(std::memory_order_relaxed);
+    }
+
+    SENKAID_FORCE_INLINE void throw_if_cancelled() const
+    {
+        if (SENKAID_UNLIKELY(cancelled()))
+            throw CancelledError();
+    }
+
+private:
+    friend class CancellationSource;
+
+    explicit CancellationToken(std::shared_ptr<const std::atomic<bool>> flag) noexcept
+        : _flag(std::move(flag)) {}
+
+    std::shared_ptr<const std::atomic<bool>> _flag;
+};
+
+// CancellationSource: Owner side of a cancellation flag. Copies share the flag.
+class CancellationSource
+{
+public:
+    CancellationSource() : _flag(std::make_shared<std::atomic<bool>>(false)) {}
+
+    SENKAID_FORCE_INLINE void cancel() noexcept
+    {
+        _flag->store(true, std::memory_order_relaxed);
+    }
+
+    SENKAID_FORCE_INLINE bool cancelled() const noexcept
+    {
+        return _flag->load(std::memory_order_relaxed);
+    }
+
+    SENKAID_FORCE_INLINE CancellationToken token() const noexcept
+    {
+        return CancellationToken(_flag);
+    }
+
+private:
+    std::shared_ptr<std::atomic<bool>> _flag;
+};
+
+// for_each_block: Runs fn(begin, end) over [0, n) in consecutive blocks of `block` elements,
+// checking `token` before each block. Used by blocked kernels to make cancellation cooperative.
+template <typename Fn>
+void for_each_block(std::size_t n, std::size_t block, const CancellationToken& token, Fn&& fn)
+{
+    if (block == 0)
+        block = n;
+
+    for (std::size_t begin = 0; begin < n; begin += block)
+    {
+        token.throw_if_cancelled();
+        fn(begin, begin + block < n ? begin + block : n);
+    }
+}
+
+// --- Task ---
+
+template <typename T = void>
+class Task;
+
+namespace detail
+{
+
+struct FinalAwaiter
+{
+    bool await_ready() const noexcept { return false; }
+
+    template <typename Promise>
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> h) const noexcept
+    {
+        auto continuation = h.promise()._continuation;
+        return continuation ? continuation : std::noop_coroutine();
+    }
+
+    void await_resume() const noexcept {}
+};
+
+struct PromiseBase
+{
+    std::coroutine_handle<> _continuation;
+    std::exception_ptr _exception;
+
+    std::suspend_always initial_suspend() const noexcept { return {}; }
+    FinalAwaiter final_suspend() const noexcept { return {}; }
+    void unhandled_exception() noexcept { _exception = std::current_exception(); }
+};
+
+template <typename T>
+struct TaskPromise : PromiseBase
+{
+    std::optional<T> _value;
+
+    Task<T> get_return_object() noexcept;
+
+    template <typename U>
+    void return_value(U&& value)
+    {
+        _value.emplace(std::forward<U>(value));
+    }
+
+    T take()
+    {
+        if (_exception)
+            std::rethrow_exception(_exception);
+        return std::move(*_value);
+    }
+};
+
+template <>
+struct TaskPromise<void> : PromiseBase
+{
+    Task<void> get_return_object() noexcept;
+
+    void return_void() const noexcept {}
+
+    void take()
+    {
+        if (_exception)
+            std::rethrow_exception(_exception);
+    }
+};
+
+template <typename>
+inline constexpr bool is_task_v = false;
+
+template <typename T>
+inline constexpr bool is_task_v<Task<T>> = true;
+
+template <typename R>
+struct unwrap_task { using type = R; };
+
+template <typename T>
+struct unwrap_task<Task<T>> { using type = T; };
+
+template <typename T, typename Fn>
+struct continuation_result
+{
+    using type = std::invoke_result_t<Fn, T>;
+};
+
+template <typename Fn>
+struct continuation_result<void, Fn>
+{
+    using type = std::invoke_result_t<Fn>;
+};
+
+template <typename T, typename Fn>
+using continuation_value_t = typename unwrap_task<typename continuation_result<T, Fn>::type>::type;
+
+template <typename T, typename Fn>
+Task<continuation_value_t<T, Fn>> then_impl(Task<T> task, Fn fn);
+
+} // namespace detail
+
+// Task: Lazily started coroutine producing a T (or void).
+// The body does not run until the task is awaited, sync_wait()ed or spawn()ed.
+// When it completes, the awaiting coroutine is resumed on the completing thread.
+template <typename T>
+class [[nodiscard]] Task
+{
+public:
+    using promise_type = detail::TaskPromise<T>;
+    using value_type = T;
+    using handle_type = std::coroutine_handle<promise_type>;
+
+    Task() noexcept = default;
+
+    explicit Task(handle_type handle) noexcept : _handle(handle) {}
+
+    Task(Task&& other) noexcept : _handle(std::exchange(other._handle, {})) {}
+
+    Task& operator=(Task&& other) noexcept
+    {
+        if (this != &other)
+        {
+            if (_handle)
+                _handle.destroy();
+            _handle = std::exchange(other._handle, {});
+        }
+        return *this;
+    }
+
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+
+    ~Task()
+    {
+        if (_handle)
+            _handle.destroy();
+    }
+
+    SENKAID_FORCE_INLINE bool valid() const noexcept { return static_cast<bool>(_handle); }
+    SENKAID_FORCE_INLINE bool done() const noexcept { return _handle && _handle.done(); }
+
+    auto operator co_await() && noexcept
+    {
+        struct Awaiter
+        {
+            handle_type _handle;
+
+            bool await_ready() const noexcept { return !_handle || _handle.done(); }
+
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> continuation) noexcept
+            {
+                _handle.promise()._continuation = continuation;
+                return _handle;
+            }
+
+            T await_resume()
+            {
+                if (!_handle)
+                    throw std::logic_error("senkaid: awaiting an empty Task");
+                return _handle.promise().take();
+            }
+        };
+
+        return Awaiter{_handle};
+    }
+
+    // then: Chains a continuation that receives the result of this task.
+    // If fn returns a Task<U>, the returned task completes with U (no nesting).
+    template <typename Fn>
+    auto then(Fn fn) &&
+    {
+        return detail::then_impl<T, Fn>(std::move(*this), std::move(fn));
+    }
+
+private:
+    handle_type _handle;
+};
+
+namespace detail
+{
+
+template <typename T>
+Task<T> TaskPromise<T>::get_return_object() noexcept
+{
+    return Task<T>(std::coroutine_handle<TaskPromise<T>>::from_promise(*this));
+}
+
+inline Task<void> TaskPromise<void>::get_return_object() noexcept
+{
+    return Task<void>(std::coroutine_handle<TaskPromise<void>>::from_promise(*this));
+}
+
+template <typename T, typename Fn>
+Task<continuation_value_t<T, Fn>> then_impl(Task<T> task, Fn fn)
+{
+    using R = typename continuation_result<T, Fn>::type;
+
+    if constexpr (std::is_void_v<T>)
+    {
+        co_await std::move(task);
+        if constexpr (is_task_v<R>)
+            co_return co_await fn();
+        else if constexpr (std::is_void_v<R>)
+            fn();
+        else
+            co_return fn();
+    }
+    else
+    {
+        if constexpr (is_task_v<R>)
+            co_return co_await fn(co_await std::move(task));
+        else if constexpr (std::is_void_v<R>)
+            fn(co_await std::move(task));
+        else
+            co_return fn(co_await std::move(task));
+    }
+}
+
+// Eagerly started, self-destroying coroutine used to drive a Task from non-coroutine code.
+struct DetachedDriver
+{
+    struct promise_type
+    {
+        DetachedDriver get_return_object() const noexcept { return {}; }
+        std::suspend_never initial_suspend() const noexcept { return {}; }
+        std::suspend_never final_suspend() const noexcept { return {}; }
+        void return_void() const noexcept {}
+        void unhandled_exception() const noexcept { std::terminate(); }
+    };
+};
+
+template <typename T>
+using task_result_t = std::expected<T, std::exception_ptr>;
+
+template <typename T, typename Fn>
+DetachedDriver drive(Task<T> task, Fn on_complete)
+{
+    task_result_t<T> result = std::unexpected(std::exception_ptr{});
+
+    try
+    {
+        if constexpr (std::is_void_v<T>)
+        {
+            co_await std::move(task);
+            result = task_result_t<T>{};
+        }
+        else
+        {
+            result = co_await std::move(task);
+        }
+    }
+    catch (...)
+    {
+        result = std::unexpected(std::current_exception());
+    }
+
+    on_complete(std::move(result));
+}
+
+template <typename T>
+struct SyncState
+{
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool done = false;
+    std::optional<task_result_t<T>> result;
+};
+
+} // namespace detail
+
+// --- Scheduling ---
+
+// ScheduleAwaiter: co_await'ing it moves the rest of the coroutine onto a pool worker.
+class ScheduleAwaiter
+{
+public:
+    explicit ScheduleAwaiter(ThreadPool& pool) noexcept : _pool(pool) {}
+
+    bool await_ready() const noexcept { return false; }
+
+    void await_suspend(std::coroutine_handle<> handle)
+    {
+        _pool.submit([handle] { handle.resume(); });
+    }
+
+    void await_resume() const noexcept {}
+
+private:
+    ThreadPool& _pool;
+};
+
+SENKAID_FORCE_INLINE ScheduleAwaiter schedule_on(ThreadPool& pool) noexcept
+{
+    return ScheduleAwaiter(pool);
+}
+
+// async_invoke: Awaitable version of any blocking entry point.
+// Runs fn(args...) on `pool`; the token is checked once before the call starts.
+// Pass the same token into fn's arguments to get checks between blocks as well.
+template <typename Fn, typename... Args>
+requires std::invocable<Fn&, Args&...>
+Task<std::invoke_result_t<Fn&, Args&...>> async_invoke(ThreadPool& pool, CancellationToken token, Fn fn, Args... args)
+{
+    co_await schedule_on(pool);
+    token.throw_if_cancelled();
+
+    if constexpr (std::is_void_v<std::invoke_result_t<Fn&, Args&...>>)
+        std::invoke(fn, args...);
+    else
+        co_return std::invoke(fn, args...);
+}
+
+template <typename Fn, typename... Args>
+requires std::invocable<Fn&, Args&...>
+Task<std::invoke_result_t<Fn&, Args&...>> async_invoke(ThreadPool& pool, Fn fn, Args... args)
+{
+    return async_invoke(pool, CancellationToken{}, std::move(fn), std::move(args)...);
+}
+
+// spawn: Starts `task` without blocking. on_complete receives
+// std::expected<T, std::exception_ptr> on whichever thread finished the task.
+// This lets a single service thread keep many operations in flight.
+template <typename T, typename Fn>
+void spawn(Task<T> task, Fn on_complete)
+{
+    detail::drive(std::move(task), std::move(on_complete));
+}
+
+// sync_wait: Starts `task` and blocks the calling thread until it completes.
+// Rethrows any exception raised by the task, including CancelledError.
+template <typename T>
+T sync_wait(Task<T> task)
+{
+    detail::SyncState<T> state;
+
+    detail::drive(std::move(task), [&state](detail::task_result_t<T> result) {
+        std::lock_guard lock(state.mutex);
+        state.result.emplace(std::move(result));
+        state.done = true;
+        state.cv.notify_one();
+    });
+
+    std::unique_lock lock(state.mutex);
+    state.cv.wait(lock, [&state] { return state.done; });
+
+    if (!state.result->has_value())
+        std::rethrow_exception(state.result->error());
+
+    if constexpr (!std::is_void_v<T>)
+        return std::move(**state.result);
+}
+
+} // namespace senkaid::backend::parallel
@@ -0,0 +1,10 @@
+#pragma once
+
+// parallel_backend.hpp: Entry point of the CPU parallel layer.
+// Pulls in the configuration, the std::thread backend used by default, parallel_for and the
+// low-latency HotTeam fork-join runtime.
+
+#include "parallel_config.hpp"
+#include "parallel_std.hpp"
+#include "parallel_for.hpp"
+#include "fork_join.hpp"
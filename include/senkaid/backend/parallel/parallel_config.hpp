@@ -0,0 +1,73 @@
+#pragma once
+
+// parallel_config.hpp: Process-wide configuration for the CPU parallel backends.
+// Controls the worker count of the shared pool and whether parallel execution is allowed at all.
+// All knobs are atomics so they can be changed at runtime from any thread.
+
+#include <senkaid/utils/config/root.hpp>
+#include <senkaid/utils/debug/root.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <thread>
+
+namespace senkaid::backend::parallel
+{
+
+class ParallelConfig
+{
+public:
+    // thread_count: Number of worker threads used when the shared pool is created.
+    // Resolution order:
+    //   1. value passed to set_thread_count()
+    //   2. SENKAID_NUM_THREADS environment variable
+    //   3. SENKAID_DEFAULT_THREAD_COUNT (if non-zero)
+    //   4. std::thread::hardware_concurrency()
+    // Never returns zero.
+    static std::size_t thread_count() noexcept
+    {
+        std::size_t count = _thread_count.load(std::memory_order_relaxed);
+        if (count != 0)
+            return count;
+
+        if (const char* env = std::getenv("SENKAID_NUM_THREADS"))
+        {
+            long parsed = std::strtol(env, nullptr, 10);
+            if (parsed > 0)
+                return static_cast<std::size_t>(parsed);
+            SENKAID_LOG_WARNING("ParallelConfig: ignoring invalid SENKAID_NUM_THREADS");
+        }
+
+        if constexpr (SENKAID_DEFAULT_THREAD_COUNT > 0)
+            return SENKAID_DEFAULT_THREAD_COUNT;
+
+        unsigned hw = std::thread::hardware_concurrency();
+        return hw != 0 ? hw : 1;
+    }
+
+    // set_thread_count: Overrides the worker count. Zero restores automatic detection.
+    // Only affects pools created after the call.
+    static void set_thread_count(std::size_t count) noexcept
+    {
+        _thread_count.store(count, std::memory_order_relaxed);
+    }
+
+    // enabled: Whether kernels are allowed to fan out work to other threads.
+    // When disabled every parallel primitive runs inline on the calling thread.
+    static bool enabled() noexcept
+    {
+        return _enabled.load(std::memory_order_relaxed);
+    }
+
+    static void set_enabled(bool enabled) noexcept
+    {
+        _enabled.store(enabled, std::memory_order_relaxed);
+    }
+
+private:
+    static inline std::atomic<std::size_t> _thread_count{0};
+    static inline std::atomic<bool> _enabled{true};
+};
+
+} // namespace senkaid::backend::parallel
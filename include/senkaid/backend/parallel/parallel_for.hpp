@@ -0,0 +1,128 @@
+#pragma once
+
+// parallel_for.hpp: Blocking parallel loop over an index range.
+// The range is cut into chunks of at least `grain` indices that pool workers and the calling
+// thread claim from a shared counter, so uneven chunks balance themselves.
+
+#include <senkaid/utils/config/root.hpp>
+#include <senkaid/utils/debug/root.hpp>
+#include "parallel_config.hpp"
+#include "parallel_std.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+
+namespace senkaid::backend::parallel
+{
+
+namespace detail
+{
+
+struct ForState
+{
+    std::atomic<std::size_t> next{0};
+    std::size_t end = 0;
+    std::size_t chunk = 1;
+    std::size_t active = 0;
+    bool closed = false;
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::exception_ptr error;
+};
+
+template <typename Fn>
+void run_chunks(ForState& state, std::size_t begin, Fn& fn)
+{
+    for (;;)
+    {
+        // next and end are offsets from begin.
+        const std::size_t lo = state.next.fetch_add(state.chunk, std::memory_order_relaxed);
+        if (lo >= state.end)
+            return;
+
+        const std::size_t hi = std::min(state.end, lo + state.chunk);
+        try
+        {
+            fn(begin + lo, begin + hi);
+        }
+        catch (...)
+        {
+            std::lock_guard lock(state.mutex);
+            if (!state.error)
+                state.error = std::current_exception();
+            state.next.store(state.end, std::memory_order_relaxed);
+            return;
+        }
+    }
+}
+
+} // namespace detail
+
+// parallel_for: Calls fn(lo, hi) over disjoint sub-ranges covering [begin, end).
+// Parameters:
+//   begin, end - Index range.
+//   grain      - Minimum indices per call; small ranges run inline on the calling thread.
+//   fn         - Callable taking (std::size_t lo, std::size_t hi); must be safe to run concurrently.
+//   pool       - Worker pool (defaults to the shared one).
+// Runs inline when parallelism is disabled or when called from a pool worker (no nested fan-out).
+// The first exception thrown by fn is rethrown after all chunks have stopped.
+template <typename Fn>
+void parallel_for(std::size_t begin, std::size_t end, std::size_t grain, Fn&& fn,
+                  ThreadPool& pool = ThreadPool::instance())
+{
+    if (begin >= end)
+        return;
+
+    const std::size_t n = end - begin;
+    grain = std::max<std::size_t>(grain, 1);
+
+    const std::size_t max_workers = (n + grain - 1) / grain;
+    const std::size_t workers = std::min(max_workers, pool.size() + 1);
+
+    if (workers <= 1 || !ParallelConfig::enabled() || ThreadPool::on_worker_thread())
+    {
+        fn(begin, end);
+        return;
+    }
+
+    auto state = std::make_shared<detail::ForState>();
+    state->end = n;
+    // Several chunks per worker so a slow worker does not hold up the whole loop.
+    state->chunk = std::max(grain, n / (workers * 4));
+
+    // Helpers that get scheduled after the caller has finished the range never touch fn,
+    // so the caller only waits for helpers that actually joined; a busy pool cannot stall it.
+    for (std::size_t w = 1; w < workers; ++w)
+    {
+        pool.submit([state, begin, &fn] {
+            {
+                std::lock_guard lock(state->mutex);
+                if (state->closed)
+                    return;
+                ++state->active;
+            }
+
+            detail::run_chunks(*state, begin, fn);
+
+            std::lock_guard lock(state->mutex);
+            if (--state->active == 0)
+                state->cv.notify_one();
+        });
+    }
+
+    detail::run_chunks(*state, begin, fn);
+
+    std::unique_lock lock(state->mutex);
+    state->closed = true;
+    state->cv.wait(lock, [&] { return state->active == 0; });
+
+    if (state->error)
+        std::rethrow_exception(state->error);
+}
+
+} // namespace senkaid::backend::parallel
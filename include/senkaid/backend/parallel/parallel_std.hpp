@@ -0,0 +1,131 @@
+#pragma once
+
+// parallel_std.hpp: std::thread based parallel backend.
+// Provides the library-wide worker pool that coroutine tasks and parallel kernels are scheduled on.
+
+#include <senkaid/utils/config/root.hpp>
+#include <senkaid/utils/debug/root.hpp>
+#include "parallel_config.hpp"
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace senkaid::backend::parallel
+{
+
+// ThreadPool: Fixed-size FIFO worker pool.
+// Jobs must not throw; an escaping exception is logged and swallowed so that
+// a single faulty job cannot take down a worker.
+class ThreadPool
+{
+public:
+    using Job = std::function<void()>;
+
+    // Constructor: Starts `threads` workers (at least one).
+    explicit ThreadPool(std::size_t threads = ParallelConfig::thread_count())
+        : _stopping(false)
+    {
+        if (threads == 0)
+            threads = 1;
+
+        _workers.reserve(threads);
+        for (std::size_t i = 0; i < threads; ++i)
+            _workers.emplace_back([this] { _worker_loop(); });
+    }
+
+    // Destructor: Drains the queue and joins all workers.
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard lock(_mutex);
+            _stopping = true;
+        }
+        _cv.notify_all();
+
+        for (auto& worker : _workers)
+            worker.join();
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // instance: Shared pool sized by ParallelConfig::thread_count() at first use.
+    static ThreadPool& instance()
+    {
+        static ThreadPool pool;
+        return pool;
+    }
+
+    // submit: Enqueues a job for execution on one of the workers.
+    template <typename Fn>
+    void submit(Fn&& fn)
+    {
+        {
+            std::lock_guard lock(_mutex);
+            _queue.emplace_back(std::forward<Fn>(fn));
+        }
+        _cv.notify_one();
+    }
+
+    SENKAID_FORCE_INLINE std::size_t size() const noexcept
+    {
+        return _workers.size();
+    }
+
+    // on_worker_thread: True when called from inside any ThreadPool worker.
+    static SENKAID_FORCE_INLINE bool on_worker_thread() noexcept
+    {
+        return _is_worker;
+    }
+
+private:
+    void _worker_loop()
+    {
+        _is_worker = true;
+
+        for (;;)
+        {
+            Job job;
+            {
+                std::unique_lock lock(_mutex);
+                _cv.wait(lock, [this] { return _stopping || !_queue.empty(); });
+
+                if (_queue.empty())
+                    return;
+
+                job = std::move(_queue.front());
+                _queue.pop_front();
+            }
+
+            try
+            {
+                job();
+            }
+            catch (const std::exception& e)
+            {
+                SENKAID_LOG_ERROR(std::string("ThreadPool: job threw: ") + e.what());
+            }
+            catch (...)
+            {
+                SENKAID_LOG_ERROR("ThreadPool: job threw an unknown exception");
+            }
+        }
+    }
+
+    static inline thread_local bool _is_worker = false;
+
+    std::vector<std::thread> _workers;
+    std::deque<Job> _queue;
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    bool _stopping;
+};
+
+} // namespace senkaid::backend::parallel
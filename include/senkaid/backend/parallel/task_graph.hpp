@@ -0,0 +1,330 @@
+#pragma once
+
+// task_graph.hpp: Dynamic task-DAG runtime with data-dependency tracking.
+// Tasks are inserted in sequential program order together with the data handles they read
+// and write; read-after-write, write-after-read and write-after-write hazards become edges.
+// Ready tasks are executed by pool workers (and the waiting thread) highest priority first,
+// which lets tiled algorithms run the next panel ahead of the current trailing update. A pool
+// job is submitted whenever a task becomes ready and fewer helpers than workers are out; a
+// helper returns to the pool as soon as nothing is ready, so a graph holds no idle workers.
+
+#include <senkaid/utils/config/root.hpp>
+#include <senkaid/utils/debug/root.hpp>
+#include "parallel_std.hpp"
+#include "async_task.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <span>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace senkaid::backend::parallel
+{
+
+// Access: How a task touches a data handle. Any stable address can serve as a handle
+// (typically the first element of a tile).
+struct Access
+{
+    enum class Mode : std::uint8_t
+    {
+        Read = 0x01,
+        Write = 0x02
+    };
+
+    const void* handle;
+    Mode mode;
+
+    static constexpr Access read(const void* handle) noexcept { return {handle, Mode::Read}; }
+    static constexpr Access write(const void* handle) noexcept { return {handle, Mode::Write}; }
+};
+
+namespace detail
+{
+
+struct GraphNode
+{
+    std::function<void()> fn;
+    std::vector<GraphNode*> successors;
+    std::size_t pending = 0;
+    std::size_t sequence = 0;
+    int priority = 0;
+    bool done = false;
+};
+
+struct GraphNodeOrder
+{
+    bool operator()(const GraphNode* lhs, const GraphNode* rhs) const noexcept
+    {
+        if (lhs->priority != rhs->priority)
+            return lhs->priority < rhs->priority;
+        return lhs->sequence > rhs->sequence;
+    }
+};
+
+struct GraphHandleState
+{
+    GraphNode* writer = nullptr;
+    std::vector<GraphNode*> readers;
+};
+
+struct GraphState : std::enable_shared_from_this<GraphState>
+{
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<GraphNode> nodes;
+    std::priority_queue<GraphNode*, std::vector<GraphNode*>, GraphNodeOrder> ready;
+    std::unordered_map<const void*, GraphHandleState> handles;
+    std::size_t unfinished = 0;
+    std::size_t running = 0;
+    std::size_t sequence = 0;
+    std::size_t helpers = 0;
+    ThreadPool* pool = nullptr;
+    bool closed = false;
+    bool aborted = false;
+    std::exception_ptr error;
+    CancellationToken token;
+
+    // spawn: Submits up to `count` helpers, at most one per pool worker. Called with mutex held.
+    void spawn(std::size_t count)
+    {
+        if (!pool)
+            return;
+        for (; count > 0 && helpers < pool->size(); --count)
+        {
+            ++helpers;
+            pool->submit([state = shared_from_this()] { state->run(false); });
+        }
+    }
+
+    // run: Executes ready tasks. The waiting thread (wait == true) blocks until the graph drains or
+    // is aborted; a pool helper returns as soon as no task is ready.
+    void run(bool wait)
+    {
+        std::unique_lock lock(mutex);
+
+        for (;;)
+        {
+            if (wait)
+                cv.wait(lock, [this] { return aborted || !ready.empty() || (closed && unfinished == 0); });
+
+            if (aborted || ready.empty())
+            {
+                if (!wait)
+                    --helpers;
+                return;
+            }
+
+            GraphNode* node = ready.top();
+            ready.pop();
+            ++running;
+            lock.unlock();
+
+            std::exception_ptr failure;
+            try
+            {
+                token.throw_if_cancelled();
+                node->fn();
+            }
+            catch (...)
+            {
+                failure = std::current_exception();
+            }
+            node->fn = nullptr;
+
+            lock.lock();
+            --running;
+
+            if (failure)
+            {
+                if (!error)
+                    error = failure;
+                aborted = true;
+                cv.notify_all();
+                continue;
+            }
+
+            node->done = true;
+            --unfinished;
+
+            std::size_t released = 0;
+            for (GraphNode* succ : node->successors)
+            {
+                if (--succ->pending == 0)
+                {
+                    ready.push(succ);
+                    ++released;
+                }
+            }
+
+            if (aborted || unfinished == 0 || released > 1)
+                cv.notify_all();
+            else if (released == 1)
+                cv.notify_one();
+
+            // This thread takes one of the released tasks; the rest may need more helpers.
+            if (released > 1)
+                spawn(released - 1);
+        }
+    }
+};
+
+} // namespace detail
+
+// TaskGraph: Builds and executes a dependency graph over the shared ThreadPool.
+// Execution starts as soon as the first ready task is inserted; wait() joins in and
+// returns once every task has run. The first exception thrown by a task (including
+// CancelledError from the token) aborts the remaining tasks and is rethrown by wait().
+class TaskGraph
+{
+public:
+    // Constructor:
+    //   pool     - Pool whose workers help execute the graph.
+    //   token    - Checked before every task; cancellation aborts the graph.
+    //   parallel - When false, all tasks run on the thread calling wait().
+    explicit TaskGraph(ThreadPool& pool = ThreadPool::instance(), CancellationToken token = {},
+                       bool parallel = ParallelConfig::enabled())
+        : _state(std::make_shared<detail::GraphState>()), _waited(false)
+    {
+        _state->token = std::move(token);
+        if (parallel)
+            _state->pool = &pool;
+    }
+
+    TaskGraph(const TaskGraph&) = delete;
+    TaskGraph& operator=(const TaskGraph&) = delete;
+
+    // Destructor: Aborts outstanding tasks if wait() was never called and blocks until
+    // no task is running, since tasks typically reference caller-owned data.
+    ~TaskGraph()
+    {
+        if (_waited)
+            return;
+
+        abort();
+        std::unique_lock lock(_state->mutex);
+        _state->closed = true;
+        _state->cv.wait(lock, [this] { return _state->running == 0; });
+        _state->cv.notify_all();
+    }
+
+    // insert: Adds a task that runs fn() after every earlier task it conflicts with.
+    // Parameters:
+    //   fn       - Work to execute; must be callable once with no arguments.
+    //   accesses - Handles the task reads and/or writes.
+    //   priority - Larger values are preferred among ready tasks (critical path first).
+    template <typename Fn>
+    void insert(Fn&& fn, std::span<const Access> accesses, int priority = 0)
+    {
+        detail::GraphState& s = *_state;
+        std::unique_lock lock(s.mutex);
+
+        if (s.aborted)
+            return;
+
+        detail::GraphNode& node = s.nodes.emplace_back();
+        node.fn = std::forward<Fn>(fn);
+        node.priority = priority;
+        node.sequence = s.sequence++;
+
+        _preds.clear();
+        for (const Access& access : accesses)
+        {
+            detail::GraphHandleState& h = s.handles[access.handle];
+
+            if (h.writer && !h.writer->done && h.writer != &node)
+                _preds.push_back(h.writer);
+
+            if (access.mode == Access::Mode::Read)
+            {
+                h.readers.push_back(&node);
+            }
+            else
+            {
+                for (detail::GraphNode* reader : h.readers)
+                    if (reader != &node && !reader->done)
+                        _preds.push_back(reader);
+                h.readers.clear();
+                h.writer = &node;
+            }
+        }
+
+        std::sort(_preds.begin(), _preds.end());
+        _preds.erase(std::unique(_preds.begin(), _preds.end()), _preds.end());
+
+        for (detail::GraphNode* pred : _preds)
+            pred->successors.push_back(&node);
+
+        node.pending = _preds.size();
+        ++s.unfinished;
+
+        if (node.pending == 0)
+        {
+            s.ready.push(&node);
+            s.spawn(1);
+            lock.unlock();
+            s.cv.notify_one();
+        }
+    }
+
+    template <typename Fn>
+    void insert(Fn&& fn, std::initializer_list<Access> accesses, int priority = 0)
+    {
+        insert(std::forward<Fn>(fn), std::span<const Access>(accesses.begin(), accesses.size()), priority);
+    }
+
+    // abort: Stops scheduling new tasks. Tasks already running finish normally.
+    void abort()
+    {
+        {
+            std::lock_guard lock(_state->mutex);
+            _state->aborted = true;
+        }
+        _state->cv.notify_all();
+    }
+
+    // wait: Executes tasks on the calling thread until the graph is complete.
+    // Rethrows the first task failure, if any.
+    void wait()
+    {
+        detail::GraphState& s = *_state;
+        {
+            std::lock_guard lock(s.mutex);
+            s.closed = true;
+        }
+        s.cv.notify_all();
+
+        s.run(true);
+
+        std::unique_lock lock(s.mutex);
+        s.cv.wait(lock, [&s] { return s.running == 0; });
+        _waited = true;
+
+        if (s.error)
+            std::rethrow_exception(s.error);
+    }
+
+    // aborted: True if abort() was called or a task failed.
+    bool aborted() const
+    {
+        std::lock_guard lock(_state->mutex);
+        return _state->aborted;
+    }
+
+private:
+    std::shared_ptr<detail::GraphState> _state;
+    std::vector<detail::GraphNode*> _preds;
+    bool _waited;
+};
+
+} // namespace senkaid::backend::parallel
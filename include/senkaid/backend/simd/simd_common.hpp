@@ -0,0 +1,435 @@
+#pragma once
+
+// simd_common.hpp: Portable SIMD pack abstraction.
+// pack<T, N> holds N lanes of T and exposes arithmetic, FMA, comparisons (returning
+// mask<T, N>), blends, masked loads/stores and horizontal reductions. Every operation
+// forwards to detail::pack_ops<T, N>: the primary template below is a plain scalar loop,
+// simd_float.hpp / simd_double.hpp / simd_int.hpp specialize it with SSE2, AVX(2) and AVX-512
+// intrinsics for the widths the translation unit was compiled for. Kernels are written once
+// against pack and compiled per target; the ISA-named inline namespace keeps builds for
+// different targets from colliding when they are linked into one binary.
+//
+//   using P = pack<double>;                          // widest native width
+//   for (; i + P::lanes <= n; i += P::lanes)
+//       fma(P(alpha), P::loadu(x + i), P::loadu(y + i)).storeu(y + i);
+
+#include <senkaid/utils/config/root.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if defined(SENKAID_HAS_SSE2) || defined(SENKAID_HAS_AVX) || defined(SENKAID_HAS_AVX512)
+    #include <immintrin.h>
+#endif
+
+// SENKAID_SIMD_WIDTH: Widest native vector register in bits (0 for scalar builds).
+// SENKAID_SIMD_ABI: Inline namespace the pack types live in for this target.
+#if defined(SENKAID_HAS_AVX512)
+    #define SENKAID_SIMD_WIDTH 512
+    #define SENKAID_SIMD_ABI avx512
+#elif defined(SENKAID_HAS_AVX)
+    #define SENKAID_SIMD_WIDTH 256
+    #define SENKAID_SIMD_ABI avx
+#elif defined(SENKAID_HAS_SSE2)
+    #define SENKAID_SIMD_WIDTH 128
+    #define SENKAID_SIMD_ABI sse2
+#else
+    #define SENKAID_SIMD_WIDTH 0
+    #define SENKAID_SIMD_ABI scalar
+#endif
+
+namespace senkaid::backend::simd::inline SENKAID_SIMD_ABI
+{
+
+// native_bytes: Width of the widest native vector register (one element size for scalar builds).
+inline constexpr std::size_t native_bytes = SENKAID_SIMD_WIDTH / 8;
+
+// native_lanes: Lanes of T in one native register (at least one).
+template <typename T>
+inline constexpr std::size_t native_lanes = native_bytes / sizeof(T) > 0 ? native_bytes / sizeof(T) : 1;
+
+namespace detail
+{
+
+// pack_ops: Operation table behind pack<T, N>. Generic version: N scalars, bit-per-lane masks.
+// ISA files specialize it with the register type in `reg` and the mask type in `mreg`.
+template <typename T, std::size_t N>
+struct pack_ops
+{
+    static_assert(N > 0 && N <= 64, "pack: lane count must be in [1, 64]");
+
+    struct reg
+    {
+        T v[N];
+    };
+    using mreg = std::uint64_t;
+
+    static constexpr bool native = false;
+
+    static SENKAID_FORCE_INLINE reg zero() noexcept { return broadcast(T(0)); }
+
+    static SENKAID_FORCE_INLINE reg broadcast(T s) noexcept
+    {
+        reg r;
+        for (std::size_t i = 0; i < N; ++i)
+            r.v[i] = s;
+        return r;
+    }
+
+    static SENKAID_FORCE_INLINE reg load(const T* p) noexcept { return loadu(p); }
+
+    static SENKAID_FORCE_INLINE reg loadu(const T* p) noexcept
+    {
+        reg r;
+        for (std::size_t i = 0; i < N; ++i)
+            r.v[i] = p[i];
+        return r;
+    }
+
+    static SENKAID_FORCE_INLINE void store(T* p, reg a) noexcept { storeu(p, a); }
+
+    static SENKAID_FORCE_INLINE void storeu(T* p, reg a) noexcept
+    {
+        for (std::size_t i = 0; i < N; ++i)
+            p[i] = a.v[i];
+    }
+
+    static SENKAID_FORCE_INLINE reg mask_load(const T* p, mreg m) noexcept
+    {
+        reg r;
+        for (std::size_t i = 0; i < N; ++i)
+            r.v[i] = (m >> i) & 1 ? p[i] : T(0);
+        return r;
+    }
+
+    static SENKAID_FORCE_INLINE void mask_store(T* p, mreg m, reg a) noexcept
+    {
+        for (std::size_t i = 0; i < N; ++i)
+            if ((m >> i) & 1)
+                p[i] = a.v[i];
+    }
+
+    template <typename Fn>
+    static SENKAID_FORCE_INLINE reg map(reg a, reg b, Fn fn) noexcept
+    {
+        reg r;
+        for (std::size_t i = 0; i < N; ++i)
+            r.v[i] = fn(a.v[i], b.v[i]);
+        return r;
+    }
+
+    template <typename Fn>
+    static SENKAID_FORCE_INLINE mreg test(reg a, reg b, Fn fn) noexcept
+    {
+        mreg m = 0;
+        for (std::size_t i = 0; i < N; ++i)
+            m |= static_cast<mreg>(fn(a.v[i], b.v[i])) << i;
+        return m;
+    }
+
+    static SENKAID_FORCE_INLINE reg add(reg a, reg b) noexcept { return map(a, b, [](T x, T y) { return T(x + y); }); }
+    static SENKAID_FORCE_INLINE reg sub(reg a, reg b) noexcept { return map(a, b, [](T x, T y) { return T(x - y); }); }
+    static SENKAID_FORCE_INLINE reg mul(reg a, reg b) noexcept { return map(a, b, [](T x, T y) { return T(x * y); }); }
+    static SENKAID_FORCE_INLINE reg div(reg a, reg b) noexcept { return map(a, b, [](T x, T y) { return T(x / y); }); }
+    static SENKAID_FORCE_INLINE reg min(reg a, reg b) noexcept { return map(a, b, [](T x, T y) { return y < x ? y : x; }); }
+    static SENKAID_FORCE_INLINE reg max(reg a, reg b) noexcept { return map(a, b, [](T x, T y) { return x < y ? y : x; }); }
+    static SENKAID_FORCE_INLINE reg neg(reg a) noexcept { return sub(zero(), a); }
+    static SENKAID_FORCE_INLINE reg abs(reg a) noexcept { return map(a, a, [](T x, T) { return x < T(0) ? T(-x) : x; }); }
+    static SENKAID_FORCE_INLINE reg sqrt(reg a) noexcept { return map(a, a, [](T x, T) { return T(std::sqrt(x)); }); }
+
+    static SENKAID_FORCE_INLINE reg fma(reg a, reg b, reg c) noexcept
+    {
+        reg r;
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            if constexpr (std::is_floating_point_v<T>)
+                r.v[i] = std::fma(a.v[i], b.v[i], c.v[i]);
+            else
+                r.v[i] = T(a.v[i] * b.v[i] + c.v[i]);
+        }
+        return r;
+    }
+
+    static SENKAID_FORCE_INLINE reg fms(reg a, reg b, reg c) noexcept { return fma(a, b, neg(c)); }
+    static SENKAID_FORCE_INLINE reg fnma(reg a, reg b, reg c) noexcept { return fma(neg(a), b, c); }
+
+    static SENKAID_FORCE_INLINE mreg eq(reg a, reg b) noexcept { return test(a, b, [](T x, T y) { return x == y; }); }
+    static SENKAID_FORCE_INLINE mreg ne(reg a, reg b) noexcept { return test(a, b, [](T x, T y) { return x != y; }); }
+    static SENKAID_FORCE_INLINE mreg lt(reg a, reg b) noexcept { return test(a, b, [](T x, T y) { return x < y; }); }
+    static SENKAID_FORCE_INLINE mreg le(reg a, reg b) noexcept { return test(a, b, [](T x, T y) { return x <= y; }); }
+    static SENKAID_FORCE_INLINE mreg gt(reg a, reg b) noexcept { return test(a, b, [](T x, T y) { return x > y; }); }
+    static SENKAID_FORCE_INLINE mreg ge(reg a, reg b) noexcept { return test(a, b, [](T x, T y) { return x >= y; }); }
+
+    static SENKAID_FORCE_INLINE reg select(mreg m, reg a, reg b) noexcept
+    {
+        reg r;
+        for (std::size_t i = 0; i < N; ++i)
+            r.v[i] = (m >> i) & 1 ? a.v[i] : b.v[i];
+        return r;
+    }
+
+    static constexpr mreg full = N == 64 ? ~mreg(0) : (mreg(1) << N) - 1;
+
+    static SENKAID_FORCE_INLINE mreg mask_and(mreg a, mreg b) noexcept { return a & b; }
+    static SENKAID_FORCE_INLINE mreg mask_or(mreg a, mreg b) noexcept { return a | b; }
+    static SENKAID_FORCE_INLINE mreg mask_xor(mreg a, mreg b) noexcept { return a ^ b; }
+    static SENKAID_FORCE_INLINE mreg mask_not(mreg a) noexcept { return ~a & full; }
+    static SENKAID_FORCE_INLINE std::uint64_t mask_bits(mreg m) noexcept { return m; }
+    static SENKAID_FORCE_INLINE mreg mask_from_bits(std::uint64_t bits) noexcept { return bits & full; }
+
+    // Building blocks of simd_math.hpp (floating-point T only).
+    static SENKAID_FORCE_INLINE reg round(reg a) noexcept { return map(a, a, [](T x, T) { return T(std::nearbyint(x)); }); }
+    static SENKAID_FORCE_INLINE reg ldexp(reg a, reg n) noexcept { return map(a, n, [](T x, T e) { return T(std::ldexp(x, static_cast<int>(e))); }); }
+    static SENKAID_FORCE_INLINE reg exponent(reg a) noexcept { return map(a, a, [](T x, T) { return T(std::ilogb(x)); }); }
+    static SENKAID_FORCE_INLINE reg mantissa(reg a) noexcept { return map(a, a, [](T x, T) { return T(std::fabs(std::scalbn(x, -std::ilogb(x)))); }); }
+    static SENKAID_FORCE_INLINE reg rsqrt_estimate(reg a) noexcept { return map(a, a, [](T x, T) { return T(T(1) / std::sqrt(x)); }); }
+
+    static SENKAID_FORCE_INLINE T get(reg a, std::size_t i) noexcept { return a.v[i]; }
+
+    static SENKAID_FORCE_INLINE T reduce_add(reg a) noexcept
+    {
+        T s = a.v[0];
+        for (std::size_t i = 1; i < N; ++i)
+            s += a.v[i];
+        return s;
+    }
+
+    static SENKAID_FORCE_INLINE T reduce_min(reg a) noexcept
+    {
+        T s = a.v[0];
+        for (std::size_t i = 1; i < N; ++i)
+            s = a.v[i] < s ? a.v[i] : s;
+        return s;
+    }
+
+    static SENKAID_FORCE_INLINE T reduce_max(reg a) noexcept
+    {
+        T s = a.v[0];
+        for (std::size_t i = 1; i < N; ++i)
+            s = s < a.v[i] ? a.v[i] : s;
+        return s;
+    }
+};
+
+} // namespace detail
+
+// mask: Per-lane predicate produced by pack comparisons and consumed by select / masked memory ops.
+template <typename T, std::size_t N = native_lanes<T>>
+class mask
+{
+public:
+    using ops = detail::pack_ops<T, N>;
+    using register_type = typename ops::mreg;
+
+    static constexpr std::size_t lanes = N;
+
+    mask() = default;
+    SENKAID_FORCE_INLINE explicit mask(register_type m) noexcept : _m(m) {}
+
+    // first_n: Lanes [0, n) set; the usual tail mask for the last partial vector of a loop.
+    static SENKAID_FORCE_INLINE mask first_n(std::size_t n) noexcept
+    {
+        return mask(ops::mask_from_bits(n >= 64 ? ~std::uint64_t(0) : (std::uint64_t(1) << n) - 1));
+    }
+
+    static SENKAID_FORCE_INLINE mask from_bits(std::uint64_t bits) noexcept { return mask(ops::mask_from_bits(bits)); }
+    static SENKAID_FORCE_INLINE mask all_set() noexcept { return first_n(N); }
+    static SENKAID_FORCE_INLINE mask none_set() noexcept { return first_n(0); }
+
+    // bits: Lane i of the mask in bit i.
+    SENKAID_FORCE_INLINE std::uint64_t bits() const noexcept { return ops::mask_bits(_m); }
+    SENKAID_FORCE_INLINE bool any() const noexcept { return bits() != 0; }
+    SENKAID_FORCE_INLINE bool all() const noexcept { return bits() == ops::mask_bits(all_set()._m); }
+    SENKAID_FORCE_INLINE bool none() const noexcept { return bits() == 0; }
+    SENKAID_FORCE_INLINE std::size_t count() const noexcept { return static_cast<std::size_t>(__builtin_popcountll(bits())); }
+    SENKAID_FORCE_INLINE bool operator[](std::size_t i) const noexcept { return (bits() >> i) & 1; }
+
+    SENKAID_FORCE_INLINE register_type reg() const noexcept { return _m; }
+
+    friend SENKAID_FORCE_INLINE mask operator&(mask a, mask b) noexcept { return mask(ops::mask_and(a._m, b._m)); }
+    friend SENKAID_FORCE_INLINE mask operator|(mask a, mask b) noexcept { return mask(ops::mask_or(a._m, b._m)); }
+    friend SENKAID_FORCE_INLINE mask operator^(mask a, mask b) noexcept { return mask(ops::mask_xor(a._m, b._m)); }
+    friend SENKAID_FORCE_INLINE mask operator~(mask a) noexcept { return mask(ops::mask_not(a._m)); }
+
+private:
+    register_type _m;
+};
+
+// pack: N lanes of T. Default-constructed packs are uninitialized, like the registers they model.
+template <typename T, std::size_t N = native_lanes<T>>
+class pack
+{
+public:
+    using ops = detail::pack_ops<T, N>;
+    using value_type = T;
+    using register_type = typename ops::reg;
+    using mask_type = mask<T, N>;
+
+    static constexpr std::size_t lanes = N;
+
+    // native: True when the operations map to vector instructions for this target.
+    static constexpr bool native = ops::native;
+
+    // alignment: Byte alignment load() / store() require.
+    static constexpr std::size_t alignment = native ? sizeof(register_type) : alignof(T);
+
+    pack() = default;
+    SENKAID_FORCE_INLINE pack(T scalar) noexcept : _r(ops::broadcast(scalar)) {}
+    SENKAID_FORCE_INLINE explicit pack(register_type r) noexcept : _r(r) {}
+
+    static SENKAID_FORCE_INLINE pack zero() noexcept { return pack(ops::zero()); }
+
+    // load / store: `p` must be `alignment` aligned; loadu / storeu accept any address.
+    static SENKAID_FORCE_INLINE pack load(const T* p) noexcept { return pack(ops::load(p)); }
+    static SENKAID_FORCE_INLINE pack loadu(const T* p) noexcept { return pack(ops::loadu(p)); }
+
+    // load (masked): Inactive lanes read as zero and their memory is not touched.
+    static SENKAID_FORCE_INLINE pack load(const T* p, mask_type m) noexcept { return pack(ops::mask_load(p, m.reg())); }
+
+    SENKAID_FORCE_INLINE void store(T* p) const noexcept { ops::store(p, _r); }
+    SENKAID_FORCE_INLINE void storeu(T* p) const noexcept { ops::storeu(p, _r); }
+
+    // store (masked): Writes only the active lanes.
+    SENKAID_FORCE_INLINE void store(T* p, mask_type m) const noexcept { ops::mask_store(p, m.reg(), _r); }
+
+    SENKAID_FORCE_INLINE T operator[](std::size_t i) const noexcept { return ops::get(_r, i); }
+    SENKAID_FORCE_INLINE register_type reg() const noexcept { return _r; }
+
+    SENKAID_FORCE_INLINE pack& operator+=(pack b) noexcept { _r = ops::add(_r, b._r); return *this; }
+    SENKAID_FORCE_INLINE pack& operator-=(pack b) noexcept { _r = ops::sub(_r, b._r); return *this; }
+    SENKAID_FORCE_INLINE pack& operator*=(pack b) noexcept { _r = ops::mul(_r, b._r); return *this; }
+    SENKAID_FORCE_INLINE pack& operator/=(pack b) noexcept { _r = ops::div(_r, b._r); return *this; }
+
+    friend SENKAID_FORCE_INLINE pack operator+(pack a, pack b) noexcept { return pack(ops::add(a._r, b._r)); }
+    friend SENKAID_FORCE_INLINE pack operator-(pack a, pack b) noexcept { return pack(ops::sub(a._r, b._r)); }
+    friend SENKAID_FORCE_INLINE pack operator*(pack a, pack b) noexcept { return pack(ops::mul(a._r, b._r)); }
+    friend SENKAID_FORCE_INLINE pack operator/(pack a, pack b) noexcept { return pack(ops::div(a._r, b._r)); }
+    friend SENKAID_FORCE_INLINE pack operator-(pack a) noexcept { return pack(ops::neg(a._r)); }
+
+    friend SENKAID_FORCE_INLINE mask_type operator==(pack a, pack b) noexcept { return mask_type(ops::eq(a._r, b._r)); }
+    friend SENKAID_FORCE_INLINE mask_type operator!=(pack a, pack b) noexcept { return mask_type(ops::ne(a._r, b._r)); }
+    friend SENKAID_FORCE_INLINE mask_type operator<(pack a, pack b) noexcept { return mask_type(ops::lt(a._r, b._r)); }
+    friend SENKAID_FORCE_INLINE mask_type operator<=(pack a, pack b) noexcept { return mask_type(ops::le(a._r, b._r)); }
+    friend SENKAID_FORCE_INLINE mask_type operator>(pack a, pack b) noexcept { return mask_type(ops::gt(a._r, b._r)); }
+    friend SENKAID_FORCE_INLINE mask_type operator>=(pack a, pack b) noexcept { return mask_type(ops::ge(a._r, b._r)); }
+
+private:
+    register_type _r;
+};
+
+// fma: a * b + c, fused where the target has FMA.
+template <typename T, std::size_t N>
+SENKAID_FORCE_INLINE pack<T, N> fma(pack<T, N> a, pack<T, N> b, pack<T, N> c) noexcept
+{
+    return pack<T, N>(pack<T, N>::ops::fma(a.reg(), b.reg(), c.reg()));
+}
+
+// fms: a * b - c.
+template <typename T, std::size_t N>
+SENKAID_FORCE_INLINE pack<T, N> fms(pack<T, N> a, pack<T, N> b, pack<T, N> c) noexcept
+{
+    return pack<T, N>(pack<T, N>::ops::fms(a.reg(), b.reg(), c.reg()));
+}
+
+// fnma: c - a * b.
+template <typename T, std::size_t N>
+SENKAID_FORCE_INLINE pack<T, N> fnma(pack<T, N> a, pack<T, N> b, pack<T, N> c) noexcept
+{
+    return pack<T, N>(pack<T, N>::ops::fnma(a.reg(), b.reg(), c.reg()));
+}
+
+template <typename T, std::size_t N>
+SENKAID_FORCE_INLINE pack<T, N> min(pack<T, N> a, pack<T, N> b) noexcept
+{
+    return pack<T, N>(pack<T, N>::ops::min(a.reg(), b.reg()));
+}
+
+template <typename T, std::size_t N>
+SENKAID_FORCE_INLINE pack<T, N> max(pack<T, N> a, pack<T, N> b) noexcept
+{
+    return pack<T, N>(pack<T, N>::ops::max(a.reg(), b.reg()));
+}
+
+template <typename T, std::size_t N>
+SENKAID_FORCE_INLINE pack<T, N> abs(pack<T, N> a) noexcept
+{
+    return pack<T, N>(pack<T, N>::ops::abs(a.reg()));
+}
+
+template <typename T, std::size_t N>
+SENKAID_FORCE_INLINE pack<T, N> sqrt(pack<T, N> a) noexcept
+{
+    return pack<T, N>(pack<T, N>::ops::sqrt(a.reg()));
+}
+
+// round: Nearest integral value, ties to even.
+template <typename T, std::size_t N>
+SENKAID_FORCE_INLINE pack<T, N> round(pack<T, N> a) noexcept
+{
+    return pack<T, N>(pack<T, N>::ops::round(a.reg()));
+}
+
+// ldexp: a * 2^n for integral-valued n. Exact unless the result is subnormal or out of range;
+// |n| is clamped to 2044 (double) / 252 (float) on the SSE/AVX paths.
+template <typename T, std::size_t N>
+SENKAID_FORCE_INLINE pack<T, N> ldexp(pack<T, N> a, pack<T, N> n) noexcept
+{
+    return pack<T, N>(pack<T, N>::ops::ldexp(a.reg(), n.reg()));
+}
+
+// exponent / mantissa: |a| = mantissa(a) * 2^exponent(a) with mantissa in [1, 2).
+// Defined for finite non-zero a; subnormal inputs are only exact with AVX-512 and the scalar table.
+template <typename T, std::size_t N>
+SENKAID_FORCE_INLINE pack<T, N> exponent(pack<T, N> a) noexcept
+{
+    return pack<T, N>(pack<T, N>::ops::exponent(a.reg()));
+}
+
+template <typename T, std::size_t N>
+SENKAID_FORCE_INLINE pack<T, N> mantissa(pack<T, N> a) noexcept
+{
+    return pack<T, N>(pack<T, N>::ops::mantissa(a.reg()));
+}
+
+// rsqrt_estimate: Approximate 1 / sqrt(a): 12 bits (SSE/AVX float), 14 bits (AVX-512), exact elsewhere.
+template <typename T, std::size_t N>
+SENKAID_FORCE_INLINE pack<T, N> rsqrt_estimate(pack<T, N> a) noexcept
+{
+    return pack<T, N>(pack<T, N>::ops::rsqrt_estimate(a.reg()));
+}
+
+// select: Blend; lanes of `a` where m is set, lanes of `b` elsewhere.
+template <typename T, std::size_t N>
+SENKAID_FORCE_INLINE pack<T, N> select(mask<T, N> m, pack<T, N> a, pack<T, N> b) noexcept
+{
+    return pack<T, N>(pack<T, N>::ops::select(m.reg(), a.reg(), b.reg()));
+}
+
+// reduce_add / reduce_min / reduce_max: Horizontal reductions over all lanes.
+template <typename T, std::size_t N>
+SENKAID_FORCE_INLINE T reduce_add(pack<T, N> a) noexcept
+{
+    return pack<T, N>::ops::reduce_add(a.reg());
+}
+
+template <typename T, std::size_t N>
+SENKAID_FORCE_INLINE T reduce_min(pack<T, N> a) noexcept
+{
+    return pack<T, N>::ops::reduce_min(a.reg());
+}
+
+template <typename T, std::size_t N>
+SENKAID_FORCE_INLINE T reduce_max(pack<T, N> a) noexcept
+{
+    return pack<T, N>::ops::reduce_max(a.reg());
+}
+
+} // namespace senkaid::backend::simd::inline SENKAID_SIMD_ABI
+
+// ISA specializations of detail::pack_ops.
+#include "simd_float.hpp"
+#include "simd_double.hpp"
+#include "simd_int.hpp"
@@ -0,0 +1,538 @@
+#pragma once
+
+// simd_complex.hpp: Complex packs on interleaved (re, im, re, im, ...) storage.
+// cpack<T, N> holds N complex numbers in one pack<T, 2N>, which is how complex arrays are laid
+// out in memory, so loads and stores need no shuffles. The products use the usual duplicate-and-
+// swap scheme: a * b = fmaddsub(a, re(b), swap(a) * im(b)), where fmaddsub subtracts in the real
+// lanes and adds in the imaginary ones (one instruction with FMA3 / AVX-512, addsub on SSE3 and
+// AVX). For reductions (dot products) it is cheaper still to accumulate x * y and x * swap(y)
+// lane-wise and combine the lanes once at the end; see core/complex/complex_simd.hpp.
+//
+// Lane shuffles live in detail::complex_ops<T, W> (W = real lanes), specialized per ISA like
+// pack_ops; the generic version goes through memory.
+
+#include <senkaid/utils/config/root.hpp>
+#include "simd_common.hpp"
+#include "simd_math.hpp"
+
+#include <cstddef>
+#include <limits>
+
+namespace senkaid::backend::simd::inline SENKAID_SIMD_ABI
+{
+
+namespace detail
+{
+
+// complex_ops: Pairwise lane operations on W real lanes holding W / 2 complex numbers.
+template <typename T, std::size_t W>
+struct complex_ops
+{
+    using base = pack_ops<T, W>;
+    using reg = typename base::reg;
+
+    template <typename Fn>
+    static SENKAID_FORCE_INLINE reg pairwise(reg a, reg b, Fn fn) noexcept
+    {
+        T va[W], vb[W], vr[W];
+        base::storeu(va, a);
+        base::storeu(vb, b);
+        for (std::size_t i = 0; i < W; i += 2)
+            fn(va[i], va[i + 1], vb[i], vb[i + 1], vr[i], vr[i + 1]);
+        return base::loadu(vr);
+    }
+
+    // dup_real / dup_imag: (re, re) / (im, im) in every pair.
+    static SENKAID_FORCE_INLINE reg dup_real(reg a) noexcept
+    {
+        return pairwise(a, a, [](T re, T, T, T, T& r0, T& r1) { r0 = r1 = re; });
+    }
+
+    static SENKAID_FORCE_INLINE reg dup_imag(reg a) noexcept
+    {
+        return pairwise(a, a, [](T, T im, T, T, T& r0, T& r1) { r0 = r1 = im; });
+    }
+
+    // swap: (im, re) in every pair.
+    static SENKAID_FORCE_INLINE reg swap(reg a) noexcept
+    {
+        return pairwise(a, a, [](T re, T im, T, T, T& r0, T& r1) { r0 = im; r1 = re; });
+    }
+
+    // conj: Negates the imaginary lanes.
+    static SENKAID_FORCE_INLINE reg conj(reg a) noexcept
+    {
+        return pairwise(a, a, [](T re, T im, T, T, T& r0, T& r1) { r0 = re; r1 = -im; });
+    }
+
+    // addsub: a - b in the real lanes, a + b in the imaginary lanes.
+    static SENKAID_FORCE_INLINE reg addsub(reg a, reg b) noexcept
+    {
+        return pairwise(a, b, [](T a0, T a1, T b0, T b1, T& r0, T& r1) { r0 = a0 - b0; r1 = a1 + b1; });
+    }
+
+    // fmaddsub: a * b - c in the real lanes, a * b + c in the imaginary lanes.
+    static SENKAID_FORCE_INLINE reg fmaddsub(reg a, reg b, reg c) noexcept
+    {
+        return addsub(base::mul(a, b), c);
+    }
+
+    // deinterleave: Two interleaved registers to W real parts and W imaginary parts, in order.
+    static SENKAID_FORCE_INLINE void deinterleave(reg a, reg b, reg& re, reg& im) noexcept
+    {
+        T v[2 * W], vr[W], vi[W];
+        base::storeu(v, a);
+        base::storeu(v + W, b);
+        for (std::size_t i = 0; i < W; ++i)
+        {
+            vr[i] = v[2 * i];
+            vi[i] = v[2 * i + 1];
+        }
+        re = base::loadu(vr);
+        im = base::loadu(vi);
+    }
+
+    // interleave: Inverse of deinterleave.
+    static SENKAID_FORCE_INLINE void interleave(reg re, reg im, reg& a, reg& b) noexcept
+    {
+        T v[2 * W], vr[W], vi[W];
+        base::storeu(vr, re);
+        base::storeu(vi, im);
+        for (std::size_t i = 0; i < W; ++i)
+        {
+            v[2 * i] = vr[i];
+            v[2 * i + 1] = vi[i];
+        }
+        a = base::loadu(v);
+        b = base::loadu(v + W);
+    }
+};
+
+#if defined(SENKAID_HAS_SSE2)
+
+template <>
+struct complex_ops<double, 2>
+{
+    using reg = __m128d;
+
+    static SENKAID_FORCE_INLINE reg dup_real(reg a) noexcept { return _mm_unpacklo_pd(a, a); }
+    static SENKAID_FORCE_INLINE reg dup_imag(reg a) noexcept { return _mm_unpackhi_pd(a, a); }
+    static SENKAID_FORCE_INLINE reg swap(reg a) noexcept { return _mm_shuffle_pd(a, a, 0x1); }
+    static SENKAID_FORCE_INLINE reg conj(reg a) noexcept { return _mm_xor_pd(a, _mm_set_pd(-0.0, 0.0)); }
+
+    static SENKAID_FORCE_INLINE reg addsub(reg a, reg b) noexcept
+    {
+#if defined(SENKAID_HAS_SSE4_2)
+        return _mm_addsub_pd(a, b);
+#else
+        return _mm_add_pd(a, _mm_xor_pd(b, _mm_set_pd(0.0, -0.0)));
+#endif
+    }
+
+    static SENKAID_FORCE_INLINE reg fmaddsub(reg a, reg b, reg c) noexcept
+    {
+#if defined(SENKAID_HAS_FMA)
+        return _mm_fmaddsub_pd(a, b, c);
+#else
+        return addsub(_mm_mul_pd(a, b), c);
+#endif
+    }
+
+    static SENKAID_FORCE_INLINE void deinterleave(reg a, reg b, reg& re, reg& im) noexcept
+    {
+        re = _mm_unpacklo_pd(a, b);
+        im = _mm_unpackhi_pd(a, b);
+    }
+
+    static SENKAID_FORCE_INLINE void interleave(reg re, reg im, reg& a, reg& b) noexcept
+    {
+        a = _mm_unpacklo_pd(re, im);
+        b = _mm_unpackhi_pd(re, im);
+    }
+};
+
+template <>
+struct complex_ops<float, 4>
+{
+    using reg = __m128;
+
+    static SENKAID_FORCE_INLINE reg dup_real(reg a) noexcept { return _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 2, 0, 0)); }
+    static SENKAID_FORCE_INLINE reg dup_imag(reg a) noexcept { return _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 3, 1, 1)); }
+    static SENKAID_FORCE_INLINE reg swap(reg a) noexcept { return _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)); }
+    static SENKAID_FORCE_INLINE reg conj(reg a) noexcept { return _mm_xor_ps(a, _mm_set_ps(-0.0f, 0.0f, -0.0f, 0.0f)); }
+
+    static SENKAID_FORCE_INLINE reg addsub(reg a, reg b) noexcept
+    {
+#if defined(SENKAID_HAS_SSE4_2)
+        return _mm_addsub_ps(a, b);
+#else
+        return _mm_add_ps(a, _mm_xor_ps(b, _mm_set_ps(0.0f, -0.0f, 0.0f, -0.0f)));
+#endif
+    }
+
+    static SENKAID_FORCE_INLINE reg fmaddsub(reg a, reg b, reg c) noexcept
+    {
+#if defined(SENKAID_HAS_FMA)
+        return _mm_fmaddsub_ps(a, b, c);
+#else
+        return addsub(_mm_mul_ps(a, b), c);
+#endif
+    }
+
+    static SENKAID_FORCE_INLINE void deinterleave(reg a, reg b, reg& re, reg& im) noexcept
+    {
+        re = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+        im = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+    }
+
+    static SENKAID_FORCE_INLINE void interleave(reg re, reg im, reg& a, reg& b) noexcept
+    {
+        a = _mm_unpacklo_ps(re, im);
+        b = _mm_unpackhi_ps(re, im);
+    }
+};
+
+#endif // SENKAID_HAS_SSE2
+
+#if defined(SENKAID_HAS_AVX)
+
+template <>
+struct complex_ops<double, 4>
+{
+    using reg = __m256d;
+
+    static SENKAID_FORCE_INLINE reg dup_real(reg a) noexcept { return _mm256_movedup_pd(a); }
+    static SENKAID_FORCE_INLINE reg dup_imag(reg a) noexcept { return _mm256_permute_pd(a, 0xF); }
+    static SENKAID_FORCE_INLINE reg swap(reg a) noexcept { return _mm256_permute_pd(a, 0x5); }
+    static SENKAID_FORCE_INLINE reg conj(reg a) noexcept { return _mm256_xor_pd(a, _mm256_setr_pd(0.0, -0.0, 0.0, -0.0)); }
+    static SENKAID_FORCE_INLINE reg addsub(reg a, reg b) noexcept { return _mm256_addsub_pd(a, b); }
+
+    static SENKAID_FORCE_INLINE reg fmaddsub(reg a, reg b, reg c) noexcept
+    {
+#if defined(SENKAID_HAS_FMA)
+        return _mm256_fmaddsub_pd(a, b, c);
+#else
+        return _mm256_addsub_pd(_mm256_mul_pd(a, b), c);
+#endif
+    }
+
+    // Regroup 128-bit halves first so the in-lane unpacks come out in element order.
+    static SENKAID_FORCE_INLINE void deinterleave(reg a, reg b, reg& re, reg& im) noexcept
+    {
+        const reg lo = _mm256_permute2f128_pd(a, b, 0x20);
+        const reg hi = _mm256_permute2f128_pd(a, b, 0x31);
+        re = _mm256_unpacklo_pd(lo, hi);
+        im = _mm256_unpackhi_pd(lo, hi);
+    }
+
+    static SENKAID_FORCE_INLINE void interleave(reg re, reg im, reg& a, reg& b) noexcept
+    {
+        const reg lo = _mm256_unpacklo_pd(re, im);
+        const reg hi = _mm256_unpackhi_pd(re, im);
+        a = _mm256_permute2f128_pd(lo, hi, 0x20);
+        b = _mm256_permute2f128_pd(lo, hi, 0x31);
+    }
+};
+
+template <>
+struct complex_ops<float, 8>
+{
+    using reg = __m256;
+
+    static SENKAID_FORCE_INLINE reg dup_real(reg a) noexcept { return _mm256_moveldup_ps(a); }
+    static SENKAID_FORCE_INLINE reg dup_imag(reg a) noexcept { return _mm256_movehdup_ps(a); }
+    static SENKAID_FORCE_INLINE reg swap(reg a) noexcept { return _mm256_permute_ps(a, _MM_SHUFFLE(2, 3, 0, 1)); }
+
+    static SENKAID_FORCE_INLINE reg conj(reg a) noexcept
+    {
+        return _mm256_xor_ps(a, _mm256_setr_ps(0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f));
+    }
+
+    static SENKAID_FORCE_INLINE reg addsub(reg a, reg b) noexcept { return _mm256_addsub_ps(a, b); }
+
+    static SENKAID_FORCE_INLINE reg fmaddsub(reg a, reg b, reg c) noexcept
+    {
+#if defined(SENKAID_HAS_FMA)
+        return _mm256_fmaddsub_ps(a, b, c);
+#else
+        return _mm256_addsub_ps(_mm256_mul_ps(a, b), c);
+#endif
+    }
+
+    static SENKAID_FORCE_INLINE void deinterleave(reg a, reg b, reg& re, reg& im) noexcept
+    {
+        const reg lo = _mm256_permute2f128_ps(a, b, 0x20);
+        const reg hi = _mm256_permute2f128_ps(a, b, 0x31);
+        re = _mm256_shuffle_ps(lo, hi, _MM_SHUFFLE(2, 0, 2, 0));
+        im = _mm256_shuffle_ps(lo, hi, _MM_SHUFFLE(3, 1, 3, 1));
+    }
+
+    static SENKAID_FORCE_INLINE void interleave(reg re, reg im, reg& a, reg& b) noexcept
+    {
+        const reg lo = _mm256_unpacklo_ps(re, im);
+        const reg hi = _mm256_unpackhi_ps(re, im);
+        a = _mm256_permute2f128_ps(lo, hi, 0x20);
+        b = _mm256_permute2f128_ps(lo, hi, 0x31);
+    }
+};
+
+#endif // SENKAID_HAS_AVX
+
+#if defined(SENKAID_HAS_AVX512)
+
+template <>
+struct complex_ops<double, 8>
+{
+    using reg = __m512d;
+
+    static SENKAID_FORCE_INLINE reg dup_real(reg a) noexcept { return _mm512_movedup_pd(a); }
+    static SENKAID_FORCE_INLINE reg dup_imag(reg a) noexcept { return _mm512_permute_pd(a, 0xFF); }
+    static SENKAID_FORCE_INLINE reg swap(reg a) noexcept { return _mm512_permute_pd(a, 0x55); }
+    static SENKAID_FORCE_INLINE reg conj(reg a) noexcept { return _mm512_mask_blend_pd(0xAA, a, pack_ops<double, 8>::neg(a)); }
+
+    // Masked subtract over the real lanes of a full add: no addsub instruction on AVX-512.
+    static SENKAID_FORCE_INLINE reg addsub(reg a, reg b) noexcept
+    {
+        return _mm512_mask_sub_pd(_mm512_add_pd(a, b), 0x55, a, b);
+    }
+
+    static SENKAID_FORCE_INLINE reg fmaddsub(reg a, reg b, reg c) noexcept { return _mm512_fmaddsub_pd(a, b, c); }
+
+    static SENKAID_FORCE_INLINE void deinterleave(reg a, reg b, reg& re, reg& im) noexcept
+    {
+        re = _mm512_permutex2var_pd(a, _mm512_setr_epi64(0, 2, 4, 6, 8, 10, 12, 14), b);
+        im = _mm512_permutex2var_pd(a, _mm512_setr_epi64(1, 3, 5, 7, 9, 11, 13, 15), b);
+    }
+
+    static SENKAID_FORCE_INLINE void interleave(reg re, reg im, reg& a, reg& b) noexcept
+    {
+        a = _mm512_permutex2var_pd(re, _mm512_setr_epi64(0, 8, 1, 9, 2, 10, 3, 11), im);
+        b = _mm512_permutex2var_pd(re, _mm512_setr_epi64(4, 12, 5, 13, 6, 14, 7, 15), im);
+    }
+};
+
+template <>
+struct complex_ops<float, 16>
+{
+    using reg = __m512;
+
+    static SENKAID_FORCE_INLINE reg dup_real(reg a) noexcept { return _mm512_moveldup_ps(a); }
+    static SENKAID_FORCE_INLINE reg dup_imag(reg a) noexcept { return _mm512_movehdup_ps(a); }
+    static SENKAID_FORCE_INLINE reg swap(reg a) noexcept { return _mm512_permute_ps(a, _MM_SHUFFLE(2, 3, 0, 1)); }
+    static SENKAID_FORCE_INLINE reg conj(reg a) noexcept { return _mm512_mask_blend_ps(0xAAAA, a, pack_ops<float, 16>::neg(a)); }
+
+    static SENKAID_FORCE_INLINE reg addsub(reg a, reg b) noexcept
+    {
+        return _mm512_mask_sub_ps(_mm512_add_ps(a, b), 0x5555, a, b);
+    }
+
+    static SENKAID_FORCE_INLINE reg fmaddsub(reg a, reg b, reg c) noexcept { return _mm512_fmaddsub_ps(a, b, c); }
+
+    static SENKAID_FORCE_INLINE void deinterleave(reg a, reg b, reg& re, reg& im) noexcept
+    {
+        re = _mm512_permutex2var_ps(a, _mm512_setr_epi32(0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30), b);
+        im = _mm512_permutex2var_ps(a, _mm512_setr_epi32(1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21, 23, 25, 27, 29, 31), b);
+    }
+
+    static SENKAID_FORCE_INLINE void interleave(reg re, reg im, reg& a, reg& b) noexcept
+    {
+        a = _mm512_permutex2var_ps(re, _mm512_setr_epi32(0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23), im);
+        b = _mm512_permutex2var_ps(re, _mm512_setr_epi32(8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31), im);
+    }
+};
+
+#endif // SENKAID_HAS_AVX512
+
+} // namespace detail
+
+// native_complex_lanes: Complex numbers in one native register (at least one).
+template <typename T>
+inline constexpr std::size_t native_complex_lanes = native_lanes<T> >= 2 ? native_lanes<T> / 2 : 1;
+
+// cpack: N complex numbers of T, interleaved in a pack<T, 2N>.
+template <typename T, std::size_t N = native_complex_lanes<T>>
+class cpack
+{
+public:
+    using value_type = T;
+    using real_pack = pack<T, 2 * N>;
+    using ops = detail::complex_ops<T, 2 * N>;
+
+    static constexpr std::size_t lanes = N;
+    static constexpr std::size_t alignment = real_pack::alignment;
+
+    cpack() = default;
+    SENKAID_FORCE_INLINE explicit cpack(real_pack v) noexcept : _v(v) {}
+
+    // Broadcast of re + i im to every lane.
+    SENKAID_FORCE_INLINE cpack(T re, T im = T(0)) noexcept
+    {
+        T v[2 * N];
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            v[2 * i] = re;
+            v[2 * i + 1] = im;
+        }
+        _v = real_pack::loadu(v);
+    }
+
+    static SENKAID_FORCE_INLINE cpack zero() noexcept { return cpack(real_pack::zero()); }
+
+    // load / store: `p` points at interleaved (re, im) pairs; load() / store() need `alignment`.
+    static SENKAID_FORCE_INLINE cpack load(const T* p) noexcept { return cpack(real_pack::load(p)); }
+    static SENKAID_FORCE_INLINE cpack loadu(const T* p) noexcept { return cpack(real_pack::loadu(p)); }
+
+    // load (partial): The first `count` complex numbers; the rest read as zero and are not touched.
+    static SENKAID_FORCE_INLINE cpack load(const T* p, std::size_t count) noexcept
+    {
+        return cpack(real_pack::load(p, real_pack::mask_type::first_n(2 * count)));
+    }
+
+    SENKAID_FORCE_INLINE void store(T* p) const noexcept { _v.store(p); }
+    SENKAID_FORCE_INLINE void storeu(T* p) const noexcept { _v.storeu(p); }
+
+    // store (partial): Writes only the first `count` complex numbers.
+    SENKAID_FORCE_INLINE void store(T* p, std::size_t count) const noexcept
+    {
+        _v.store(p, real_pack::mask_type::first_n(2 * count));
+    }
+
+    SENKAID_FORCE_INLINE real_pack value() const noexcept { return _v; }
+
+    friend SENKAID_FORCE_INLINE cpack operator+(cpack a, cpack b) noexcept { return cpack(a._v + b._v); }
+    friend SENKAID_FORCE_INLINE cpack operator-(cpack a, cpack b) noexcept { return cpack(a._v - b._v); }
+    friend SENKAID_FORCE_INLINE cpack operator-(cpack a) noexcept { return cpack(-a._v); }
+
+    // Complex product: (ar br - ai bi, ai br + ar bi).
+    friend SENKAID_FORCE_INLINE cpack operator*(cpack a, cpack b) noexcept
+    {
+        const auto t = real_pack::ops::mul(ops::swap(a._v.reg()), ops::dup_imag(b._v.reg()));
+        return cpack(real_pack(ops::fmaddsub(a._v.reg(), ops::dup_real(b._v.reg()), t)));
+    }
+
+    SENKAID_FORCE_INLINE cpack& operator+=(cpack b) noexcept { _v += b._v; return *this; }
+    SENKAID_FORCE_INLINE cpack& operator-=(cpack b) noexcept { _v -= b._v; return *this; }
+    SENKAID_FORCE_INLINE cpack& operator*=(cpack b) noexcept { return *this = *this * b; }
+
+private:
+    real_pack _v;
+};
+
+// conj: Complex conjugate of every lane.
+template <typename T, std::size_t N>
+SENKAID_FORCE_INLINE cpack<T, N> conj(cpack<T, N> a) noexcept
+{
+    return cpack<T, N>(pack<T, 2 * N>(cpack<T, N>::ops::conj(a.value().reg())));
+}
+
+// swap: (im, re) in every lane, as a real pack.
+template <typename T, std::size_t N>
+SENKAID_FORCE_INLINE pack<T, 2 * N> swap(cpack<T, N> a) noexcept
+{
+    return pack<T, 2 * N>(cpack<T, N>::ops::swap(a.value().reg()));
+}
+
+// real / imag: Real or imaginary part of every lane, duplicated into both halves of its pair.
+template <typename T, std::size_t N>
+SENKAID_FORCE_INLINE pack<T, 2 * N> real(cpack<T, N> a) noexcept
+{
+    return pack<T, 2 * N>(cpack<T, N>::ops::dup_real(a.value().reg()));
+}
+
+template <typename T, std::size_t N>
+SENKAID_FORCE_INLINE pack<T, 2 * N> imag(cpack<T, N> a) noexcept
+{
+    return pack<T, 2 * N>(cpack<T, N>::ops::dup_imag(a.value().reg()));
+}
+
+// mul_conj: conj(a) * b = (ar br + ai bi, ar bi - ai br).
+template <typename T, std::size_t N>
+SENKAID_FORCE_INLINE cpack<T, N> mul_conj(cpack<T, N> a, cpack<T, N> b) noexcept
+{
+    return conj(a) * b;
+}
+
+// fma: a * b + c.
+template <typename T, std::size_t N>
+SENKAID_FORCE_INLINE cpack<T, N> fma(cpack<T, N> a, cpack<T, N> b, cpack<T, N> c) noexcept
+{
+    using P = pack<T, 2 * N>;
+    using ops = typename cpack<T, N>::ops;
+
+    // re(b) a + c, then addsub in im(b) * swap(a): one rounding fewer than (a * b) + c.
+    const P t = fma(a.value(), P(ops::dup_real(b.value().reg())), c.value());
+    const P u = P(ops::dup_imag(b.value().reg())) * swap(a);
+    return cpack<T, N>(P(ops::addsub(t.reg(), u.reg())));
+}
+
+// scale: a * s for a real s (or a pack of per-pair real factors).
+template <typename T, std::size_t N>
+SENKAID_FORCE_INLINE cpack<T, N> scale(cpack<T, N> a, pack<T, 2 * N> s) noexcept
+{
+    return cpack<T, N>(a.value() * s);
+}
+
+// norm: |a|^2 of every lane, duplicated into both halves of its pair.
+template <typename T, std::size_t N>
+SENKAID_FORCE_INLINE pack<T, 2 * N> norm(cpack<T, N> a) noexcept
+{
+    const pack<T, 2 * N> sq = a.value() * a.value();
+    return sq + pack<T, 2 * N>(cpack<T, N>::ops::swap(sq.reg()));
+}
+
+// reduce_add: Sum of all lanes.
+template <typename T, std::size_t N>
+SENKAID_FORCE_INLINE void reduce_add(cpack<T, N> a, T& re, T& im) noexcept
+{
+    T v[2 * N];
+    a.value().storeu(v);
+    re = T(0);
+    im = T(0);
+    for (std::size_t i = 0; i < 2 * N; i += 2)
+    {
+        re += v[i];
+        im += v[i + 1];
+    }
+}
+
+// deinterleave: 2N complex numbers in a, b to their 2N real and 2N imaginary parts, in order.
+template <typename T, std::size_t N>
+SENKAID_FORCE_INLINE void deinterleave(cpack<T, N> a, cpack<T, N> b, pack<T, 2 * N>& re, pack<T, 2 * N>& im) noexcept
+{
+    typename pack<T, 2 * N>::register_type r, i;
+    cpack<T, N>::ops::deinterleave(a.value().reg(), b.value().reg(), r, i);
+    re = pack<T, 2 * N>(r);
+    im = pack<T, 2 * N>(i);
+}
+
+// interleave: Inverse of deinterleave.
+template <typename T, std::size_t N>
+SENKAID_FORCE_INLINE void interleave(pack<T, 2 * N> re, pack<T, 2 * N> im, cpack<T, N>& a, cpack<T, N>& b) noexcept
+{
+    typename pack<T, 2 * N>::register_type x, y;
+    cpack<T, N>::ops::interleave(re.reg(), im.reg(), x, y);
+    a = cpack<T, N>(pack<T, 2 * N>(x));
+    b = cpack<T, N>(pack<T, 2 * N>(y));
+}
+
+// hypot: sqrt(re^2 + im^2) lane-wise without intermediate overflow or underflow; as std::hypot,
+// an infinite argument gives inf even if the other is NaN. Used for |z| on split parts.
+template <typename T, std::size_t N>
+SENKAID_FORCE_INLINE pack<T, N> hypot(pack<T, N> re, pack<T, N> im) noexcept
+{
+    using P = pack<T, N>;
+    constexpr T inf = std::numeric_limits<T>::infinity();
+
+    const P ar = abs(re);
+    const P ai = abs(im);
+    const P hi = max(ar, ai);
+    const P lo = min(ar, ai);
+    const P r = lo / hi;
+    P y = hi * sqrt(fma(r, r, P(T(1))));
+
+    y = select(hi == P::zero(), P::zero(), y);
+    y = select((re != re) | (im != im), re + im, y);
+    return select((ar == P(inf)) | (ai == P(inf)), P(inf), y);
+}
+
+} // namespace senkaid::backend::simd::inline SENKAID_SIMD_ABI
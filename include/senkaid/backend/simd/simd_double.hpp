@@ -0,0 +1,370 @@
+#pragma once
+
+// simd_double.hpp: pack_ops specializations for double.
+// pack<double, 2> maps to SSE2, pack<double, 4> to AVX, pack<double, 8> to AVX-512F, each only
+// when the translation unit is compiled for that ISA; other widths keep the scalar table.
+// AVX-512 masks are k-registers (__mmask8); narrower ISAs use all-ones lanes in a vector.
+
+#include "simd_common.hpp"
+
+namespace senkaid::backend::simd::inline SENKAID_SIMD_ABI::detail
+{
+
+#if defined(SENKAID_HAS_SSE2)
+
+template <>
+struct pack_ops<double, 2>
+{
+    using reg = __m128d;
+    using mreg = __m128d;
+
+    static constexpr bool native = true;
+
+    static SENKAID_FORCE_INLINE reg zero() noexcept { return _mm_setzero_pd(); }
+    static SENKAID_FORCE_INLINE reg broadcast(double s) noexcept { return _mm_set1_pd(s); }
+    static SENKAID_FORCE_INLINE reg load(const double* p) noexcept { return _mm_load_pd(p); }
+    static SENKAID_FORCE_INLINE reg loadu(const double* p) noexcept { return _mm_loadu_pd(p); }
+    static SENKAID_FORCE_INLINE void store(double* p, reg a) noexcept { _mm_store_pd(p, a); }
+    static SENKAID_FORCE_INLINE void storeu(double* p, reg a) noexcept { _mm_storeu_pd(p, a); }
+
+    // SSE2 has no masked moves; touch only the active elements.
+    static SENKAID_FORCE_INLINE reg mask_load(const double* p, mreg m) noexcept
+    {
+        const int bits = _mm_movemask_pd(m);
+        return _mm_set_pd(bits & 2 ? p[1] : 0.0, bits & 1 ? p[0] : 0.0);
+    }
+
+    static SENKAID_FORCE_INLINE void mask_store(double* p, mreg m, reg a) noexcept
+    {
+        const int bits = _mm_movemask_pd(m);
+        if (bits & 1)
+            _mm_storel_pd(p, a);
+        if (bits & 2)
+            _mm_storeh_pd(p + 1, a);
+    }
+
+    static SENKAID_FORCE_INLINE reg add(reg a, reg b) noexcept { return _mm_add_pd(a, b); }
+    static SENKAID_FORCE_INLINE reg sub(reg a, reg b) noexcept { return _mm_sub_pd(a, b); }
+    static SENKAID_FORCE_INLINE reg mul(reg a, reg b) noexcept { return _mm_mul_pd(a, b); }
+    static SENKAID_FORCE_INLINE reg div(reg a, reg b) noexcept { return _mm_div_pd(a, b); }
+    static SENKAID_FORCE_INLINE reg min(reg a, reg b) noexcept { return _mm_min_pd(a, b); }
+    static SENKAID_FORCE_INLINE reg max(reg a, reg b) noexcept { return _mm_max_pd(a, b); }
+    static SENKAID_FORCE_INLINE reg neg(reg a) noexcept { return _mm_xor_pd(a, _mm_set1_pd(-0.0)); }
+    static SENKAID_FORCE_INLINE reg abs(reg a) noexcept { return _mm_andnot_pd(_mm_set1_pd(-0.0), a); }
+    static SENKAID_FORCE_INLINE reg sqrt(reg a) noexcept { return _mm_sqrt_pd(a); }
+
+#if defined(SENKAID_HAS_FMA)
+    static SENKAID_FORCE_INLINE reg fma(reg a, reg b, reg c) noexcept { return _mm_fmadd_pd(a, b, c); }
+    static SENKAID_FORCE_INLINE reg fms(reg a, reg b, reg c) noexcept { return _mm_fmsub_pd(a, b, c); }
+    static SENKAID_FORCE_INLINE reg fnma(reg a, reg b, reg c) noexcept { return _mm_fnmadd_pd(a, b, c); }
+#else
+    static SENKAID_FORCE_INLINE reg fma(reg a, reg b, reg c) noexcept { return _mm_add_pd(_mm_mul_pd(a, b), c); }
+    static SENKAID_FORCE_INLINE reg fms(reg a, reg b, reg c) noexcept { return _mm_sub_pd(_mm_mul_pd(a, b), c); }
+    static SENKAID_FORCE_INLINE reg fnma(reg a, reg b, reg c) noexcept { return _mm_sub_pd(c, _mm_mul_pd(a, b)); }
+#endif
+
+    static SENKAID_FORCE_INLINE mreg eq(reg a, reg b) noexcept { return _mm_cmpeq_pd(a, b); }
+    static SENKAID_FORCE_INLINE mreg ne(reg a, reg b) noexcept { return _mm_cmpneq_pd(a, b); }
+    static SENKAID_FORCE_INLINE mreg lt(reg a, reg b) noexcept { return _mm_cmplt_pd(a, b); }
+    static SENKAID_FORCE_INLINE mreg le(reg a, reg b) noexcept { return _mm_cmple_pd(a, b); }
+    static SENKAID_FORCE_INLINE mreg gt(reg a, reg b) noexcept { return _mm_cmpgt_pd(a, b); }
+    static SENKAID_FORCE_INLINE mreg ge(reg a, reg b) noexcept { return _mm_cmpge_pd(a, b); }
+
+    static SENKAID_FORCE_INLINE reg select(mreg m, reg a, reg b) noexcept
+    {
+        return _mm_or_pd(_mm_and_pd(m, a), _mm_andnot_pd(m, b));
+    }
+
+    static SENKAID_FORCE_INLINE mreg mask_and(mreg a, mreg b) noexcept { return _mm_and_pd(a, b); }
+    static SENKAID_FORCE_INLINE mreg mask_or(mreg a, mreg b) noexcept { return _mm_or_pd(a, b); }
+    static SENKAID_FORCE_INLINE mreg mask_xor(mreg a, mreg b) noexcept { return _mm_xor_pd(a, b); }
+    static SENKAID_FORCE_INLINE mreg mask_not(mreg a) noexcept { return _mm_xor_pd(a, _mm_castsi128_pd(_mm_set1_epi32(-1))); }
+    static SENKAID_FORCE_INLINE std::uint64_t mask_bits(mreg m) noexcept { return static_cast<std::uint64_t>(_mm_movemask_pd(m)); }
+
+    static SENKAID_FORCE_INLINE mreg mask_from_bits(std::uint64_t bits) noexcept
+    {
+        return _mm_castsi128_pd(_mm_set_epi64x(-static_cast<long long>((bits >> 1) & 1), -static_cast<long long>(bits & 1)));
+    }
+
+    // round: SSE4.1 rounds directly; SSE2 adds 2^52 to |a| so the FPU drops the fraction.
+    static SENKAID_FORCE_INLINE reg round(reg a) noexcept
+    {
+#if defined(SENKAID_HAS_SSE4_2)
+        return _mm_round_pd(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+#else
+        const reg two52 = _mm_set1_pd(4503599627370496.0);
+        const reg mag = abs(a);
+        const reg r = _mm_or_pd(_mm_sub_pd(_mm_add_pd(mag, two52), two52), _mm_and_pd(a, _mm_set1_pd(-0.0)));
+        return select(_mm_cmplt_pd(mag, two52), r, a);
+#endif
+    }
+
+    // pow2: 2^k for integral k in [-1022, 1023]; k + (1.5 * 2^52 + 1023) leaves the biased
+    // exponent in the low mantissa bits, which the shift moves into place.
+    static SENKAID_FORCE_INLINE reg pow2(reg k) noexcept
+    {
+        return _mm_castsi128_pd(_mm_slli_epi64(_mm_castpd_si128(_mm_add_pd(k, _mm_set1_pd(6755399441056767.0))), 52));
+    }
+
+    // ldexp: Two power-of-two factors so every n in [-2044, 2044] stays representable.
+    static SENKAID_FORCE_INLINE reg ldexp(reg a, reg n) noexcept
+    {
+        n = _mm_min_pd(_mm_max_pd(n, _mm_set1_pd(-2044.0)), _mm_set1_pd(2044.0));
+        const reg n1 = round(_mm_mul_pd(n, _mm_set1_pd(0.5)));
+        return _mm_mul_pd(_mm_mul_pd(a, pow2(n1)), pow2(_mm_sub_pd(n, n1)));
+    }
+
+    static SENKAID_FORCE_INLINE reg exponent(reg a) noexcept
+    {
+        const reg two52 = _mm_set1_pd(4503599627370496.0);
+        const __m128i e = _mm_srli_epi64(_mm_castpd_si128(abs(a)), 52);
+        return _mm_sub_pd(_mm_or_pd(_mm_castsi128_pd(e), two52), _mm_set1_pd(4503599627371519.0));
+    }
+
+    static SENKAID_FORCE_INLINE reg mantissa(reg a) noexcept
+    {
+        return _mm_or_pd(_mm_and_pd(a, _mm_castsi128_pd(_mm_set1_epi64x(0x000FFFFFFFFFFFFFLL))), _mm_set1_pd(1.0));
+    }
+
+    static SENKAID_FORCE_INLINE reg rsqrt_estimate(reg a) noexcept { return _mm_div_pd(_mm_set1_pd(1.0), _mm_sqrt_pd(a)); }
+
+    static SENKAID_FORCE_INLINE double get(reg a, std::size_t i) noexcept
+    {
+        alignas(16) double v[2];
+        _mm_store_pd(v, a);
+        return v[i];
+    }
+
+    static SENKAID_FORCE_INLINE double reduce_add(reg a) noexcept { return _mm_cvtsd_f64(_mm_add_sd(a, _mm_unpackhi_pd(a, a))); }
+    static SENKAID_FORCE_INLINE double reduce_min(reg a) noexcept { return _mm_cvtsd_f64(_mm_min_sd(a, _mm_unpackhi_pd(a, a))); }
+    static SENKAID_FORCE_INLINE double reduce_max(reg a) noexcept { return _mm_cvtsd_f64(_mm_max_sd(a, _mm_unpackhi_pd(a, a))); }
+};
+
+#endif // SENKAID_HAS_SSE2
+
+#if defined(SENKAID_HAS_AVX)
+
+template <>
+struct pack_ops<double, 4>
+{
+    using reg = __m256d;
+    using mreg = __m256d;
+
+    static constexpr bool native = true;
+
+    static SENKAID_FORCE_INLINE reg zero() noexcept { return _mm256_setzero_pd(); }
+    static SENKAID_FORCE_INLINE reg broadcast(double s) noexcept { return _mm256_set1_pd(s); }
+    static SENKAID_FORCE_INLINE reg load(const double* p) noexcept { return _mm256_load_pd(p); }
+    static SENKAID_FORCE_INLINE reg loadu(const double* p) noexcept { return _mm256_loadu_pd(p); }
+    static SENKAID_FORCE_INLINE void store(double* p, reg a) noexcept { _mm256_store_pd(p, a); }
+    static SENKAID_FORCE_INLINE void storeu(double* p, reg a) noexcept { _mm256_storeu_pd(p, a); }
+
+    static SENKAID_FORCE_INLINE reg mask_load(const double* p, mreg m) noexcept
+    {
+        return _mm256_maskload_pd(p, _mm256_castpd_si256(m));
+    }
+
+    static SENKAID_FORCE_INLINE void mask_store(double* p, mreg m, reg a) noexcept
+    {
+        _mm256_maskstore_pd(p, _mm256_castpd_si256(m), a);
+    }
+
+    static SENKAID_FORCE_INLINE reg add(reg a, reg b) noexcept { return _mm256_add_pd(a, b); }
+    static SENKAID_FORCE_INLINE reg sub(reg a, reg b) noexcept { return _mm256_sub_pd(a, b); }
+    static SENKAID_FORCE_INLINE reg mul(reg a, reg b) noexcept { return _mm256_mul_pd(a, b); }
+    static SENKAID_FORCE_INLINE reg div(reg a, reg b) noexcept { return _mm256_div_pd(a, b); }
+    static SENKAID_FORCE_INLINE reg min(reg a, reg b) noexcept { return _mm256_min_pd(a, b); }
+    static SENKAID_FORCE_INLINE reg max(reg a, reg b) noexcept { return _mm256_max_pd(a, b); }
+    static SENKAID_FORCE_INLINE reg neg(reg a) noexcept { return _mm256_xor_pd(a, _mm256_set1_pd(-0.0)); }
+    static SENKAID_FORCE_INLINE reg abs(reg a) noexcept { return _mm256_andnot_pd(_mm256_set1_pd(-0.0), a); }
+    static SENKAID_FORCE_INLINE reg sqrt(reg a) noexcept { return _mm256_sqrt_pd(a); }
+
+#if defined(SENKAID_HAS_FMA)
+    static SENKAID_FORCE_INLINE reg fma(reg a, reg b, reg c) noexcept { return _mm256_fmadd_pd(a, b, c); }
+    static SENKAID_FORCE_INLINE reg fms(reg a, reg b, reg c) noexcept { return _mm256_fmsub_pd(a, b, c); }
+    static SENKAID_FORCE_INLINE reg fnma(reg a, reg b, reg c) noexcept { return _mm256_fnmadd_pd(a, b, c); }
+#else
+    static SENKAID_FORCE_INLINE reg fma(reg a, reg b, reg c) noexcept { return _mm256_add_pd(_mm256_mul_pd(a, b), c); }
+    static SENKAID_FORCE_INLINE reg fms(reg a, reg b, reg c) noexcept { return _mm256_sub_pd(_mm256_mul_pd(a, b), c); }
+    static SENKAID_FORCE_INLINE reg fnma(reg a, reg b, reg c) noexcept { return _mm256_sub_pd(c, _mm256_mul_pd(a, b)); }
+#endif
+
+    static SENKAID_FORCE_INLINE mreg eq(reg a, reg b) noexcept { return _mm256_cmp_pd(a, b, _CMP_EQ_OQ); }
+    static SENKAID_FORCE_INLINE mreg ne(reg a, reg b) noexcept { return _mm256_cmp_pd(a, b, _CMP_NEQ_UQ); }
+    static SENKAID_FORCE_INLINE mreg lt(reg a, reg b) noexcept { return _mm256_cmp_pd(a, b, _CMP_LT_OQ); }
+    static SENKAID_FORCE_INLINE mreg le(reg a, reg b) noexcept { return _mm256_cmp_pd(a, b, _CMP_LE_OQ); }
+    static SENKAID_FORCE_INLINE mreg gt(reg a, reg b) noexcept { return _mm256_cmp_pd(a, b, _CMP_GT_OQ); }
+    static SENKAID_FORCE_INLINE mreg ge(reg a, reg b) noexcept { return _mm256_cmp_pd(a, b, _CMP_GE_OQ); }
+
+    static SENKAID_FORCE_INLINE reg select(mreg m, reg a, reg b) noexcept { return _mm256_blendv_pd(b, a, m); }
+
+    static SENKAID_FORCE_INLINE mreg mask_and(mreg a, mreg b) noexcept { return _mm256_and_pd(a, b); }
+    static SENKAID_FORCE_INLINE mreg mask_or(mreg a, mreg b) noexcept { return _mm256_or_pd(a, b); }
+    static SENKAID_FORCE_INLINE mreg mask_xor(mreg a, mreg b) noexcept { return _mm256_xor_pd(a, b); }
+    static SENKAID_FORCE_INLINE mreg mask_not(mreg a) noexcept { return _mm256_xor_pd(a, _mm256_castsi256_pd(_mm256_set1_epi32(-1))); }
+    static SENKAID_FORCE_INLINE std::uint64_t mask_bits(mreg m) noexcept { return static_cast<std::uint64_t>(_mm256_movemask_pd(m)); }
+
+    static SENKAID_FORCE_INLINE mreg mask_from_bits(std::uint64_t bits) noexcept
+    {
+        return _mm256_castsi256_pd(_mm256_set_epi64x(-static_cast<long long>((bits >> 3) & 1), -static_cast<long long>((bits >> 2) & 1),
+                                                     -static_cast<long long>((bits >> 1) & 1), -static_cast<long long>(bits & 1)));
+    }
+
+    static SENKAID_FORCE_INLINE reg round(reg a) noexcept
+    {
+        return _mm256_round_pd(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    }
+
+    // 64-bit lane shifts; plain AVX has no 256-bit integer ops, so split into SSE2 halves.
+    template <int S>
+    static SENKAID_FORCE_INLINE __m256i shift_left(__m256i v) noexcept
+    {
+#if defined(SENKAID_HAS_AVX2)
+        return _mm256_slli_epi64(v, S);
+#else
+        return _mm256_insertf128_si256(_mm256_castsi128_si256(_mm_slli_epi64(_mm256_castsi256_si128(v), S)),
+                                       _mm_slli_epi64(_mm256_extractf128_si256(v, 1), S), 1);
+#endif
+    }
+
+    template <int S>
+    static SENKAID_FORCE_INLINE __m256i shift_right(__m256i v) noexcept
+    {
+#if defined(SENKAID_HAS_AVX2)
+        return _mm256_srli_epi64(v, S);
+#else
+        return _mm256_insertf128_si256(_mm256_castsi128_si256(_mm_srli_epi64(_mm256_castsi256_si128(v), S)),
+                                       _mm_srli_epi64(_mm256_extractf128_si256(v, 1), S), 1);
+#endif
+    }
+
+    // pow2: 2^k for integral k in [-1022, 1023] (see pack_ops<double, 2>::pow2).
+    static SENKAID_FORCE_INLINE reg pow2(reg k) noexcept
+    {
+        return _mm256_castsi256_pd(shift_left<52>(_mm256_castpd_si256(_mm256_add_pd(k, _mm256_set1_pd(6755399441056767.0)))));
+    }
+
+    static SENKAID_FORCE_INLINE reg ldexp(reg a, reg n) noexcept
+    {
+        n = _mm256_min_pd(_mm256_max_pd(n, _mm256_set1_pd(-2044.0)), _mm256_set1_pd(2044.0));
+        const reg n1 = round(_mm256_mul_pd(n, _mm256_set1_pd(0.5)));
+        return _mm256_mul_pd(_mm256_mul_pd(a, pow2(n1)), pow2(_mm256_sub_pd(n, n1)));
+    }
+
+    static SENKAID_FORCE_INLINE reg exponent(reg a) noexcept
+    {
+        const reg two52 = _mm256_set1_pd(4503599627370496.0);
+        const __m256i e = shift_right<52>(_mm256_castpd_si256(abs(a)));
+        return _mm256_sub_pd(_mm256_or_pd(_mm256_castsi256_pd(e), two52), _mm256_set1_pd(4503599627371519.0));
+    }
+
+    static SENKAID_FORCE_INLINE reg mantissa(reg a) noexcept
+    {
+        return _mm256_or_pd(_mm256_and_pd(a, _mm256_castsi256_pd(_mm256_set1_epi64x(0x000FFFFFFFFFFFFFLL))), _mm256_set1_pd(1.0));
+    }
+
+    static SENKAID_FORCE_INLINE reg rsqrt_estimate(reg a) noexcept { return _mm256_div_pd(_mm256_set1_pd(1.0), _mm256_sqrt_pd(a)); }
+
+    static SENKAID_FORCE_INLINE double get(reg a, std::size_t i) noexcept
+    {
+        alignas(32) double v[4];
+        _mm256_store_pd(v, a);
+        return v[i];
+    }
+
+    static SENKAID_FORCE_INLINE double reduce_add(reg a) noexcept
+    {
+        const __m128d s = _mm_add_pd(_mm256_castpd256_pd128(a), _mm256_extractf128_pd(a, 1));
+        return _mm_cvtsd_f64(_mm_add_sd(s, _mm_unpackhi_pd(s, s)));
+    }
+
+    static SENKAID_FORCE_INLINE double reduce_min(reg a) noexcept
+    {
+        const __m128d s = _mm_min_pd(_mm256_castpd256_pd128(a), _mm256_extractf128_pd(a, 1));
+        return _mm_cvtsd_f64(_mm_min_sd(s, _mm_unpackhi_pd(s, s)));
+    }
+
+    static SENKAID_FORCE_INLINE double reduce_max(reg a) noexcept
+    {
+        const __m128d s = _mm_max_pd(_mm256_castpd256_pd128(a), _mm256_extractf128_pd(a, 1));
+        return _mm_cvtsd_f64(_mm_max_sd(s, _mm_unpackhi_pd(s, s)));
+    }
+};
+
+#endif // SENKAID_HAS_AVX
+
+#if defined(SENKAID_HAS_AVX512)
+
+template <>
+struct pack_ops<double, 8>
+{
+    using reg = __m512d;
+    using mreg = __mmask8;
+
+    static constexpr bool native = true;
+
+    static SENKAID_FORCE_INLINE reg zero() noexcept { return _mm512_setzero_pd(); }
+    static SENKAID_FORCE_INLINE reg broadcast(double s) noexcept { return _mm512_set1_pd(s); }
+    static SENKAID_FORCE_INLINE reg load(const double* p) noexcept { return _mm512_load_pd(p); }
+    static SENKAID_FORCE_INLINE reg loadu(const double* p) noexcept { return _mm512_loadu_pd(p); }
+    static SENKAID_FORCE_INLINE void store(double* p, reg a) noexcept { _mm512_store_pd(p, a); }
+    static SENKAID_FORCE_INLINE void storeu(double* p, reg a) noexcept { _mm512_storeu_pd(p, a); }
+    static SENKAID_FORCE_INLINE reg mask_load(const double* p, mreg m) noexcept { return _mm512_maskz_loadu_pd(m, p); }
+    static SENKAID_FORCE_INLINE void mask_store(double* p, mreg m, reg a) noexcept { _mm512_mask_storeu_pd(p, m, a); }
+
+    static SENKAID_FORCE_INLINE reg add(reg a, reg b) noexcept { return _mm512_add_pd(a, b); }
+    static SENKAID_FORCE_INLINE reg sub(reg a, reg b) noexcept { return _mm512_sub_pd(a, b); }
+    static SENKAID_FORCE_INLINE reg mul(reg a, reg b) noexcept { return _mm512_mul_pd(a, b); }
+    static SENKAID_FORCE_INLINE reg div(reg a, reg b) noexcept { return _mm512_div_pd(a, b); }
+    static SENKAID_FORCE_INLINE reg min(reg a, reg b) noexcept { return _mm512_min_pd(a, b); }
+    static SENKAID_FORCE_INLINE reg max(reg a, reg b) noexcept { return _mm512_max_pd(a, b); }
+    static SENKAID_FORCE_INLINE reg abs(reg a) noexcept { return _mm512_abs_pd(a); }
+    static SENKAID_FORCE_INLINE reg sqrt(reg a) noexcept { return _mm512_sqrt_pd(a); }
+
+    // Sign flip through the integer domain: _mm512_xor_pd needs AVX-512DQ.
+    static SENKAID_FORCE_INLINE reg neg(reg a) noexcept
+    {
+        return _mm512_castsi512_pd(_mm512_xor_si512(_mm512_castpd_si512(a), _mm512_set1_epi64(INT64_MIN)));
+    }
+
+    static SENKAID_FORCE_INLINE reg fma(reg a, reg b, reg c) noexcept { return _mm512_fmadd_pd(a, b, c); }
+    static SENKAID_FORCE_INLINE reg fms(reg a, reg b, reg c) noexcept { return _mm512_fmsub_pd(a, b, c); }
+    static SENKAID_FORCE_INLINE reg fnma(reg a, reg b, reg c) noexcept { return _mm512_fnmadd_pd(a, b, c); }
+
+    static SENKAID_FORCE_INLINE mreg eq(reg a, reg b) noexcept { return _mm512_cmp_pd_mask(a, b, _CMP_EQ_OQ); }
+    static SENKAID_FORCE_INLINE mreg ne(reg a, reg b) noexcept { return _mm512_cmp_pd_mask(a, b, _CMP_NEQ_UQ); }
+    static SENKAID_FORCE_INLINE mreg lt(reg a, reg b) noexcept { return _mm512_cmp_pd_mask(a, b, _CMP_LT_OQ); }
+    static SENKAID_FORCE_INLINE mreg le(reg a, reg b) noexcept { return _mm512_cmp_pd_mask(a, b, _CMP_LE_OQ); }
+    static SENKAID_FORCE_INLINE mreg gt(reg a, reg b) noexcept { return _mm512_cmp_pd_mask(a, b, _CMP_GT_OQ); }
+    static SENKAID_FORCE_INLINE mreg ge(reg a, reg b) noexcept { return _mm512_cmp_pd_mask(a, b, _CMP_GE_OQ); }
+
+    static SENKAID_FORCE_INLINE reg select(mreg m, reg a, reg b) noexcept { return _mm512_mask_blend_pd(m, b, a); }
+
+    static SENKAID_FORCE_INLINE mreg mask_and(mreg a, mreg b) noexcept { return static_cast<mreg>(a & b); }
+    static SENKAID_FORCE_INLINE mreg mask_or(mreg a, mreg b) noexcept { return static_cast<mreg>(a | b); }
+    static SENKAID_FORCE_INLINE mreg mask_xor(mreg a, mreg b) noexcept { return static_cast<mreg>(a ^ b); }
+    static SENKAID_FORCE_INLINE mreg mask_not(mreg a) noexcept { return static_cast<mreg>(~a); }
+    static SENKAID_FORCE_INLINE std::uint64_t mask_bits(mreg m) noexcept { return m; }
+    static SENKAID_FORCE_INLINE mreg mask_from_bits(std::uint64_t bits) noexcept { return static_cast<mreg>(bits); }
+
+    static SENKAID_FORCE_INLINE reg round(reg a) noexcept { return _mm512_roundscale_pd(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+    static SENKAID_FORCE_INLINE reg ldexp(reg a, reg n) noexcept { return _mm512_scalef_pd(a, n); }
+    static SENKAID_FORCE_INLINE reg exponent(reg a) noexcept { return _mm512_getexp_pd(a); }
+    static SENKAID_FORCE_INLINE reg mantissa(reg a) noexcept { return _mm512_getmant_pd(a, _MM_MANT_NORM_1_2, _MM_MANT_SIGN_zero); }
+    static SENKAID_FORCE_INLINE reg rsqrt_estimate(reg a) noexcept { return _mm512_rsqrt14_pd(a); }
+
+    static SENKAID_FORCE_INLINE double get(reg a, std::size_t i) noexcept
+    {
+        alignas(64) double v[8];
+        _mm512_store_pd(v, a);
+        return v[i];
+    }
+
+    static SENKAID_FORCE_INLINE double reduce_add(reg a) noexcept { return _mm512_reduce_add_pd(a); }
+    static SENKAID_FORCE_INLINE double reduce_min(reg a) noexcept { return _mm512_reduce_min_pd(a); }
+    static SENKAID_FORCE_INLINE double reduce_max(reg a) noexcept { return _mm512_reduce_max_pd(a); }
+};
+
+#endif // SENKAID_HAS_AVX512
+
+} // namespace senkaid::backend::simd::inline SENKAID_SIMD_ABI::detail
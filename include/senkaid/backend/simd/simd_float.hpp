@@ -0,0 +1,386 @@
+#pragma once
+
+// simd_float.hpp: pack_ops specializations for float.
+// pack<float, 4> maps to SSE2, pack<float, 8> to AVX, pack<float, 16> to AVX-512F, each only
+// when the translation unit is compiled for that ISA; other widths keep the scalar table.
+// AVX-512 masks are k-registers (__mmask16); narrower ISAs use all-ones lanes in a vector.
+
+#include "simd_common.hpp"
+
+namespace senkaid::backend::simd::inline SENKAID_SIMD_ABI::detail
+{
+
+#if defined(SENKAID_HAS_SSE2)
+
+template <>
+struct pack_ops<float, 4>
+{
+    using reg = __m128;
+    using mreg = __m128;
+
+    static constexpr bool native = true;
+
+    static SENKAID_FORCE_INLINE reg zero() noexcept { return _mm_setzero_ps(); }
+    static SENKAID_FORCE_INLINE reg broadcast(float s) noexcept { return _mm_set1_ps(s); }
+    static SENKAID_FORCE_INLINE reg load(const float* p) noexcept { return _mm_load_ps(p); }
+    static SENKAID_FORCE_INLINE reg loadu(const float* p) noexcept { return _mm_loadu_ps(p); }
+    static SENKAID_FORCE_INLINE void store(float* p, reg a) noexcept { _mm_store_ps(p, a); }
+    static SENKAID_FORCE_INLINE void storeu(float* p, reg a) noexcept { _mm_storeu_ps(p, a); }
+
+    // SSE2 has no masked moves; touch only the active elements.
+    static SENKAID_FORCE_INLINE reg mask_load(const float* p, mreg m) noexcept
+    {
+        const int bits = _mm_movemask_ps(m);
+        return _mm_set_ps(bits & 8 ? p[3] : 0.0f, bits & 4 ? p[2] : 0.0f, bits & 2 ? p[1] : 0.0f, bits & 1 ? p[0] : 0.0f);
+    }
+
+    static SENKAID_FORCE_INLINE void mask_store(float* p, mreg m, reg a) noexcept
+    {
+        const int bits = _mm_movemask_ps(m);
+        alignas(16) float v[4];
+        _mm_store_ps(v, a);
+        for (int i = 0; i < 4; ++i)
+            if (bits & (1 << i))
+                p[i] = v[i];
+    }
+
+    static SENKAID_FORCE_INLINE reg add(reg a, reg b) noexcept { return _mm_add_ps(a, b); }
+    static SENKAID_FORCE_INLINE reg sub(reg a, reg b) noexcept { return _mm_sub_ps(a, b); }
+    static SENKAID_FORCE_INLINE reg mul(reg a, reg b) noexcept { return _mm_mul_ps(a, b); }
+    static SENKAID_FORCE_INLINE reg div(reg a, reg b) noexcept { return _mm_div_ps(a, b); }
+    static SENKAID_FORCE_INLINE reg min(reg a, reg b) noexcept { return _mm_min_ps(a, b); }
+    static SENKAID_FORCE_INLINE reg max(reg a, reg b) noexcept { return _mm_max_ps(a, b); }
+    static SENKAID_FORCE_INLINE reg neg(reg a) noexcept { return _mm_xor_ps(a, _mm_set1_ps(-0.0f)); }
+    static SENKAID_FORCE_INLINE reg abs(reg a) noexcept { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+    static SENKAID_FORCE_INLINE reg sqrt(reg a) noexcept { return _mm_sqrt_ps(a); }
+
+#if defined(SENKAID_HAS_FMA)
+    static SENKAID_FORCE_INLINE reg fma(reg a, reg b, reg c) noexcept { return _mm_fmadd_ps(a, b, c); }
+    static SENKAID_FORCE_INLINE reg fms(reg a, reg b, reg c) noexcept { return _mm_fmsub_ps(a, b, c); }
+    static SENKAID_FORCE_INLINE reg fnma(reg a, reg b, reg c) noexcept { return _mm_fnmadd_ps(a, b, c); }
+#else
+    static SENKAID_FORCE_INLINE reg fma(reg a, reg b, reg c) noexcept { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+    static SENKAID_FORCE_INLINE reg fms(reg a, reg b, reg c) noexcept { return _mm_sub_ps(_mm_mul_ps(a, b), c); }
+    static SENKAID_FORCE_INLINE reg fnma(reg a, reg b, reg c) noexcept { return _mm_sub_ps(c, _mm_mul_ps(a, b)); }
+#endif
+
+    static SENKAID_FORCE_INLINE mreg eq(reg a, reg b) noexcept { return _mm_cmpeq_ps(a, b); }
+    static SENKAID_FORCE_INLINE mreg ne(reg a, reg b) noexcept { return _mm_cmpneq_ps(a, b); }
+    static SENKAID_FORCE_INLINE mreg lt(reg a, reg b) noexcept { return _mm_cmplt_ps(a, b); }
+    static SENKAID_FORCE_INLINE mreg le(reg a, reg b) noexcept { return _mm_cmple_ps(a, b); }
+    static SENKAID_FORCE_INLINE mreg gt(reg a, reg b) noexcept { return _mm_cmpgt_ps(a, b); }
+    static SENKAID_FORCE_INLINE mreg ge(reg a, reg b) noexcept { return _mm_cmpge_ps(a, b); }
+
+    static SENKAID_FORCE_INLINE reg select(mreg m, reg a, reg b) noexcept
+    {
+        return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b));
+    }
+
+    static SENKAID_FORCE_INLINE mreg mask_and(mreg a, mreg b) noexcept { return _mm_and_ps(a, b); }
+    static SENKAID_FORCE_INLINE mreg mask_or(mreg a, mreg b) noexcept { return _mm_or_ps(a, b); }
+    static SENKAID_FORCE_INLINE mreg mask_xor(mreg a, mreg b) noexcept { return _mm_xor_ps(a, b); }
+    static SENKAID_FORCE_INLINE mreg mask_not(mreg a) noexcept { return _mm_xor_ps(a, _mm_castsi128_ps(_mm_set1_epi32(-1))); }
+    static SENKAID_FORCE_INLINE std::uint64_t mask_bits(mreg m) noexcept { return static_cast<std::uint64_t>(_mm_movemask_ps(m)); }
+
+    static SENKAID_FORCE_INLINE mreg mask_from_bits(std::uint64_t bits) noexcept
+    {
+        const __m128i lane = _mm_set_epi32(8, 4, 2, 1);
+        const __m128i set = _mm_and_si128(_mm_set1_epi32(static_cast<int>(bits & 0xF)), lane);
+        return _mm_castsi128_ps(_mm_cmpeq_epi32(set, lane));
+    }
+
+    // round: SSE4.1 rounds directly; SSE2 adds 2^23 to |a| so the FPU drops the fraction.
+    static SENKAID_FORCE_INLINE reg round(reg a) noexcept
+    {
+#if defined(SENKAID_HAS_SSE4_2)
+        return _mm_round_ps(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+#else
+        const reg two23 = _mm_set1_ps(8388608.0f);
+        const reg mag = abs(a);
+        const reg r = _mm_or_ps(_mm_sub_ps(_mm_add_ps(mag, two23), two23), _mm_and_ps(a, _mm_set1_ps(-0.0f)));
+        return select(_mm_cmplt_ps(mag, two23), r, a);
+#endif
+    }
+
+    // pow2: 2^k for integral k in [-126, 127]; k + (1.5 * 2^23 + 127) leaves the biased
+    // exponent in the low mantissa bits, which the shift moves into place.
+    static SENKAID_FORCE_INLINE reg pow2(reg k) noexcept
+    {
+        return _mm_castsi128_ps(_mm_slli_epi32(_mm_castps_si128(_mm_add_ps(k, _mm_set1_ps(12583039.0f))), 23));
+    }
+
+    // ldexp: Two power-of-two factors so every n in [-252, 252] stays representable.
+    static SENKAID_FORCE_INLINE reg ldexp(reg a, reg n) noexcept
+    {
+        n = _mm_min_ps(_mm_max_ps(n, _mm_set1_ps(-252.0f)), _mm_set1_ps(252.0f));
+        const reg n1 = round(_mm_mul_ps(n, _mm_set1_ps(0.5f)));
+        return _mm_mul_ps(_mm_mul_ps(a, pow2(n1)), pow2(_mm_sub_ps(n, n1)));
+    }
+
+    static SENKAID_FORCE_INLINE reg exponent(reg a) noexcept
+    {
+        const reg two23 = _mm_set1_ps(8388608.0f);
+        const __m128i e = _mm_srli_epi32(_mm_castps_si128(abs(a)), 23);
+        return _mm_sub_ps(_mm_or_ps(_mm_castsi128_ps(e), two23), _mm_set1_ps(8388735.0f));
+    }
+
+    static SENKAID_FORCE_INLINE reg mantissa(reg a) noexcept
+    {
+        return _mm_or_ps(_mm_and_ps(a, _mm_castsi128_ps(_mm_set1_epi32(0x007FFFFF))), _mm_set1_ps(1.0f));
+    }
+
+    static SENKAID_FORCE_INLINE reg rsqrt_estimate(reg a) noexcept { return _mm_rsqrt_ps(a); }
+
+    static SENKAID_FORCE_INLINE float get(reg a, std::size_t i) noexcept
+    {
+        alignas(16) float v[4];
+        _mm_store_ps(v, a);
+        return v[i];
+    }
+
+    static SENKAID_FORCE_INLINE float reduce_add(reg a) noexcept
+    {
+        const __m128 s = _mm_add_ps(a, _mm_movehl_ps(a, a));
+        return _mm_cvtss_f32(_mm_add_ss(s, _mm_shuffle_ps(s, s, 0x55)));
+    }
+
+    static SENKAID_FORCE_INLINE float reduce_min(reg a) noexcept
+    {
+        const __m128 s = _mm_min_ps(a, _mm_movehl_ps(a, a));
+        return _mm_cvtss_f32(_mm_min_ss(s, _mm_shuffle_ps(s, s, 0x55)));
+    }
+
+    static SENKAID_FORCE_INLINE float reduce_max(reg a) noexcept
+    {
+        const __m128 s = _mm_max_ps(a, _mm_movehl_ps(a, a));
+        return _mm_cvtss_f32(_mm_max_ss(s, _mm_shuffle_ps(s, s, 0x55)));
+    }
+};
+
+#endif // SENKAID_HAS_SSE2
+
+#if defined(SENKAID_HAS_AVX)
+
+template <>
+struct pack_ops<float, 8>
+{
+    using reg = __m256;
+    using mreg = __m256;
+
+    static constexpr bool native = true;
+
+    static SENKAID_FORCE_INLINE reg zero() noexcept { return _mm256_setzero_ps(); }
+    static SENKAID_FORCE_INLINE reg broadcast(float s) noexcept { return _mm256_set1_ps(s); }
+    static SENKAID_FORCE_INLINE reg load(const float* p) noexcept { return _mm256_load_ps(p); }
+    static SENKAID_FORCE_INLINE reg loadu(const float* p) noexcept { return _mm256_loadu_ps(p); }
+    static SENKAID_FORCE_INLINE void store(float* p, reg a) noexcept { _mm256_store_ps(p, a); }
+    static SENKAID_FORCE_INLINE void storeu(float* p, reg a) noexcept { _mm256_storeu_ps(p, a); }
+
+    static SENKAID_FORCE_INLINE reg mask_load(const float* p, mreg m) noexcept
+    {
+        return _mm256_maskload_ps(p, _mm256_castps_si256(m));
+    }
+
+    static SENKAID_FORCE_INLINE void mask_store(float* p, mreg m, reg a) noexcept
+    {
+        _mm256_maskstore_ps(p, _mm256_castps_si256(m), a);
+    }
+
+    static SENKAID_FORCE_INLINE reg add(reg a, reg b) noexcept { return _mm256_add_ps(a, b); }
+    static SENKAID_FORCE_INLINE reg sub(reg a, reg b) noexcept { return _mm256_sub_ps(a, b); }
+    static SENKAID_FORCE_INLINE reg mul(reg a, reg b) noexcept { return _mm256_mul_ps(a, b); }
+    static SENKAID_FORCE_INLINE reg div(reg a, reg b) noexcept { return _mm256_div_ps(a, b); }
+    static SENKAID_FORCE_INLINE reg min(reg a, reg b) noexcept { return _mm256_min_ps(a, b); }
+    static SENKAID_FORCE_INLINE reg max(reg a, reg b) noexcept { return _mm256_max_ps(a, b); }
+    static SENKAID_FORCE_INLINE reg neg(reg a) noexcept { return _mm256_xor_ps(a, _mm256_set1_ps(-0.0f)); }
+    static SENKAID_FORCE_INLINE reg abs(reg a) noexcept { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+    static SENKAID_FORCE_INLINE reg sqrt(reg a) noexcept { return _mm256_sqrt_ps(a); }
+
+#if defined(SENKAID_HAS_FMA)
+    static SENKAID_FORCE_INLINE reg fma(reg a, reg b, reg c) noexcept { return _mm256_fmadd_ps(a, b, c); }
+    static SENKAID_FORCE_INLINE reg fms(reg a, reg b, reg c) noexcept { return _mm256_fmsub_ps(a, b, c); }
+    static SENKAID_FORCE_INLINE reg fnma(reg a, reg b, reg c) noexcept { return _mm256_fnmadd_ps(a, b, c); }
+#else
+    static SENKAID_FORCE_INLINE reg fma(reg a, reg b, reg c) noexcept { return _mm256_add_ps(_mm256_mul_ps(a, b), c); }
+    static SENKAID_FORCE_INLINE reg fms(reg a, reg b, reg c) noexcept { return _mm256_sub_ps(_mm256_mul_ps(a, b), c); }
+    static SENKAID_FORCE_INLINE reg fnma(reg a, reg b, reg c) noexcept { return _mm256_sub_ps(c, _mm256_mul_ps(a, b)); }
+#endif
+
+    static SENKAID_FORCE_INLINE mreg eq(reg a, reg b) noexcept { return _mm256_cmp_ps(a, b, _CMP_EQ_OQ); }
+    static SENKAID_FORCE_INLINE mreg ne(reg a, reg b) noexcept { return _mm256_cmp_ps(a, b, _CMP_NEQ_UQ); }
+    static SENKAID_FORCE_INLINE mreg lt(reg a, reg b) noexcept { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+    static SENKAID_FORCE_INLINE mreg le(reg a, reg b) noexcept { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+    static SENKAID_FORCE_INLINE mreg gt(reg a, reg b) noexcept { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+    static SENKAID_FORCE_INLINE mreg ge(reg a, reg b) noexcept { return _mm256_cmp_ps(a, b, _CMP_GE_OQ); }
+
+    static SENKAID_FORCE_INLINE reg select(mreg m, reg a, reg b) noexcept { return _mm256_blendv_ps(b, a, m); }
+
+    static SENKAID_FORCE_INLINE mreg mask_and(mreg a, mreg b) noexcept { return _mm256_and_ps(a, b); }
+    static SENKAID_FORCE_INLINE mreg mask_or(mreg a, mreg b) noexcept { return _mm256_or_ps(a, b); }
+    static SENKAID_FORCE_INLINE mreg mask_xor(mreg a, mreg b) noexcept { return _mm256_xor_ps(a, b); }
+    static SENKAID_FORCE_INLINE mreg mask_not(mreg a) noexcept { return _mm256_xor_ps(a, _mm256_castsi256_ps(_mm256_set1_epi32(-1))); }
+    static SENKAID_FORCE_INLINE std::uint64_t mask_bits(mreg m) noexcept { return static_cast<std::uint64_t>(_mm256_movemask_ps(m)); }
+
+    static SENKAID_FORCE_INLINE mreg mask_from_bits(std::uint64_t bits) noexcept
+    {
+        const __m128i lane = _mm_set_epi32(8, 4, 2, 1);
+        const __m128i lo = _mm_and_si128(_mm_set1_epi32(static_cast<int>(bits & 0xF)), lane);
+        const __m128i hi = _mm_and_si128(_mm_set1_epi32(static_cast<int>((bits >> 4) & 0xF)), lane);
+        return _mm256_castsi256_ps(_mm256_set_m128i(_mm_cmpeq_epi32(hi, lane), _mm_cmpeq_epi32(lo, lane)));
+    }
+
+    static SENKAID_FORCE_INLINE reg round(reg a) noexcept
+    {
+        return _mm256_round_ps(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    }
+
+    // 32-bit lane shifts; plain AVX has no 256-bit integer ops, so split into SSE2 halves.
+    template <int S>
+    static SENKAID_FORCE_INLINE __m256i shift_left(__m256i v) noexcept
+    {
+#if defined(SENKAID_HAS_AVX2)
+        return _mm256_slli_epi32(v, S);
+#else
+        return _mm256_insertf128_si256(_mm256_castsi128_si256(_mm_slli_epi32(_mm256_castsi256_si128(v), S)),
+                                       _mm_slli_epi32(_mm256_extractf128_si256(v, 1), S), 1);
+#endif
+    }
+
+    template <int S>
+    static SENKAID_FORCE_INLINE __m256i shift_right(__m256i v) noexcept
+    {
+#if defined(SENKAID_HAS_AVX2)
+        return _mm256_srli_epi32(v, S);
+#else
+        return _mm256_insertf128_si256(_mm256_castsi128_si256(_mm_srli_epi32(_mm256_castsi256_si128(v), S)),
+                                       _mm_srli_epi32(_mm256_extractf128_si256(v, 1), S), 1);
+#endif
+    }
+
+    // pow2: 2^k for integral k in [-126, 127] (see pack_ops<float, 4>::pow2).
+    static SENKAID_FORCE_INLINE reg pow2(reg k) noexcept
+    {
+        return _mm256_castsi256_ps(shift_left<23>(_mm256_castps_si256(_mm256_add_ps(k, _mm256_set1_ps(12583039.0f)))));
+    }
+
+    static SENKAID_FORCE_INLINE reg ldexp(reg a, reg n) noexcept
+    {
+        n = _mm256_min_ps(_mm256_max_ps(n, _mm256_set1_ps(-252.0f)), _mm256_set1_ps(252.0f));
+        const reg n1 = round(_mm256_mul_ps(n, _mm256_set1_ps(0.5f)));
+        return _mm256_mul_ps(_mm256_mul_ps(a, pow2(n1)), pow2(_mm256_sub_ps(n, n1)));
+    }
+
+    static SENKAID_FORCE_INLINE reg exponent(reg a) noexcept
+    {
+        const reg two23 = _mm256_set1_ps(8388608.0f);
+        const __m256i e = shift_right<23>(_mm256_castps_si256(abs(a)));
+        return _mm256_sub_ps(_mm256_or_ps(_mm256_castsi256_ps(e), two23), _mm256_set1_ps(8388735.0f));
+    }
+
+    static SENKAID_FORCE_INLINE reg mantissa(reg a) noexcept
+    {
+        return _mm256_or_ps(_mm256_and_ps(a, _mm256_castsi256_ps(_mm256_set1_epi32(0x007FFFFF))), _mm256_set1_ps(1.0f));
+    }
+
+    static SENKAID_FORCE_INLINE reg rsqrt_estimate(reg a) noexcept { return _mm256_rsqrt_ps(a); }
+
+    static SENKAID_FORCE_INLINE float get(reg a, std::size_t i) noexcept
+    {
+        alignas(32) float v[8];
+        _mm256_store_ps(v, a);
+        return v[i];
+    }
+
+    static SENKAID_FORCE_INLINE float reduce_add(reg a) noexcept
+    {
+        return pack_ops<float, 4>::reduce_add(_mm_add_ps(_mm256_castps256_ps128(a), _mm256_extractf128_ps(a, 1)));
+    }
+
+    static SENKAID_FORCE_INLINE float reduce_min(reg a) noexcept
+    {
+        return pack_ops<float, 4>::reduce_min(_mm_min_ps(_mm256_castps256_ps128(a), _mm256_extractf128_ps(a, 1)));
+    }
+
+    static SENKAID_FORCE_INLINE float reduce_max(reg a) noexcept
+    {
+        return pack_ops<float, 4>::reduce_max(_mm_max_ps(_mm256_castps256_ps128(a), _mm256_extractf128_ps(a, 1)));
+    }
+};
+
+#endif // SENKAID_HAS_AVX
+
+#if defined(SENKAID_HAS_AVX512)
+
+template <>
+struct pack_ops<float, 16>
+{
+    using reg = __m512;
+    using mreg = __mmask16;
+
+    static constexpr bool native = true;
+
+    static SENKAID_FORCE_INLINE reg zero() noexcept { return _mm512_setzero_ps(); }
+    static SENKAID_FORCE_INLINE reg broadcast(float s) noexcept { return _mm512_set1_ps(s); }
+    static SENKAID_FORCE_INLINE reg load(const float* p) noexcept { return _mm512_load_ps(p); }
+    static SENKAID_FORCE_INLINE reg loadu(const float* p) noexcept { return _mm512_loadu_ps(p); }
+    static SENKAID_FORCE_INLINE void store(float* p, reg a) noexcept { _mm512_store_ps(p, a); }
+    static SENKAID_FORCE_INLINE void storeu(float* p, reg a) noexcept { _mm512_storeu_ps(p, a); }
+    static SENKAID_FORCE_INLINE reg mask_load(const float* p, mreg m) noexcept { return _mm512_maskz_loadu_ps(m, p); }
+    static SENKAID_FORCE_INLINE void mask_store(float* p, mreg m, reg a) noexcept { _mm512_mask_storeu_ps(p, m, a); }
+
+    static SENKAID_FORCE_INLINE reg add(reg a, reg b) noexcept { return _mm512_add_ps(a, b); }
+    static SENKAID_FORCE_INLINE reg sub(reg a, reg b) noexcept { return _mm512_sub_ps(a, b); }
+    static SENKAID_FORCE_INLINE reg mul(reg a, reg b) noexcept { return _mm512_mul_ps(a, b); }
+    static SENKAID_FORCE_INLINE reg div(reg a, reg b) noexcept { return _mm512_div_ps(a, b); }
+    static SENKAID_FORCE_INLINE reg min(reg a, reg b) noexcept { return _mm512_min_ps(a, b); }
+    static SENKAID_FORCE_INLINE reg max(reg a, reg b) noexcept { return _mm512_max_ps(a, b); }
+    static SENKAID_FORCE_INLINE reg abs(reg a) noexcept { return _mm512_abs_ps(a); }
+    static SENKAID_FORCE_INLINE reg sqrt(reg a) noexcept { return _mm512_sqrt_ps(a); }
+
+    // Sign flip through the integer domain: _mm512_xor_ps needs AVX-512DQ.
+    static SENKAID_FORCE_INLINE reg neg(reg a) noexcept
+    {
+        return _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(a), _mm512_set1_epi32(INT32_MIN)));
+    }
+
+    static SENKAID_FORCE_INLINE reg fma(reg a, reg b, reg c) noexcept { return _mm512_fmadd_ps(a, b, c); }
+    static SENKAID_FORCE_INLINE reg fms(reg a, reg b, reg c) noexcept { return _mm512_fmsub_ps(a, b, c); }
+    static SENKAID_FORCE_INLINE reg fnma(reg a, reg b, reg c) noexcept { return _mm512_fnmadd_ps(a, b, c); }
+
+    static SENKAID_FORCE_INLINE mreg eq(reg a, reg b) noexcept { return _mm512_cmp_ps_mask(a, b, _CMP_EQ_OQ); }
+    static SENKAID_FORCE_INLINE mreg ne(reg a, reg b) noexcept { return _mm512_cmp_ps_mask(a, b, _CMP_NEQ_UQ); }
+    static SENKAID_FORCE_INLINE mreg lt(reg a, reg b) noexcept { return _mm512_cmp_ps_mask(a, b, _CMP_LT_OQ); }
+    static SENKAID_FORCE_INLINE mreg le(reg a, reg b) noexcept { return _mm512_cmp_ps_mask(a, b, _CMP_LE_OQ); }
+    static SENKAID_FORCE_INLINE mreg gt(reg a, reg b) noexcept { return _mm512_cmp_ps_mask(a, b, _CMP_GT_OQ); }
+    static SENKAID_FORCE_INLINE mreg ge(reg a, reg b) noexcept { return _mm512_cmp_ps_mask(a, b, _CMP_GE_OQ); }
+
+    static SENKAID_FORCE_INLINE reg select(mreg m, reg a, reg b) noexcept { return _mm512_mask_blend_ps(m, b, a); }
+
+    static SENKAID_FORCE_INLINE mreg mask_and(mreg a, mreg b) noexcept { return static_cast<mreg>(a & b); }
+    static SENKAID_FORCE_INLINE mreg mask_or(mreg a, mreg b) noexcept { return static_cast<mreg>(a | b); }
+    static SENKAID_FORCE_INLINE mreg mask_xor(mreg a, mreg b) noexcept { return static_cast<mreg>(a ^ b); }
+    static SENKAID_FORCE_INLINE mreg mask_not(mreg a) noexcept { return static_cast<mreg>(~a); }
+    static SENKAID_FORCE_INLINE std::uint64_t mask_bits(mreg m) noexcept { return m; }
+    static SENKAID_FORCE_INLINE mreg mask_from_bits(std::uint64_t bits) noexcept { return static_cast<mreg>(bits); }
+
+    static SENKAID_FORCE_INLINE reg round(reg a) noexcept { return _mm512_roundscale_ps(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+    static SENKAID_FORCE_INLINE reg ldexp(reg a, reg n) noexcept { return _mm512_scalef_ps(a, n); }
+    static SENKAID_FORCE_INLINE reg exponent(reg a) noexcept { return _mm512_getexp_ps(a); }
+    static SENKAID_FORCE_INLINE reg mantissa(reg a) noexcept { return _mm512_getmant_ps(a, _MM_MANT_NORM_1_2, _MM_MANT_SIGN_zero); }
+    static SENKAID_FORCE_INLINE reg rsqrt_estimate(reg a) noexcept { return _mm512_rsqrt14_ps(a); }
+
+    static SENKAID_FORCE_INLINE float get(reg a, std::size_t i) noexcept
+    {
+        alignas(64) float v[16];
+        _mm512_store_ps(v, a);
+        return v[i];
+    }
+
+    static SENKAID_FORCE_INLINE float reduce_add(reg a) noexcept { return _mm512_reduce_add_ps(a); }
+    static SENKAID_FORCE_INLINE float reduce_min(reg a) noexcept { return _mm512_reduce_min_ps(a); }
+    static SENKAID_FORCE_INLINE float reduce_max(reg a) noexcept { return _mm512_reduce_max_ps(a); }
+};
+
+#endif // SENKAID_HAS_AVX512
+
+} // namespace senkaid::backend::simd::inline SENKAID_SIMD_ABI::detail
@@ -0,0 +1,792 @@
+#pragma once
+
+// simd_int.hpp: pack_ops specializations for int32_t / int64_t and lane-permuting helpers.
+// pack<int32_t, 4> / pack<int64_t, 2> map to SSE2 (SSE4.1 compares, min/max and 32-bit mullo when
+// available), the 8 x 32 / 4 x 64 widths to AVX2 and the 16 x 32 / 8 x 64 widths to AVX-512F.
+// AVX without AVX2 has no 256-bit integer arithmetic, so those widths keep the scalar table there.
+// Integer division has no vector instruction and goes lane by lane everywhere; 64-bit products
+// are assembled from 32 x 32 -> 64 multiplies (no AVX-512DQ requirement).
+//
+// On top of the tables this file provides the index / selection primitives that kernels for
+// argmax, count_nonzero, where and mask compaction are built from:
+//   iota<P>(s)          lanes s, s + 1, ...
+//   compress(a, m)      active lanes moved to the front in order (stream compaction)
+//   expand(a, m)        inverse of compress: the first lanes of a spread over the active lanes
+//   compress_store(p, a, m)  writes exactly m.count() elements
+//   prefix_sum(a)       inclusive scan within the register
+//   popcount(a)         per-lane bit count
+// compress / expand use vpcompress / vpexpand on AVX-512F (these are F instructions for 32- and
+// 64-bit lanes; VBMI2 only adds the 8- and 16-bit forms) and a vpermd through a 256-entry
+// index table on AVX2. float / double packs reuse the integer kernels of the same width.
+
+#include "simd_common.hpp"
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace senkaid::backend::simd::inline SENKAID_SIMD_ABI::detail
+{
+
+// lanewise_div: a / b one lane at a time through memory.
+template <typename T, std::size_t N, typename Ops>
+SENKAID_FORCE_INLINE typename Ops::reg lanewise_div(typename Ops::reg a, typename Ops::reg b) noexcept
+{
+    alignas(64) T x[N];
+    alignas(64) T y[N];
+    Ops::storeu(x, a);
+    Ops::storeu(y, b);
+    for (std::size_t i = 0; i < N; ++i)
+        x[i] = static_cast<T>(x[i] / y[i]);
+    return Ops::loadu(x);
+}
+
+#if defined(SENKAID_HAS_SSE2)
+
+template <>
+struct pack_ops<std::int32_t, 4>
+{
+    using reg = __m128i;
+    using mreg = __m128i;
+
+    static constexpr bool native = true;
+
+    static SENKAID_FORCE_INLINE reg zero() noexcept { return _mm_setzero_si128(); }
+    static SENKAID_FORCE_INLINE reg broadcast(std::int32_t s) noexcept { return _mm_set1_epi32(s); }
+    static SENKAID_FORCE_INLINE reg load(const std::int32_t* p) noexcept { return _mm_load_si128(reinterpret_cast<const __m128i*>(p)); }
+    static SENKAID_FORCE_INLINE reg loadu(const std::int32_t* p) noexcept { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+    static SENKAID_FORCE_INLINE void store(std::int32_t* p, reg a) noexcept { _mm_store_si128(reinterpret_cast<__m128i*>(p), a); }
+    static SENKAID_FORCE_INLINE void storeu(std::int32_t* p, reg a) noexcept { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), a); }
+
+    // SSE has no masked integer moves; touch only the active elements.
+    static SENKAID_FORCE_INLINE reg mask_load(const std::int32_t* p, mreg m) noexcept
+    {
+        const std::uint64_t bits = mask_bits(m);
+        alignas(16) std::int32_t v[4] = {};
+        for (std::size_t i = 0; i < 4; ++i)
+            if ((bits >> i) & 1)
+                v[i] = p[i];
+        return load(v);
+    }
+
+    static SENKAID_FORCE_INLINE void mask_store(std::int32_t* p, mreg m, reg a) noexcept
+    {
+        const std::uint64_t bits = mask_bits(m);
+        alignas(16) std::int32_t v[4];
+        store(v, a);
+        for (std::size_t i = 0; i < 4; ++i)
+            if ((bits >> i) & 1)
+                p[i] = v[i];
+    }
+
+    static SENKAID_FORCE_INLINE reg add(reg a, reg b) noexcept { return _mm_add_epi32(a, b); }
+    static SENKAID_FORCE_INLINE reg sub(reg a, reg b) noexcept { return _mm_sub_epi32(a, b); }
+
+    // mul: Low 32 bits of the product; SSE2 multiplies even and odd lanes separately.
+    static SENKAID_FORCE_INLINE reg mul(reg a, reg b) noexcept
+    {
+#if defined(SENKAID_HAS_SSE4_2)
+        return _mm_mullo_epi32(a, b);
+#else
+        const __m128i even = _mm_mul_epu32(a, b);
+        const __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+        return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, 0x08), _mm_shuffle_epi32(odd, 0x08));
+#endif
+    }
+
+    static SENKAID_FORCE_INLINE reg div(reg a, reg b) noexcept { return lanewise_div<std::int32_t, 4, pack_ops>(a, b); }
+
+#if defined(SENKAID_HAS_SSE4_2)
+    static SENKAID_FORCE_INLINE reg min(reg a, reg b) noexcept { return _mm_min_epi32(a, b); }
+    static SENKAID_FORCE_INLINE reg max(reg a, reg b) noexcept { return _mm_max_epi32(a, b); }
+    static SENKAID_FORCE_INLINE reg abs(reg a) noexcept { return _mm_abs_epi32(a); }
+#else
+    static SENKAID_FORCE_INLINE reg min(reg a, reg b) noexcept { return select(_mm_cmpgt_epi32(a, b), b, a); }
+    static SENKAID_FORCE_INLINE reg max(reg a, reg b) noexcept { return select(_mm_cmpgt_epi32(a, b), a, b); }
+
+    static SENKAID_FORCE_INLINE reg abs(reg a) noexcept
+    {
+        const __m128i s = _mm_srai_epi32(a, 31);
+        return _mm_sub_epi32(_mm_xor_si128(a, s), s);
+    }
+#endif
+
+    static SENKAID_FORCE_INLINE reg neg(reg a) noexcept { return _mm_sub_epi32(zero(), a); }
+
+    static SENKAID_FORCE_INLINE reg fma(reg a, reg b, reg c) noexcept { return add(mul(a, b), c); }
+    static SENKAID_FORCE_INLINE reg fms(reg a, reg b, reg c) noexcept { return sub(mul(a, b), c); }
+    static SENKAID_FORCE_INLINE reg fnma(reg a, reg b, reg c) noexcept { return sub(c, mul(a, b)); }
+
+    static SENKAID_FORCE_INLINE mreg eq(reg a, reg b) noexcept { return _mm_cmpeq_epi32(a, b); }
+    static SENKAID_FORCE_INLINE mreg ne(reg a, reg b) noexcept { return mask_not(eq(a, b)); }
+    static SENKAID_FORCE_INLINE mreg lt(reg a, reg b) noexcept { return _mm_cmplt_epi32(a, b); }
+    static SENKAID_FORCE_INLINE mreg le(reg a, reg b) noexcept { return mask_not(gt(a, b)); }
+    static SENKAID_FORCE_INLINE mreg gt(reg a, reg b) noexcept { return _mm_cmpgt_epi32(a, b); }
+    static SENKAID_FORCE_INLINE mreg ge(reg a, reg b) noexcept { return mask_not(lt(a, b)); }
+
+    static SENKAID_FORCE_INLINE reg select(mreg m, reg a, reg b) noexcept
+    {
+        return _mm_or_si128(_mm_and_si128(m, a), _mm_andnot_si128(m, b));
+    }
+
+    static SENKAID_FORCE_INLINE mreg mask_and(mreg a, mreg b) noexcept { return _mm_and_si128(a, b); }
+    static SENKAID_FORCE_INLINE mreg mask_or(mreg a, mreg b) noexcept { return _mm_or_si128(a, b); }
+    static SENKAID_FORCE_INLINE mreg mask_xor(mreg a, mreg b) noexcept { return _mm_xor_si128(a, b); }
+    static SENKAID_FORCE_INLINE mreg mask_not(mreg a) noexcept { return _mm_xor_si128(a, _mm_set1_epi32(-1)); }
+    static SENKAID_FORCE_INLINE std::uint64_t mask_bits(mreg m) noexcept { return static_cast<std::uint64_t>(_mm_movemask_ps(_mm_castsi128_ps(m))); }
+
+    static SENKAID_FORCE_INLINE mreg mask_from_bits(std::uint64_t bits) noexcept
+    {
+        const __m128i lane = _mm_setr_epi32(1, 2, 4, 8);
+        return _mm_cmpeq_epi32(_mm_and_si128(_mm_set1_epi32(static_cast<int>(bits)), lane), lane);
+    }
+
+    static SENKAID_FORCE_INLINE std::int32_t get(reg a, std::size_t i) noexcept
+    {
+        alignas(16) std::int32_t v[4];
+        store(v, a);
+        return v[i];
+    }
+
+    static SENKAID_FORCE_INLINE std::int32_t reduce_add(reg a) noexcept
+    {
+        a = add(a, _mm_shuffle_epi32(a, 0x4E));
+        return _mm_cvtsi128_si32(add(a, _mm_shuffle_epi32(a, 0xB1)));
+    }
+
+    static SENKAID_FORCE_INLINE std::int32_t reduce_min(reg a) noexcept
+    {
+        a = min(a, _mm_shuffle_epi32(a, 0x4E));
+        return _mm_cvtsi128_si32(min(a, _mm_shuffle_epi32(a, 0xB1)));
+    }
+
+    static SENKAID_FORCE_INLINE std::int32_t reduce_max(reg a) noexcept
+    {
+        a = max(a, _mm_shuffle_epi32(a, 0x4E));
+        return _mm_cvtsi128_si32(max(a, _mm_shuffle_epi32(a, 0xB1)));
+    }
+
+    // scan_add: Inclusive prefix sum, log2(4) shift-and-add steps.
+    static SENKAID_FORCE_INLINE reg scan_add(reg a) noexcept
+    {
+        a = add(a, _mm_slli_si128(a, 4));
+        return add(a, _mm_slli_si128(a, 8));
+    }
+};
+
+template <>
+struct pack_ops<std::int64_t, 2>
+{
+    using reg = __m128i;
+    using mreg = __m128i;
+
+    static constexpr bool native = true;
+
+    static SENKAID_FORCE_INLINE reg zero() noexcept { return _mm_setzero_si128(); }
+    static SENKAID_FORCE_INLINE reg broadcast(std::int64_t s) noexcept { return _mm_set1_epi64x(s); }
+    static SENKAID_FORCE_INLINE reg load(const std::int64_t* p) noexcept { return _mm_load_si128(reinterpret_cast<const __m128i*>(p)); }
+    static SENKAID_FORCE_INLINE reg loadu(const std::int64_t* p) noexcept { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+    static SENKAID_FORCE_INLINE void store(std::int64_t* p, reg a) noexcept { _mm_store_si128(reinterpret_cast<__m128i*>(p), a); }
+    static SENKAID_FORCE_INLINE void storeu(std::int64_t* p, reg a) noexcept { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), a); }
+
+    static SENKAID_FORCE_INLINE reg mask_load(const std::int64_t* p, mreg m) noexcept
+    {
+        const std::uint64_t bits = mask_bits(m);
+        return _mm_set_epi64x(bits & 2 ? p[1] : 0, bits & 1 ? p[0] : 0);
+    }
+
+    static SENKAID_FORCE_INLINE void mask_store(std::int64_t* p, mreg m, reg a) noexcept
+    {
+        const std::uint64_t bits = mask_bits(m);
+        if (bits & 1)
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(p), a);
+        if (bits & 2)
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(p + 1), _mm_unpackhi_epi64(a, a));
+    }
+
+    static SENKAID_FORCE_INLINE reg add(reg a, reg b) noexcept { return _mm_add_epi64(a, b); }
+    static SENKAID_FORCE_INLINE reg sub(reg a, reg b) noexcept { return _mm_sub_epi64(a, b); }
+
+    // mul: lo(a) lo(b) + (hi(a) lo(b) + lo(a) hi(b)) << 32, modulo 2^64.
+    static SENKAID_FORCE_INLINE reg mul(reg a, reg b) noexcept
+    {
+        const __m128i cross = _mm_add_epi64(_mm_mul_epu32(_mm_srli_epi64(a, 32), b), _mm_mul_epu32(a, _mm_srli_epi64(b, 32)));
+        return _mm_add_epi64(_mm_mul_epu32(a, b), _mm_slli_epi64(cross, 32));
+    }
+
+    static SENKAID_FORCE_INLINE reg div(reg a, reg b) noexcept { return lanewise_div<std::int64_t, 2, pack_ops>(a, b); }
+    static SENKAID_FORCE_INLINE reg min(reg a, reg b) noexcept { return select(gt(a, b), b, a); }
+    static SENKAID_FORCE_INLINE reg max(reg a, reg b) noexcept { return select(gt(a, b), a, b); }
+    static SENKAID_FORCE_INLINE reg neg(reg a) noexcept { return _mm_sub_epi64(zero(), a); }
+    static SENKAID_FORCE_INLINE reg abs(reg a) noexcept { return select(gt(zero(), a), neg(a), a); }
+
+    static SENKAID_FORCE_INLINE reg fma(reg a, reg b, reg c) noexcept { return add(mul(a, b), c); }
+    static SENKAID_FORCE_INLINE reg fms(reg a, reg b, reg c) noexcept { return sub(mul(a, b), c); }
+    static SENKAID_FORCE_INLINE reg fnma(reg a, reg b, reg c) noexcept { return sub(c, mul(a, b)); }
+
+    // eq / gt: SSE4.1 / SSE4.2 compare 64-bit lanes directly; SSE2 combines the 32-bit halves
+    // (signed compare of the high halves, unsigned compare of the low halves).
+    static SENKAID_FORCE_INLINE mreg eq(reg a, reg b) noexcept
+    {
+#if defined(SENKAID_HAS_SSE4_2)
+        return _mm_cmpeq_epi64(a, b);
+#else
+        const __m128i e = _mm_cmpeq_epi32(a, b);
+        return _mm_and_si128(e, _mm_shuffle_epi32(e, 0xB1));
+#endif
+    }
+
+    static SENKAID_FORCE_INLINE mreg gt(reg a, reg b) noexcept
+    {
+#if defined(SENKAID_HAS_SSE4_2)
+        return _mm_cmpgt_epi64(a, b);
+#else
+        const __m128i flip = _mm_set1_epi64x(0x80000000LL);
+        const __m128i gt_lo = _mm_cmpgt_epi32(_mm_xor_si128(a, flip), _mm_xor_si128(b, flip));
+        const __m128i r = _mm_or_si128(_mm_cmpgt_epi32(a, b), _mm_and_si128(_mm_cmpeq_epi32(a, b), _mm_shuffle_epi32(gt_lo, 0xA0)));
+        return _mm_shuffle_epi32(r, 0xF5);
+#endif
+    }
+
+    static SENKAID_FORCE_INLINE mreg ne(reg a, reg b) noexcept { return mask_not(eq(a, b)); }
+    static SENKAID_FORCE_INLINE mreg lt(reg a, reg b) noexcept { return gt(b, a); }
+    static SENKAID_FORCE_INLINE mreg le(reg a, reg b) noexcept { return mask_not(gt(a, b)); }
+    static SENKAID_FORCE_INLINE mreg ge(reg a, reg b) noexcept { return mask_not(gt(b, a)); }
+
+    static SENKAID_FORCE_INLINE reg select(mreg m, reg a, reg b) noexcept
+    {
+        return _mm_or_si128(_mm_and_si128(m, a), _mm_andnot_si128(m, b));
+    }
+
+    static SENKAID_FORCE_INLINE mreg mask_and(mreg a, mreg b) noexcept { return _mm_and_si128(a, b); }
+    static SENKAID_FORCE_INLINE mreg mask_or(mreg a, mreg b) noexcept { return _mm_or_si128(a, b); }
+    static SENKAID_FORCE_INLINE mreg mask_xor(mreg a, mreg b) noexcept { return _mm_xor_si128(a, b); }
+    static SENKAID_FORCE_INLINE mreg mask_not(mreg a) noexcept { return _mm_xor_si128(a, _mm_set1_epi32(-1)); }
+    static SENKAID_FORCE_INLINE std::uint64_t mask_bits(mreg m) noexcept { return static_cast<std::uint64_t>(_mm_movemask_pd(_mm_castsi128_pd(m))); }
+
+    static SENKAID_FORCE_INLINE mreg mask_from_bits(std::uint64_t bits) noexcept
+    {
+        return _mm_set_epi64x(-static_cast<long long>((bits >> 1) & 1), -static_cast<long long>(bits & 1));
+    }
+
+    static SENKAID_FORCE_INLINE std::int64_t get(reg a, std::size_t i) noexcept
+    {
+        alignas(16) std::int64_t v[2];
+        store(v, a);
+        return v[i];
+    }
+
+    static SENKAID_FORCE_INLINE std::int64_t reduce_add(reg a) noexcept { return _mm_cvtsi128_si64(add(a, _mm_unpackhi_epi64(a, a))); }
+    static SENKAID_FORCE_INLINE std::int64_t reduce_min(reg a) noexcept { return _mm_cvtsi128_si64(min(a, _mm_unpackhi_epi64(a, a))); }
+    static SENKAID_FORCE_INLINE std::int64_t reduce_max(reg a) noexcept { return _mm_cvtsi128_si64(max(a, _mm_unpackhi_epi64(a, a))); }
+
+    static SENKAID_FORCE_INLINE reg scan_add(reg a) noexcept { return add(a, _mm_slli_si128(a, 8)); }
+};
+
+#endif // SENKAID_HAS_SSE2
+
+#if defined(SENKAID_HAS_AVX2)
+
+// permute_table: vpermd indices for compress (Expand = false) or expand over L lanes of W dwords,
+// one byte per dword, indexed by the lane mask. 0x80 marks a dword that is zeroed.
+template <std::size_t L, std::size_t W, bool Expand>
+inline constexpr auto permute_table = [] {
+    std::array<std::uint64_t, std::size_t(1) << L> t{};
+    for (std::size_t m = 0; m < t.size(); ++m)
+    {
+        std::uint64_t e = 0x8080808080808080ULL;
+        std::size_t k = 0;
+        for (std::size_t i = 0; i < L; ++i)
+        {
+            if (!((m >> i) & 1))
+                continue;
+            for (std::size_t w = 0; w < W; ++w)
+            {
+                const std::size_t dst = (Expand ? i : k) * W + w;
+                const std::size_t src = (Expand ? k : i) * W + w;
+                e = (e & ~(std::uint64_t(0xFF) << (8 * dst))) | (std::uint64_t(src) << (8 * dst));
+            }
+            ++k;
+        }
+        t[m] = e;
+    }
+    return t;
+}();
+
+// permute_dwords: Applies one permute_table entry; the sign-extended 0x80 bytes zero their dword.
+SENKAID_FORCE_INLINE __m256i permute_dwords(__m256i a, std::uint64_t entry) noexcept
+{
+    const __m256i idx = _mm256_cvtepi8_epi32(_mm_cvtsi64_si128(static_cast<long long>(entry)));
+    return _mm256_andnot_si256(_mm256_srai_epi32(idx, 31), _mm256_permutevar8x32_epi32(a, idx));
+}
+
+// popcount_bytes: Bit count of every byte (nibble lookup through vpshufb).
+SENKAID_FORCE_INLINE __m256i popcount_bytes(__m256i a) noexcept
+{
+    const __m256i lut = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                         0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i nibble = _mm256_set1_epi8(0x0F);
+    const __m256i lo = _mm256_shuffle_epi8(lut, _mm256_and_si256(a, nibble));
+    const __m256i hi = _mm256_shuffle_epi8(lut, _mm256_and_si256(_mm256_srli_epi16(a, 4), nibble));
+    return _mm256_add_epi8(lo, hi);
+}
+
+template <>
+struct pack_ops<std::int32_t, 8>
+{
+    using reg = __m256i;
+    using mreg = __m256i;
+
+    static constexpr bool native = true;
+
+    static SENKAID_FORCE_INLINE reg zero() noexcept { return _mm256_setzero_si256(); }
+    static SENKAID_FORCE_INLINE reg broadcast(std::int32_t s) noexcept { return _mm256_set1_epi32(s); }
+    static SENKAID_FORCE_INLINE reg load(const std::int32_t* p) noexcept { return _mm256_load_si256(reinterpret_cast<const __m256i*>(p)); }
+    static SENKAID_FORCE_INLINE reg loadu(const std::int32_t* p) noexcept { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+    static SENKAID_FORCE_INLINE void store(std::int32_t* p, reg a) noexcept { _mm256_store_si256(reinterpret_cast<__m256i*>(p), a); }
+    static SENKAID_FORCE_INLINE void storeu(std::int32_t* p, reg a) noexcept { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), a); }
+    static SENKAID_FORCE_INLINE reg mask_load(const std::int32_t* p, mreg m) noexcept { return _mm256_maskload_epi32(reinterpret_cast<const int*>(p), m); }
+    static SENKAID_FORCE_INLINE void mask_store(std::int32_t* p, mreg m, reg a) noexcept { _mm256_maskstore_epi32(reinterpret_cast<int*>(p), m, a); }
+
+    static SENKAID_FORCE_INLINE reg add(reg a, reg b) noexcept { return _mm256_add_epi32(a, b); }
+    static SENKAID_FORCE_INLINE reg sub(reg a, reg b) noexcept { return _mm256_sub_epi32(a, b); }
+    static SENKAID_FORCE_INLINE reg mul(reg a, reg b) noexcept { return _mm256_mullo_epi32(a, b); }
+    static SENKAID_FORCE_INLINE reg div(reg a, reg b) noexcept { return lanewise_div<std::int32_t, 8, pack_ops>(a, b); }
+    static SENKAID_FORCE_INLINE reg min(reg a, reg b) noexcept { return _mm256_min_epi32(a, b); }
+    static SENKAID_FORCE_INLINE reg max(reg a, reg b) noexcept { return _mm256_max_epi32(a, b); }
+    static SENKAID_FORCE_INLINE reg neg(reg a) noexcept { return _mm256_sub_epi32(zero(), a); }
+    static SENKAID_FORCE_INLINE reg abs(reg a) noexcept { return _mm256_abs_epi32(a); }
+
+    static SENKAID_FORCE_INLINE reg fma(reg a, reg b, reg c) noexcept { return add(mul(a, b), c); }
+    static SENKAID_FORCE_INLINE reg fms(reg a, reg b, reg c) noexcept { return sub(mul(a, b), c); }
+    static SENKAID_FORCE_INLINE reg fnma(reg a, reg b, reg c) noexcept { return sub(c, mul(a, b)); }
+
+    static SENKAID_FORCE_INLINE mreg eq(reg a, reg b) noexcept { return _mm256_cmpeq_epi32(a, b); }
+    static SENKAID_FORCE_INLINE mreg ne(reg a, reg b) noexcept { return mask_not(eq(a, b)); }
+    static SENKAID_FORCE_INLINE mreg lt(reg a, reg b) noexcept { return _mm256_cmpgt_epi32(b, a); }
+    static SENKAID_FORCE_INLINE mreg le(reg a, reg b) noexcept { return mask_not(gt(a, b)); }
+    static SENKAID_FORCE_INLINE mreg gt(reg a, reg b) noexcept { return _mm256_cmpgt_epi32(a, b); }
+    static SENKAID_FORCE_INLINE mreg ge(reg a, reg b) noexcept { return mask_not(gt(b, a)); }
+
+    static SENKAID_FORCE_INLINE reg select(mreg m, reg a, reg b) noexcept { return _mm256_blendv_epi8(b, a, m); }
+
+    static SENKAID_FORCE_INLINE mreg mask_and(mreg a, mreg b) noexcept { return _mm256_and_si256(a, b); }
+    static SENKAID_FORCE_INLINE mreg mask_or(mreg a, mreg b) noexcept { return _mm256_or_si256(a, b); }
+    static SENKAID_FORCE_INLINE mreg mask_xor(mreg a, mreg b) noexcept { return _mm256_xor_si256(a, b); }
+    static SENKAID_FORCE_INLINE mreg mask_not(mreg a) noexcept { return _mm256_xor_si256(a, _mm256_set1_epi32(-1)); }
+    static SENKAID_FORCE_INLINE std::uint64_t mask_bits(mreg m) noexcept { return static_cast<std::uint64_t>(_mm256_movemask_ps(_mm256_castsi256_ps(m))); }
+
+    static SENKAID_FORCE_INLINE mreg mask_from_bits(std::uint64_t bits) noexcept
+    {
+        const __m256i lane = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+        return _mm256_cmpeq_epi32(_mm256_and_si256(_mm256_set1_epi32(static_cast<int>(bits)), lane), lane);
+    }
+
+    static SENKAID_FORCE_INLINE std::int32_t get(reg a, std::size_t i) noexcept
+    {
+        alignas(32) std::int32_t v[8];
+        store(v, a);
+        return v[i];
+    }
+
+    using half = pack_ops<std::int32_t, 4>;
+
+    static SENKAID_FORCE_INLINE std::int32_t reduce_add(reg a) noexcept { return half::reduce_add(half::add(_mm256_castsi256_si128(a), _mm256_extracti128_si256(a, 1))); }
+    static SENKAID_FORCE_INLINE std::int32_t reduce_min(reg a) noexcept { return half::reduce_min(half::min(_mm256_castsi256_si128(a), _mm256_extracti128_si256(a, 1))); }
+    static SENKAID_FORCE_INLINE std::int32_t reduce_max(reg a) noexcept { return half::reduce_max(half::max(_mm256_castsi256_si128(a), _mm256_extracti128_si256(a, 1))); }
+
+    // scan_add: Scan each 128-bit half, then add the low half's total to the high half.
+    static SENKAID_FORCE_INLINE reg scan_add(reg a) noexcept
+    {
+        a = add(a, _mm256_slli_si256(a, 4));
+        a = add(a, _mm256_slli_si256(a, 8));
+        return add(a, _mm256_shuffle_epi32(_mm256_permute2x128_si256(a, a, 0x08), 0xFF));
+    }
+
+    static SENKAID_FORCE_INLINE reg compress(reg a, mreg m) noexcept { return permute_dwords(a, permute_table<8, 1, false>[mask_bits(m)]); }
+    static SENKAID_FORCE_INLINE reg expand(reg a, mreg m) noexcept { return permute_dwords(a, permute_table<8, 1, true>[mask_bits(m)]); }
+
+    // popcount: Byte counts summed per dword through two widening multiply-adds.
+    static SENKAID_FORCE_INLINE reg popcount(reg a) noexcept
+    {
+        const __m256i pairs = _mm256_maddubs_epi16(popcount_bytes(a), _mm256_set1_epi8(1));
+        return _mm256_madd_epi16(pairs, _mm256_set1_epi16(1));
+    }
+};
+
+template <>
+struct pack_ops<std::int64_t, 4>
+{
+    using reg = __m256i;
+    using mreg = __m256i;
+
+    static constexpr bool native = true;
+
+    static SENKAID_FORCE_INLINE reg zero() noexcept { return _mm256_setzero_si256(); }
+    static SENKAID_FORCE_INLINE reg broadcast(std::int64_t s) noexcept { return _mm256_set1_epi64x(s); }
+    static SENKAID_FORCE_INLINE reg load(const std::int64_t* p) noexcept { return _mm256_load_si256(reinterpret_cast<const __m256i*>(p)); }
+    static SENKAID_FORCE_INLINE reg loadu(const std::int64_t* p) noexcept { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+    static SENKAID_FORCE_INLINE void store(std::int64_t* p, reg a) noexcept { _mm256_store_si256(reinterpret_cast<__m256i*>(p), a); }
+    static SENKAID_FORCE_INLINE void storeu(std::int64_t* p, reg a) noexcept { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), a); }
+    static SENKAID_FORCE_INLINE reg mask_load(const std::int64_t* p, mreg m) noexcept { return _mm256_maskload_epi64(reinterpret_cast<const long long*>(p), m); }
+    static SENKAID_FORCE_INLINE void mask_store(std::int64_t* p, mreg m, reg a) noexcept { _mm256_maskstore_epi64(reinterpret_cast<long long*>(p), m, a); }
+
+    static SENKAID_FORCE_INLINE reg add(reg a, reg b) noexcept { return _mm256_add_epi64(a, b); }
+    static SENKAID_FORCE_INLINE reg sub(reg a, reg b) noexcept { return _mm256_sub_epi64(a, b); }
+
+    static SENKAID_FORCE_INLINE reg mul(reg a, reg b) noexcept
+    {
+        const __m256i cross = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(a, 32), b), _mm256_mul_epu32(a, _mm256_srli_epi64(b, 32)));
+        return _mm256_add_epi64(_mm256_mul_epu32(a, b), _mm256_slli_epi64(cross, 32));
+    }
+
+    static SENKAID_FORCE_INLINE reg div(reg a, reg b) noexcept { return lanewise_div<std::int64_t, 4, pack_ops>(a, b); }
+    static SENKAID_FORCE_INLINE reg min(reg a, reg b) noexcept { return select(gt(a, b), b, a); }
+    static SENKAID_FORCE_INLINE reg max(reg a, reg b) noexcept { return select(gt(a, b), a, b); }
+    static SENKAID_FORCE_INLINE reg neg(reg a) noexcept { return _mm256_sub_epi64(zero(), a); }
+    static SENKAID_FORCE_INLINE reg abs(reg a) noexcept { return select(gt(zero(), a), neg(a), a); }
+
+    static SENKAID_FORCE_INLINE reg fma(reg a, reg b, reg c) noexcept { return add(mul(a, b), c); }
+    static SENKAID_FORCE_INLINE reg fms(reg a, reg b, reg c) noexcept { return sub(mul(a, b), c); }
+    static SENKAID_FORCE_INLINE reg fnma(reg a, reg b, reg c) noexcept { return sub(c, mul(a, b)); }
+
+    static SENKAID_FORCE_INLINE mreg eq(reg a, reg b) noexcept { return _mm256_cmpeq_epi64(a, b); }
+    static SENKAID_FORCE_INLINE mreg ne(reg a, reg b) noexcept { return mask_not(eq(a, b)); }
+    static SENKAID_FORCE_INLINE mreg lt(reg a, reg b) noexcept { return _mm256_cmpgt_epi64(b, a); }
+    static SENKAID_FORCE_INLINE mreg le(reg a, reg b) noexcept { return mask_not(gt(a, b)); }
+    static SENKAID_FORCE_INLINE mreg gt(reg a, reg b) noexcept { return _mm256_cmpgt_epi64(a, b); }
+    static SENKAID_FORCE_INLINE mreg ge(reg a, reg b) noexcept { return mask_not(gt(b, a)); }
+
+    static SENKAID_FORCE_INLINE reg select(mreg m, reg a, reg b) noexcept { return _mm256_blendv_epi8(b, a, m); }
+
+    static SENKAID_FORCE_INLINE mreg mask_and(mreg a, mreg b) noexcept { return _mm256_and_si256(a, b); }
+    static SENKAID_FORCE_INLINE mreg mask_or(mreg a, mreg b) noexcept { return _mm256_or_si256(a, b); }
+    static SENKAID_FORCE_INLINE mreg mask_xor(mreg a, mreg b) noexcept { return _mm256_xor_si256(a, b); }
+    static SENKAID_FORCE_INLINE mreg mask_not(mreg a) noexcept { return _mm256_xor_si256(a, _mm256_set1_epi32(-1)); }
+    static SENKAID_FORCE_INLINE std::uint64_t mask_bits(mreg m) noexcept { return static_cast<std::uint64_t>(_mm256_movemask_pd(_mm256_castsi256_pd(m))); }
+
+    static SENKAID_FORCE_INLINE mreg mask_from_bits(std::uint64_t bits) noexcept
+    {
+        const __m256i lane = _mm256_setr_epi64x(1, 2, 4, 8);
+        return _mm256_cmpeq_epi64(_mm256_and_si256(_mm256_set1_epi64x(static_cast<long long>(bits)), lane), lane);
+    }
+
+    static SENKAID_FORCE_INLINE std::int64_t get(reg a, std::size_t i) noexcept
+    {
+        alignas(32) std::int64_t v[4];
+        store(v, a);
+        return v[i];
+    }
+
+    using half = pack_ops<std::int64_t, 2>;
+
+    static SENKAID_FORCE_INLINE std::int64_t reduce_add(reg a) noexcept { return half::reduce_add(half::add(_mm256_castsi256_si128(a), _mm256_extracti128_si256(a, 1))); }
+    static SENKAID_FORCE_INLINE std::int64_t reduce_min(reg a) noexcept { return half::reduce_min(half::min(_mm256_castsi256_si128(a), _mm256_extracti128_si256(a, 1))); }
+    static SENKAID_FORCE_INLINE std::int64_t reduce_max(reg a) noexcept { return half::reduce_max(half::max(_mm256_castsi256_si128(a), _mm256_extracti128_si256(a, 1))); }
+
+    static SENKAID_FORCE_INLINE reg scan_add(reg a) noexcept
+    {
+        a = add(a, _mm256_slli_si256(a, 8));
+        return add(a, _mm256_shuffle_epi32(_mm256_permute2x128_si256(a, a, 0x08), 0xEE));
+    }
+
+    static SENKAID_FORCE_INLINE reg compress(reg a, mreg m) noexcept { return permute_dwords(a, permute_table<4, 2, false>[mask_bits(m)]); }
+    static SENKAID_FORCE_INLINE reg expand(reg a, mreg m) noexcept { return permute_dwords(a, permute_table<4, 2, true>[mask_bits(m)]); }
+
+    static SENKAID_FORCE_INLINE reg popcount(reg a) noexcept { return _mm256_sad_epu8(popcount_bytes(a), zero()); }
+};
+
+#endif // SENKAID_HAS_AVX2
+
+#if defined(SENKAID_HAS_AVX512)
+
+template <>
+struct pack_ops<std::int32_t, 16>
+{
+    using reg = __m512i;
+    using mreg = __mmask16;
+
+    static constexpr bool native = true;
+
+    static SENKAID_FORCE_INLINE reg zero() noexcept { return _mm512_setzero_si512(); }
+    static SENKAID_FORCE_INLINE reg broadcast(std::int32_t s) noexcept { return _mm512_set1_epi32(s); }
+    static SENKAID_FORCE_INLINE reg load(const std::int32_t* p) noexcept { return _mm512_load_si512(p); }
+    static SENKAID_FORCE_INLINE reg loadu(const std::int32_t* p) noexcept { return _mm512_loadu_si512(p); }
+    static SENKAID_FORCE_INLINE void store(std::int32_t* p, reg a) noexcept { _mm512_store_si512(p, a); }
+    static SENKAID_FORCE_INLINE void storeu(std::int32_t* p, reg a) noexcept { _mm512_storeu_si512(p, a); }
+    static SENKAID_FORCE_INLINE reg mask_load(const std::int32_t* p, mreg m) noexcept { return _mm512_maskz_loadu_epi32(m, p); }
+    static SENKAID_FORCE_INLINE void mask_store(std::int32_t* p, mreg m, reg a) noexcept { _mm512_mask_storeu_epi32(p, m, a); }
+
+    static SENKAID_FORCE_INLINE reg add(reg a, reg b) noexcept { return _mm512_add_epi32(a, b); }
+    static SENKAID_FORCE_INLINE reg sub(reg a, reg b) noexcept { return _mm512_sub_epi32(a, b); }
+    static SENKAID_FORCE_INLINE reg mul(reg a, reg b) noexcept { return _mm512_mullo_epi32(a, b); }
+    static SENKAID_FORCE_INLINE reg div(reg a, reg b) noexcept { return lanewise_div<std::int32_t, 16, pack_ops>(a, b); }
+    static SENKAID_FORCE_INLINE reg min(reg a, reg b) noexcept { return _mm512_min_epi32(a, b); }
+    static SENKAID_FORCE_INLINE reg max(reg a, reg b) noexcept { return _mm512_max_epi32(a, b); }
+    static SENKAID_FORCE_INLINE reg neg(reg a) noexcept { return _mm512_sub_epi32(zero(), a); }
+    static SENKAID_FORCE_INLINE reg abs(reg a) noexcept { return _mm512_abs_epi32(a); }
+
+    static SENKAID_FORCE_INLINE reg fma(reg a, reg b, reg c) noexcept { return add(mul(a, b), c); }
+    static SENKAID_FORCE_INLINE reg fms(reg a, reg b, reg c) noexcept { return sub(mul(a, b), c); }
+    static SENKAID_FORCE_INLINE reg fnma(reg a, reg b, reg c) noexcept { return sub(c, mul(a, b)); }
+
+    static SENKAID_FORCE_INLINE mreg eq(reg a, reg b) noexcept { return _mm512_cmpeq_epi32_mask(a, b); }
+    static SENKAID_FORCE_INLINE mreg ne(reg a, reg b) noexcept { return _mm512_cmpneq_epi32_mask(a, b); }
+    static SENKAID_FORCE_INLINE mreg lt(reg a, reg b) noexcept { return _mm512_cmplt_epi32_mask(a, b); }
+    static SENKAID_FORCE_INLINE mreg le(reg a, reg b) noexcept { return _mm512_cmple_epi32_mask(a, b); }
+    static SENKAID_FORCE_INLINE mreg gt(reg a, reg b) noexcept { return _mm512_cmpgt_epi32_mask(a, b); }
+    static SENKAID_FORCE_INLINE mreg ge(reg a, reg b) noexcept { return _mm512_cmpge_epi32_mask(a, b); }
+
+    static SENKAID_FORCE_INLINE reg select(mreg m, reg a, reg b) noexcept { return _mm512_mask_blend_epi32(m, b, a); }
+
+    static SENKAID_FORCE_INLINE mreg mask_and(mreg a, mreg b) noexcept { return static_cast<mreg>(a & b); }
+    static SENKAID_FORCE_INLINE mreg mask_or(mreg a, mreg b) noexcept { return static_cast<mreg>(a | b); }
+    static SENKAID_FORCE_INLINE mreg mask_xor(mreg a, mreg b) noexcept { return static_cast<mreg>(a ^ b); }
+    static SENKAID_FORCE_INLINE mreg mask_not(mreg a) noexcept { return static_cast<mreg>(~a); }
+    static SENKAID_FORCE_INLINE std::uint64_t mask_bits(mreg m) noexcept { return m; }
+    static SENKAID_FORCE_INLINE mreg mask_from_bits(std::uint64_t bits) noexcept { return static_cast<mreg>(bits); }
+
+    static SENKAID_FORCE_INLINE std::int32_t get(reg a, std::size_t i) noexcept
+    {
+        alignas(64) std::int32_t v[16];
+        store(v, a);
+        return v[i];
+    }
+
+    static SENKAID_FORCE_INLINE std::int32_t reduce_add(reg a) noexcept { return _mm512_reduce_add_epi32(a); }
+    static SENKAID_FORCE_INLINE std::int32_t reduce_min(reg a) noexcept { return _mm512_reduce_min_epi32(a); }
+    static SENKAID_FORCE_INLINE std::int32_t reduce_max(reg a) noexcept { return _mm512_reduce_max_epi32(a); }
+
+    // scan_add: valignd against zero shifts lanes up by 1, 2, 4, 8.
+    static SENKAID_FORCE_INLINE reg scan_add(reg a) noexcept
+    {
+        const reg z = zero();
+        a = add(a, _mm512_alignr_epi32(a, z, 15));
+        a = add(a, _mm512_alignr_epi32(a, z, 14));
+        a = add(a, _mm512_alignr_epi32(a, z, 12));
+        return add(a, _mm512_alignr_epi32(a, z, 8));
+    }
+
+    static SENKAID_FORCE_INLINE reg compress(reg a, mreg m) noexcept { return _mm512_maskz_compress_epi32(m, a); }
+    static SENKAID_FORCE_INLINE reg expand(reg a, mreg m) noexcept { return _mm512_maskz_expand_epi32(m, a); }
+
+#if defined(__AVX512VPOPCNTDQ__)
+    static SENKAID_FORCE_INLINE reg popcount(reg a) noexcept { return _mm512_popcnt_epi32(a); }
+#endif
+};
+
+template <>
+struct pack_ops<std::int64_t, 8>
+{
+    using reg = __m512i;
+    using mreg = __mmask8;
+
+    static constexpr bool native = true;
+
+    static SENKAID_FORCE_INLINE reg zero() noexcept { return _mm512_setzero_si512(); }
+    static SENKAID_FORCE_INLINE reg broadcast(std::int64_t s) noexcept { return _mm512_set1_epi64(s); }
+    static SENKAID_FORCE_INLINE reg load(const std::int64_t* p) noexcept { return _mm512_load_si512(p); }
+    static SENKAID_FORCE_INLINE reg loadu(const std::int64_t* p) noexcept { return _mm512_loadu_si512(p); }
+    static SENKAID_FORCE_INLINE void store(std::int64_t* p, reg a) noexcept { _mm512_store_si512(p, a); }
+    static SENKAID_FORCE_INLINE void storeu(std::int64_t* p, reg a) noexcept { _mm512_storeu_si512(p, a); }
+    static SENKAID_FORCE_INLINE reg mask_load(const std::int64_t* p, mreg m) noexcept { return _mm512_maskz_loadu_epi64(m, p); }
+    static SENKAID_FORCE_INLINE void mask_store(std::int64_t* p, mreg m, reg a) noexcept { _mm512_mask_storeu_epi64(p, m, a); }
+
+    static SENKAID_FORCE_INLINE reg add(reg a, reg b) noexcept { return _mm512_add_epi64(a, b); }
+    static SENKAID_FORCE_INLINE reg sub(reg a, reg b) noexcept { return _mm512_sub_epi64(a, b); }
+
+    static SENKAID_FORCE_INLINE reg mul(reg a, reg b) noexcept
+    {
+        const __m512i cross = _mm512_add_epi64(_mm512_mul_epu32(_mm512_srli_epi64(a, 32), b), _mm512_mul_epu32(a, _mm512_srli_epi64(b, 32)));
+        return _mm512_add_epi64(_mm512_mul_epu32(a, b), _mm512_slli_epi64(cross, 32));
+    }
+
+    static SENKAID_FORCE_INLINE reg div(reg a, reg b) noexcept { return lanewise_div<std::int64_t, 8, pack_ops>(a, b); }
+    static SENKAID_FORCE_INLINE reg min(reg a, reg b) noexcept { return _mm512_min_epi64(a, b); }
+    static SENKAID_FORCE_INLINE reg max(reg a, reg b) noexcept { return _mm512_max_epi64(a, b); }
+    static SENKAID_FORCE_INLINE reg neg(reg a) noexcept { return _mm512_sub_epi64(zero(), a); }
+    static SENKAID_FORCE_INLINE reg abs(reg a) noexcept { return _mm512_abs_epi64(a); }
+
+    static SENKAID_FORCE_INLINE reg fma(reg a, reg b, reg c) noexcept { return add(mul(a, b), c); }
+    static SENKAID_FORCE_INLINE reg fms(reg a, reg b, reg c) noexcept { return sub(mul(a, b), c); }
+    static SENKAID_FORCE_INLINE reg fnma(reg a, reg b, reg c) noexcept { return sub(c, mul(a, b)); }
+
+    static SENKAID_FORCE_INLINE mreg eq(reg a, reg b) noexcept { return _mm512_cmpeq_epi64_mask(a, b); }
+    static SENKAID_FORCE_INLINE mreg ne(reg a, reg b) noexcept { return _mm512_cmpneq_epi64_mask(a, b); }
+    static SENKAID_FORCE_INLINE mreg lt(reg a, reg b) noexcept { return _mm512_cmplt_epi64_mask(a, b); }
+    static SENKAID_FORCE_INLINE mreg le(reg a, reg b) noexcept { return _mm512_cmple_epi64_mask(a, b); }
+    static SENKAID_FORCE_INLINE mreg gt(reg a, reg b) noexcept { return _mm512_cmpgt_epi64_mask(a, b); }
+    static SENKAID_FORCE_INLINE mreg ge(reg a, reg b) noexcept { return _mm512_cmpge_epi64_mask(a, b); }
+
+    static SENKAID_FORCE_INLINE reg select(mreg m, reg a, reg b) noexcept { return _mm512_mask_blend_epi64(m, b, a); }
+
+    static SENKAID_FORCE_INLINE mreg mask_and(mreg a, mreg b) noexcept { return static_cast<mreg>(a & b); }
+    static SENKAID_FORCE_INLINE mreg mask_or(mreg a, mreg b) noexcept { return static_cast<mreg>(a | b); }
+    static SENKAID_FORCE_INLINE mreg mask_xor(mreg a, mreg b) noexcept { return static_cast<mreg>(a ^ b); }
+    static SENKAID_FORCE_INLINE mreg mask_not(mreg a) noexcept { return static_cast<mreg>(~a); }
+    static SENKAID_FORCE_INLINE std::uint64_t mask_bits(mreg m) noexcept { return m; }
+    static SENKAID_FORCE_INLINE mreg mask_from_bits(std::uint64_t bits) noexcept { return static_cast<mreg>(bits); }
+
+    static SENKAID_FORCE_INLINE std::int64_t get(reg a, std::size_t i) noexcept
+    {
+        alignas(64) std::int64_t v[8];
+        store(v, a);
+        return v[i];
+    }
+
+    static SENKAID_FORCE_INLINE std::int64_t reduce_add(reg a) noexcept { return _mm512_reduce_add_epi64(a); }
+    static SENKAID_FORCE_INLINE std::int64_t reduce_min(reg a) noexcept { return _mm512_reduce_min_epi64(a); }
+    static SENKAID_FORCE_INLINE std::int64_t reduce_max(reg a) noexcept { return _mm512_reduce_max_epi64(a); }
+
+    static SENKAID_FORCE_INLINE reg scan_add(reg a) noexcept
+    {
+        const reg z = zero();
+        a = add(a, _mm512_alignr_epi64(a, z, 7));
+        a = add(a, _mm512_alignr_epi64(a, z, 6));
+        return add(a, _mm512_alignr_epi64(a, z, 4));
+    }
+
+    static SENKAID_FORCE_INLINE reg compress(reg a, mreg m) noexcept { return _mm512_maskz_compress_epi64(m, a); }
+    static SENKAID_FORCE_INLINE reg expand(reg a, mreg m) noexcept { return _mm512_maskz_expand_epi64(m, a); }
+
+#if defined(__AVX512VPOPCNTDQ__)
+    static SENKAID_FORCE_INLINE reg popcount(reg a) noexcept { return _mm512_popcnt_epi64(a); }
+#endif
+};
+
+#endif // SENKAID_HAS_AVX512
+
+// lane_int: Signed integer with the width of T; the lane type compress / expand run on.
+template <typename T>
+using lane_int = std::conditional_t<sizeof(T) == 4, std::int32_t, std::int64_t>;
+
+// native_permute: pack<T, N> and its integer twin are both native and the twin can permute lanes.
+template <typename T, std::size_t N>
+concept native_permute = (sizeof(T) == 4 || sizeof(T) == 8) && pack_ops<T, N>::native
+                      && sizeof(typename pack_ops<T, N>::reg) == sizeof(typename pack_ops<lane_int<T>, N>::reg)
+                      && requires(typename pack_ops<lane_int<T>, N>::reg r, typename pack_ops<lane_int<T>, N>::mreg m) {
+                             pack_ops<lane_int<T>, N>::compress(r, m);
+                         };
+
+} // namespace senkaid::backend::simd::inline SENKAID_SIMD_ABI::detail
+
+namespace senkaid::backend::simd::inline SENKAID_SIMD_ABI
+{
+
+// iota: Lanes start, start + 1, ..., start + P::lanes - 1.
+template <typename P>
+SENKAID_FORCE_INLINE P iota(typename P::value_type start = 0) noexcept
+{
+    using T = typename P::value_type;
+
+    static constexpr auto steps = [] {
+        std::array<T, P::lanes> a{};
+        for (std::size_t i = 0; i < P::lanes; ++i)
+            a[i] = static_cast<T>(i);
+        return a;
+    }();
+    return P(start) + P::loadu(steps.data());
+}
+
+// compress: Active lanes of `a`, in lane order, in lanes [0, m.count()); the other lanes are zero.
+template <typename T, std::size_t N>
+SENKAID_FORCE_INLINE pack<T, N> compress(pack<T, N> a, mask<T, N> m) noexcept
+{
+    if constexpr (detail::native_permute<T, N>)
+    {
+        using iops = detail::pack_ops<detail::lane_int<T>, N>;
+        const auto r = iops::compress(std::bit_cast<typename iops::reg>(a.reg()), std::bit_cast<typename iops::mreg>(m.reg()));
+        return pack<T, N>(std::bit_cast<typename pack<T, N>::register_type>(r));
+    }
+    else
+    {
+        T src[N];
+        T v[N] = {};
+        a.storeu(src);
+        std::size_t k = 0;
+        for (std::uint64_t bits = m.bits(); bits != 0; bits &= bits - 1)
+            v[k++] = src[__builtin_ctzll(bits)];
+        return pack<T, N>::loadu(v);
+    }
+}
+
+// expand: Lanes [0, m.count()) of `a` placed, in order, on the active lanes; the other lanes are zero.
+template <typename T, std::size_t N>
+SENKAID_FORCE_INLINE pack<T, N> expand(pack<T, N> a, mask<T, N> m) noexcept
+{
+    if constexpr (detail::native_permute<T, N>)
+    {
+        using iops = detail::pack_ops<detail::lane_int<T>, N>;
+        const auto r = iops::expand(std::bit_cast<typename iops::reg>(a.reg()), std::bit_cast<typename iops::mreg>(m.reg()));
+        return pack<T, N>(std::bit_cast<typename pack<T, N>::register_type>(r));
+    }
+    else
+    {
+        T src[N];
+        T v[N] = {};
+        a.storeu(src);
+        std::size_t k = 0;
+        for (std::uint64_t bits = m.bits(); bits != 0; bits &= bits - 1)
+            v[__builtin_ctzll(bits)] = src[k++];
+        return pack<T, N>::loadu(v);
+    }
+}
+
+// compress_store: Writes the active lanes of `a` to p[0, count) and returns count = m.count().
+// Memory past p + count is not touched.
+template <typename T, std::size_t N>
+SENKAID_FORCE_INLINE std::size_t compress_store(T* p, pack<T, N> a, mask<T, N> m) noexcept
+{
+    const std::size_t count = m.count();
+    if constexpr (detail::native_permute<T, N>)
+        compress(a, m).store(p, mask<T, N>::first_n(count));
+    else
+    {
+        T src[N];
+        a.storeu(src);
+        std::size_t k = 0;
+        for (std::uint64_t bits = m.bits(); bits != 0; bits &= bits - 1)
+            p[k++] = src[__builtin_ctzll(bits)];
+    }
+    return count;
+}
+
+// prefix_sum: Inclusive scan, lane i = a[0] + ... + a[i] (wrapping for integers).
+template <typename T, std::size_t N>
+SENKAID_FORCE_INLINE pack<T, N> prefix_sum(pack<T, N> a) noexcept
+{
+    using ops = typename pack<T, N>::ops;
+    if constexpr (requires { ops::scan_add(a.reg()); })
+        return pack<T, N>(ops::scan_add(a.reg()));
+    else
+    {
+        T v[N];
+        a.storeu(v);
+        for (std::size_t i = 1; i < N; ++i)
+            v[i] = static_cast<T>(v[i] + v[i - 1]);
+        return pack<T, N>::loadu(v);
+    }
+}
+
+// popcount: Set bits of each lane (integer T). Native on AVX2 and AVX-512 VPOPCNTDQ.
+template <typename T, std::size_t N>
+SENKAID_FORCE_INLINE pack<T, N> popcount(pack<T, N> a) noexcept
+{
+    static_assert(std::is_integral_v<T>, "popcount: integer lanes only");
+
+    using ops = typename pack<T, N>::ops;
+    if constexpr (requires { ops::popcount(a.reg()); })
+        return pack<T, N>(ops::popcount(a.reg()));
+    else
+    {
+        T v[N];
+        a.storeu(v);
+        for (std::size_t i = 0; i < N; ++i)
+            v[i] = static_cast<T>(std::popcount(static_cast<std::make_unsigned_t<T>>(v[i])));
+        return pack<T, N>::loadu(v);
+    }
+}
+
+} // namespace senkaid::backend::simd::inline SENKAID_SIMD_ABI
@@ -0,0 +1,169 @@
+#pragma once
+
+// simd_load_store.hpp: Memory access helpers for pack loops.
+// Picks aligned, unaligned or non-temporal (streaming) moves through one template parameter,
+// wraps software prefetch, and provides for_each_pack(), which runs a loop body over a range a
+// full pack at a time and finishes the remainder with one masked access (AVX-512 k-mask,
+// AVX maskload/maskstore, element-wise on SSE2) instead of a scalar loop. A body written once
+// as body(i, io), loading and storing through io, serves both the main loop and the tail:
+//
+//   simd::for_each_pack<double>(0, n, [&](std::size_t i, auto io) {
+//       io.store(y + i, io.load(x + i) * scale);
+//   });
+
+#include <senkaid/utils/config/root.hpp>
+#include "simd_common.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace senkaid::backend::simd::inline SENKAID_SIMD_ABI
+{
+
+// memory_access: How a pack is moved to or from memory.
+//   Aligned   - Address is a multiple of pack::alignment.
+//   Unaligned - Any address.
+//   Stream    - Aligned, non-temporal store that bypasses the caches; for outputs larger than
+//               the last-level cache that are not read again soon. Follow with stream_fence().
+//               Loads use a normal aligned load (non-temporal loads only help on WC memory).
+enum class memory_access : std::uint8_t
+{
+    Aligned = 0x01,
+    Unaligned = 0x02,
+    Stream = 0x03
+};
+
+namespace detail
+{
+
+// stream_store: Non-temporal store of one register; deleted where the target has none.
+template <typename T, typename R>
+void stream_store(T*, R) = delete;
+
+#if defined(SENKAID_HAS_SSE2)
+SENKAID_FORCE_INLINE void stream_store(double* p, __m128d v) noexcept { _mm_stream_pd(p, v); }
+SENKAID_FORCE_INLINE void stream_store(float* p, __m128 v) noexcept { _mm_stream_ps(p, v); }
+#endif
+#if defined(SENKAID_HAS_AVX)
+SENKAID_FORCE_INLINE void stream_store(double* p, __m256d v) noexcept { _mm256_stream_pd(p, v); }
+SENKAID_FORCE_INLINE void stream_store(float* p, __m256 v) noexcept { _mm256_stream_ps(p, v); }
+#endif
+#if defined(SENKAID_HAS_AVX512)
+SENKAID_FORCE_INLINE void stream_store(double* p, __m512d v) noexcept { _mm512_stream_pd(p, v); }
+SENKAID_FORCE_INLINE void stream_store(float* p, __m512 v) noexcept { _mm512_stream_ps(p, v); }
+#endif
+
+} // namespace detail
+
+// load: A pack of P::lanes elements from p.
+template <typename P, memory_access A = memory_access::Unaligned>
+SENKAID_FORCE_INLINE P load(const typename P::value_type* p) noexcept
+{
+    if constexpr (A == memory_access::Unaligned)
+        return P::loadu(p);
+    else
+        return P::load(p);
+}
+
+// store: Writes v to p. Stream falls back to an aligned store where the target has no
+// non-temporal move for this pack.
+template <memory_access A = memory_access::Unaligned, typename T, std::size_t N>
+SENKAID_FORCE_INLINE void store(T* p, pack<T, N> v) noexcept
+{
+    if constexpr (A == memory_access::Unaligned)
+        v.storeu(p);
+    else if constexpr (A == memory_access::Stream && requires { detail::stream_store(p, v.reg()); })
+        detail::stream_store(p, v.reg());
+    else
+        v.store(p);
+}
+
+// load_partial / store_partial: The first `count` elements (count <= P::lanes); the other
+// lanes read as zero and their memory is never touched, so reading past the end is safe.
+template <typename P>
+SENKAID_FORCE_INLINE P load_partial(const typename P::value_type* p, std::size_t count) noexcept
+{
+    return P::load(p, P::mask_type::first_n(count));
+}
+
+template <typename T, std::size_t N>
+SENKAID_FORCE_INLINE void store_partial(T* p, pack<T, N> v, std::size_t count) noexcept
+{
+    v.store(p, pack<T, N>::mask_type::first_n(count));
+}
+
+// stream_fence: Orders earlier streaming stores before later ordinary stores.
+SENKAID_FORCE_INLINE void stream_fence() noexcept
+{
+#if defined(SENKAID_HAS_SSE2) || defined(SENKAID_HAS_AVX) || defined(SENKAID_HAS_AVX512)
+    _mm_sfence();
+#endif
+}
+
+// prefetch_hint: Cache level a prefetch targets (T0 = all levels, NTA = minimize pollution).
+enum class prefetch_hint : std::uint8_t
+{
+    T0 = 0x03,
+    T1 = 0x02,
+    T2 = 0x01,
+    NTA = 0x00
+};
+
+// prefetch: Requests the cache line holding p; never faults, so p may point past the end.
+template <prefetch_hint Hint = prefetch_hint::T0>
+SENKAID_FORCE_INLINE void prefetch(const void* p) noexcept
+{
+    __builtin_prefetch(p, 0, static_cast<int>(Hint));
+}
+
+// prefetch_write: As prefetch(), for a line about to be written.
+SENKAID_FORCE_INLINE void prefetch_write(void* p) noexcept
+{
+    __builtin_prefetch(p, 1, 3);
+}
+
+// prefetch_distance: Elements of T ahead of the current index that loops prefetch,
+// SENKAID_PREFETCH_DISTANCE bytes (see utils/config/macros.hpp) by default.
+template <typename T, std::size_t Bytes = SENKAID_PREFETCH_DISTANCE>
+inline constexpr std::size_t prefetch_distance = Bytes / sizeof(T) > 0 ? Bytes / sizeof(T) : 1;
+
+// full_io / tail_io: Access policies handed to for_each_pack() bodies.
+template <typename P, memory_access A = memory_access::Unaligned>
+struct full_io
+{
+    using value_type = typename P::value_type;
+
+    static constexpr bool tail = false;
+
+    static SENKAID_FORCE_INLINE P load(const value_type* p) noexcept { return simd::load<P, A>(p); }
+    static SENKAID_FORCE_INLINE void store(value_type* p, P v) noexcept { simd::store<A>(p, v); }
+};
+
+template <typename P>
+struct tail_io
+{
+    using value_type = typename P::value_type;
+
+    static constexpr bool tail = true;
+
+    typename P::mask_type m;
+
+    SENKAID_FORCE_INLINE P load(const value_type* p) const noexcept { return P::load(p, m); }
+    SENKAID_FORCE_INLINE void store(value_type* p, P v) const noexcept { v.store(p, m); }
+};
+
+// for_each_pack: body(i, io) for i = lo, lo + lanes, ... below hi; the last, partial step gets a
+// tail_io whose accesses are masked to hi - i elements. A is the access mode of full steps.
+template <typename T, memory_access A = memory_access::Unaligned, typename Body>
+SENKAID_FORCE_INLINE void for_each_pack(std::size_t lo, std::size_t hi, Body&& body)
+{
+    using P = pack<T>;
+
+    std::size_t i = lo;
+    for (; i + P::lanes <= hi; i += P::lanes)
+        body(i, full_io<P, A>{});
+    if (i < hi)
+        body(i, tail_io<P>{ P::mask_type::first_n(hi - i) });
+}
+
+} // namespace senkaid::backend::simd::inline SENKAID_SIMD_ABI
@@ -0,0 +1,708 @@
+#pragma once
+
+// simd_reduction.hpp: Single-threaded vector reductions over contiguous buffers.
+// Every kernel keeps reduction_accumulators independent pack accumulators, so the loop is bound
+// by loads rather than by add latency, and finishes the ragged end with one masked load.
+//
+// Sums come in two accuracies (summation):
+//   Blocked     - Lanes accumulate over blocks of sum_block elements, each block total is reduced
+//                 pairwise across the lanes and added to a compensated (Neumaier) running total.
+//                 The error stays near (sum_block / lanes + log2(lanes)) eps * sum|x| however long
+//                 the buffer is, at the cost of the plain loop.
+//   Compensated - Every lane carries an error term updated with a branch-free TwoSum, and
+//                 sum_sq also keeps each product's rounding error (exact where FMA exists).
+//                 About 2 eps * sum|x| + eps * |sum|; still load bound on DRAM-sized buffers.
+// Both depend on IEEE evaluation order; compile them without -ffast-math / -fassociative-math,
+// and expect run-to-run differences in the last bits from x87 excess precision (-mfpmath=387).
+//
+// reduce_min / reduce_max return NaN if any element is NaN; on an empty buffer they return the
+// identity (+inf / -inf, or the integer limits). reduce_argmin / reduce_argmax carry a pack of
+// positions next to the pack of values and blend both with the one comparison mask; a position
+// is counted in steps of the value type itself, so no mask has to be converted between lane
+// types. Ties go to the first occurrence and a NaN beats every number (the first NaN wins).
+//
+// nrm2 follows Blue's algorithm in one pass: squares of mid-range magnitudes are accumulated
+// unscaled, while the rare elements whose squares would overflow or underflow go to two scaled
+// accumulators, tested one pack at a time so in-range data runs at sum_sq speed. The three sums
+// are combined at the end (nrm2_parts::value), so no element is ever visited twice.
+//
+// moments_partial gives count, mean and sum of squared deviations in one pass (moment_parts).
+// Every lane of every accumulator runs Welford's recurrence over its own strided subsequence;
+// all lanes hold the same count, so the 1 / count each step needs is one scalar division. The
+// lane states are then combined with Chan's update, which is also how partials of separate
+// ranges, threads or stream chunks merge.
+//
+//   double s = simd::sum<simd::summation::Compensated>(x, n);
+//   double r = simd::nrm2(x, n);
+//   double v = simd::moments_partial(x, n).variance(1);
+
+#include <senkaid/utils/config/root.hpp>
+#include "simd_common.hpp"
+#include "simd_load_store.hpp"
+#include "simd_math.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace senkaid::backend::simd::inline SENKAID_SIMD_ABI
+{
+
+// summation: Accuracy / speed trade-off of sum() and sum_sq().
+enum class summation : std::uint8_t
+{
+    Blocked = 0x01,
+    Compensated = 0x02
+};
+
+// reduction_accumulators: Independent pack accumulators per kernel (a power of two).
+inline constexpr std::size_t reduction_accumulators = 4;
+
+// sum_block: Elements per lane-accumulation block of Blocked sums; a multiple of every
+// reduction_accumulators * lanes.
+inline constexpr std::size_t sum_block = 2048;
+
+// sum_parts: A sum kept as hi + lo, lo collecting the rounding error of hi. Partial sums of
+// separate ranges combine with merge() without losing that error.
+template <typename T>
+struct sum_parts
+{
+    T hi = T(0);
+    T lo = T(0);
+
+    // add: Neumaier step, hi + lo += x.
+    SENKAID_FORCE_INLINE void add(T x) noexcept
+    {
+        if constexpr (std::is_floating_point_v<T>)
+        {
+            const T t = hi + x;
+            const T z = t - hi;
+            lo += (hi - (t - z)) + (x - z);
+            hi = t;
+        }
+        else
+            hi = static_cast<T>(hi + x);
+    }
+
+    SENKAID_FORCE_INLINE void merge(const sum_parts& other) noexcept
+    {
+        add(other.hi);
+        lo = static_cast<T>(lo + other.lo);
+    }
+
+    // value: hi + lo; once hi overflows or turns NaN, lo holds inf - inf and is dropped.
+    SENKAID_FORCE_INLINE T value() const noexcept
+    {
+        if constexpr (std::is_floating_point_v<T>)
+            return hi - hi == T(0) ? hi + lo : hi;
+        else
+            return static_cast<T>(hi + lo);
+    }
+};
+
+namespace detail
+{
+
+// pow2: 2^e, exact for every e of the normal range.
+template <typename T>
+constexpr T pow2(int e) noexcept
+{
+    T r = T(1);
+    for (; e > 0; --e)
+        r *= T(2);
+    for (; e < 0; ++e)
+        r *= T(0.5);
+    return r;
+}
+
+// floor_half / ceil_half: floor(e / 2) and ceil(e / 2) for negative e as well.
+constexpr int floor_half(int e) noexcept { return e >= 0 ? e / 2 : -((1 - e) / 2); }
+constexpr int ceil_half(int e) noexcept { return -floor_half(-e); }
+
+} // namespace detail
+
+// nrm2_parts: Blue's accumulators for sum(x^2). Magnitudes below tsml are squared after scaling
+// up by ssml, those above tbig after scaling down by sbig, the rest unscaled into med; the
+// thresholds keep every square representable. Partial results of separate ranges combine with
+// merge(); value() returns the 2-norm.
+template <typename T>
+struct nrm2_parts
+{
+    using limits = std::numeric_limits<T>;
+
+    static constexpr T tsml = detail::pow2<T>(detail::ceil_half(limits::min_exponent - 1));
+    static constexpr T tbig = detail::pow2<T>(detail::floor_half(limits::max_exponent - limits::digits + 1));
+    static constexpr T ssml = detail::pow2<T>(-detail::floor_half(limits::min_exponent - limits::digits));
+    static constexpr T sbig = detail::pow2<T>(-detail::ceil_half(limits::max_exponent + limits::digits - 1));
+
+    sum_parts<T> med, sml, big;
+
+    SENKAID_FORCE_INLINE void merge(const nrm2_parts& other) noexcept
+    {
+        med.merge(other.med);
+        sml.merge(other.sml);
+        big.merge(other.big);
+    }
+
+    T value() const noexcept
+    {
+        const T amed = med.value(), asml = sml.value(), abig = big.value();
+        if (abig > T(0))
+            return std::sqrt(abig + (amed * sbig) * sbig) / sbig;
+        if (amed != amed)
+            return amed;
+        if (asml > T(0))
+        {
+            const T ysml = std::sqrt(asml) / ssml;
+            if (amed == T(0))
+                return ysml;
+            const T ymed = std::sqrt(amed);
+            const T ymin = std::min(ysml, ymed), ymax = std::max(ysml, ymed);
+            return ymax * std::sqrt(T(1) + (ymin / ymax) * (ymin / ymax));
+        }
+        return std::sqrt(amed);
+    }
+};
+
+// extremum_at: A smallest or largest value and its position; index is npos if there was none.
+template <typename T>
+struct extremum_at
+{
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    T value;
+    std::size_t index = npos;
+};
+
+// moment_value_t: Type of the mean and variance of T elements; double for integers.
+template <typename T>
+using moment_value_t = std::conditional_t<std::is_floating_point_v<T>, T, double>;
+
+// moment_parts: Count, mean and m2 (sum of squared deviations from the mean) of a set of values.
+// add() takes one more value (Welford); merge() adds a disjoint set (Chan et al.), with no loss
+// of accuracy against a single sequential pass, in whatever grouping the partials arrive.
+template <typename T>
+struct moment_parts
+{
+    std::size_t count = 0;
+    T mean = T(0);
+    T m2 = T(0);
+
+    SENKAID_FORCE_INLINE void add(T x) noexcept
+    {
+        ++count;
+        const T d = x - mean;
+        mean += d / static_cast<T>(count);
+        m2 += d * (x - mean);
+    }
+
+    // merge: With d = mean_b - mean_a: mean += d n_b / n, m2 += m2_b + d^2 n_a n_b / n.
+    SENKAID_FORCE_INLINE void merge(const moment_parts& other) noexcept
+    {
+        if (other.count == 0)
+            return;
+        if (count == 0)
+        {
+            *this = other;
+            return;
+        }
+        const T na = static_cast<T>(count), nb = static_cast<T>(other.count);
+        const T f = nb / (na + nb);
+        const T d = other.mean - mean;
+        mean += d * f;
+        m2 += other.m2 + d * d * (na * f);
+        count += other.count;
+    }
+
+    // variance: m2 / (count - ddof); NaN if count <= ddof.
+    SENKAID_FORCE_INLINE T variance(std::size_t ddof = 0) const noexcept
+    {
+        return count > ddof ? m2 / static_cast<T>(count - ddof) : std::numeric_limits<T>::quiet_NaN();
+    }
+};
+
+namespace detail
+{
+
+// two_sum: s + e == a + b exactly (Knuth); no magnitude comparison, so no branch or blend.
+template <typename P>
+SENKAID_FORCE_INLINE P two_sum(P a, P b, P& e) noexcept
+{
+    const P s = a + b;
+    const P z = s - a;
+    e = (a - (s - z)) + (b - z);
+    return s;
+}
+
+// fold: step(k, v) for every full pack v of x[0, n), k cycling over K accumulators, then
+// tail(v, m) once for the ragged end if there is one.
+template <typename P, std::size_t K, typename Step, typename Tail>
+SENKAID_FORCE_INLINE void fold(const typename P::value_type* x, std::size_t n, Step&& step, Tail&& tail)
+{
+    using T = typename P::value_type;
+    constexpr std::size_t L = P::lanes;
+
+    std::size_t i = 0;
+    for (; i + K * L <= n; i += K * L)
+    {
+        prefetch(x + i + prefetch_distance<T>);
+        for (std::size_t k = 0; k < K; ++k)
+            step(k, P::loadu(x + i + k * L));
+    }
+    for (; i + L <= n; i += L)
+        step(0, P::loadu(x + i));
+    if (i < n)
+    {
+        const auto m = P::mask_type::first_n(n - i);
+        tail(P::load(x + i, m), m);
+    }
+}
+
+// blocked_sum: Blocked sum of term(v, acc) updates; term must leave acc unchanged for v == 0,
+// which is what the masked tail load supplies in its inactive lanes. flush() runs after every
+// block, for terms that keep accumulators of their own.
+template <typename T, typename Term, typename Flush>
+sum_parts<T> blocked_sum(const T* x, std::size_t n, Term term, Flush flush) noexcept
+{
+    using P = pack<T>;
+    constexpr std::size_t K = reduction_accumulators;
+
+    sum_parts<T> total;
+    for (std::size_t b = 0; b < n; b += sum_block)
+    {
+        P acc[K];
+        for (auto& a : acc)
+            a = P::zero();
+
+        const auto step = [&](std::size_t k, P v) { acc[k] = term(v, acc[k]); };
+        fold<P, K>(x + b, std::min(sum_block, n - b), step, [&](P v, auto) { step(0, v); });
+
+        for (std::size_t w = K / 2; w > 0; w /= 2)
+            for (std::size_t k = 0; k < w; ++k)
+                acc[k] += acc[k + w];
+        total.add(reduce_add(acc[0]));
+        flush();
+    }
+    return total;
+}
+
+template <typename T, typename Term>
+SENKAID_FORCE_INLINE sum_parts<T> blocked_sum(const T* x, std::size_t n, Term term) noexcept
+{
+    return blocked_sum(x, n, term, [] {});
+}
+
+template <bool Square, typename T>
+sum_parts<T> compensated_sum(const T* x, std::size_t n) noexcept
+{
+    using P = pack<T>;
+    constexpr std::size_t K = reduction_accumulators;
+    constexpr std::size_t L = P::lanes;
+
+    P s[K], c[K];
+    for (std::size_t k = 0; k < K; ++k)
+        s[k] = c[k] = P::zero();
+
+    const auto step = [&](std::size_t k, P v) {
+        P e;
+        if constexpr (Square)
+        {
+            const P p = v * v;
+            s[k] = two_sum(s[k], p, e);
+            c[k] += e + fms(v, v, p);
+        }
+        else
+        {
+            s[k] = two_sum(s[k], v, e);
+            c[k] += e;
+        }
+    };
+    fold<P, K>(x, n, step, [&](P v, auto) { step(0, v); });
+
+    T hi[K * L], lo[K * L];
+    for (std::size_t k = 0; k < K; ++k)
+    {
+        s[k].storeu(hi + k * L);
+        c[k].storeu(lo + k * L);
+    }
+
+    sum_parts<T> total;
+    for (std::size_t i = 0; i < K * L; ++i)
+    {
+        total.add(hi[i]);
+        total.lo += lo[i];
+    }
+    return total;
+}
+
+template <typename T>
+nrm2_parts<T> blue_nrm2(const T* x, std::size_t n) noexcept
+{
+    using P = pack<T>;
+    using parts = nrm2_parts<T>;
+
+    const P z = P::zero();
+    P sml = z, big = z;
+
+    // Out-of-range lanes go to the scaled accumulators (flushed per block like the unscaled one)
+    // and are zeroed before the unscaled update.
+    const auto term = [&](P v, P acc) {
+        const P a = abs(v);
+        const auto hi = a > P(parts::tbig);
+        const auto lo = (a < P(parts::tsml)) & (a > z);
+        if (SENKAID_UNLIKELY((hi | lo).any()))
+        {
+            const P b = select(hi, a * P(parts::sbig), z);
+            const P s = select(lo, a * P(parts::ssml), z);
+            big = fma(b, b, big);
+            sml = fma(s, s, sml);
+            v = select(hi | lo, z, v);
+        }
+        return fma(v, v, acc);
+    };
+
+    parts r;
+    r.med = blocked_sum(x, n, term, [&] {
+        r.sml.add(reduce_add(sml));
+        r.big.add(reduce_add(big));
+        sml = big = z;
+    });
+    return r;
+}
+
+// extremum_identity: The value that never wins a min (Max == false) or max comparison.
+template <bool Max, typename T>
+constexpr T extremum_identity() noexcept
+{
+    if constexpr (std::numeric_limits<T>::has_infinity)
+        return Max ? -std::numeric_limits<T>::infinity() : std::numeric_limits<T>::infinity();
+    else
+        return Max ? std::numeric_limits<T>::lowest() : std::numeric_limits<T>::max();
+}
+
+// extremum: min / max of map(x[i]); map(identity) must equal identity, since the tail lanes past
+// n are replaced by identity before mapping.
+template <bool Max, typename T, typename Map>
+T extremum(const T* x, std::size_t n, T identity, Map map) noexcept
+{
+    using P = pack<T>;
+    using M = typename P::mask_type;
+    constexpr std::size_t K = reduction_accumulators;
+
+    P acc[K];
+    for (auto& a : acc)
+        a = P(identity);
+    M unordered = M::none_set();
+
+    const auto step = [&](std::size_t k, P v) {
+        acc[k] = Max ? max(acc[k], map(v)) : min(acc[k], map(v));
+        if constexpr (std::is_floating_point_v<T>)
+            unordered = unordered | (v != v);
+    };
+    fold<P, K>(x, n, step, [&](P v, M m) { step(0, select(m, v, P(identity))); });
+
+    if constexpr (std::is_floating_point_v<T>)
+        if (SENKAID_UNLIKELY(unordered.any()))
+            return std::numeric_limits<T>::quiet_NaN();
+
+    for (std::size_t w = K / 2; w > 0; w /= 2)
+        for (std::size_t k = 0; k < w; ++k)
+            acc[k] = Max ? max(acc[k], acc[k + w]) : min(acc[k], acc[k + w]);
+    return Max ? reduce_max(acc[0]) : reduce_min(acc[0]);
+}
+
+// arg_better: a displaces the incumbent b of an argmin (Max == false) or argmax: a NaN displaces
+// a number, a number one strictly below (above) it.
+template <bool Max, typename T>
+SENKAID_FORCE_INLINE bool arg_better(T a, T b) noexcept
+{
+    if constexpr (std::is_floating_point_v<T>)
+        if (a != a)
+            return b == b;
+    return Max ? b < a : a < b;
+}
+
+template <bool Max, typename T, std::size_t N>
+SENKAID_FORCE_INLINE mask<T, N> arg_better(pack<T, N> a, pack<T, N> b) noexcept
+{
+    const mask<T, N> m = Max ? b < a : a < b;
+    if constexpr (std::is_floating_point_v<T>)
+        return m | ((a != a) & (b == b));
+    else
+        return m;
+}
+
+// arg_take: Moves c into r if it is better, or equally good at an earlier position.
+template <bool Max, typename T>
+SENKAID_FORCE_INLINE void arg_take(extremum_at<T>& r, const extremum_at<T>& c) noexcept
+{
+    if (arg_better<Max>(c.value, r.value) || (!arg_better<Max>(r.value, c.value) && c.index < r.index))
+        r = c;
+}
+
+// arg_steps: Pack steps a position held in T counts exactly (2^digits, or the integer maximum).
+template <typename T>
+inline constexpr std::size_t arg_steps = std::is_floating_point_v<T> ? std::size_t(1) << std::min(std::numeric_limits<T>::digits, 40)
+                                                                     : static_cast<std::size_t>(std::min<std::uintmax_t>(
+                                                                           std::numeric_limits<T>::max(), std::uintmax_t(1) << 40));
+
+// arg_extremum: First smallest (largest) element of x[0, n). Each of K accumulators keeps the
+// best value per lane and, in a pack of T, the step it was seen at; sub-ranges of arg_steps
+// steps restart the count. Lanes are combined by value and then position, the ragged end
+// element by element.
+template <bool Max, typename T>
+extremum_at<T> arg_extremum(const T* x, std::size_t n) noexcept
+{
+    using P = pack<T>;
+    constexpr std::size_t L = P::lanes;
+    constexpr std::size_t K = reduction_accumulators;
+    constexpr std::size_t span = arg_steps<T> * K * L;
+
+    extremum_at<T> r{extremum_identity<Max, T>()};
+    std::size_t i = 0;
+    for (std::size_t b = 0; b + K * L <= n; b = i)
+    {
+        const std::size_t e = b + std::min(span, (n - b) / (K * L) * (K * L));
+        P best[K], step[K];
+        for (std::size_t k = 0; k < K; ++k)
+        {
+            best[k] = P(r.value);
+            step[k] = P::zero();
+        }
+        T s = T(0);
+        for (i = b; i < e; i += K * L, s += T(1))
+        {
+            prefetch(x + i + prefetch_distance<T>);
+            const P sp(s);
+            for (std::size_t k = 0; k < K; ++k)
+            {
+                const P v = P::loadu(x + i + k * L);
+                const auto m = arg_better<Max>(v, best[k]);
+                best[k] = select(m, v, best[k]);
+                step[k] = select(m, sp, step[k]);
+            }
+        }
+
+        alignas(64) T bv[K * L], bs[K * L];
+        for (std::size_t k = 0; k < K; ++k)
+        {
+            best[k].storeu(bv + k * L);
+            step[k].storeu(bs + k * L);
+        }
+        for (std::size_t l = 0; l < K * L; ++l)
+            arg_take<Max>(r, {bv[l], b + static_cast<std::size_t>(bs[l]) * K * L + l});
+    }
+    for (; i < n; ++i)
+        arg_take<Max>(r, {x[i], i});
+    return r;
+}
+
+// welford: moment_parts of x[0, n). K accumulators of lane-wise Welford state take a pack each
+// per step, sharing one count and so one reciprocal; single packs past the last full step go to
+// accumulator 0 under a count of its own, and the < lanes ragged elements to the merged result.
+// Values are shifted by x[0] first, so a mean far from zero relative to the spread costs no
+// accuracy in m2.
+template <typename T>
+moment_parts<T> welford(const T* x, std::size_t n) noexcept
+{
+    using P = pack<T>;
+    constexpr std::size_t L = P::lanes;
+    constexpr std::size_t K = reduction_accumulators;
+
+    const T shift = n > 0 ? x[0] : T(0);
+    P mean[K], m2[K];
+    for (std::size_t k = 0; k < K; ++k)
+        mean[k] = m2[k] = P::zero();
+    const auto step = [&](std::size_t k, P v, P w) {
+        v -= P(shift);
+        const P d = v - mean[k];
+        mean[k] = fma(d, w, mean[k]);
+        m2[k] = fma(d, v - mean[k], m2[k]);
+    };
+
+    std::size_t i = 0, c = 0;
+    for (; i + K * L <= n; i += K * L)
+    {
+        prefetch(x + i + prefetch_distance<T>);
+        const P w(T(1) / static_cast<T>(++c));
+        for (std::size_t k = 0; k < K; ++k)
+            step(k, P::loadu(x + i + k * L), w);
+    }
+    std::size_t c0 = c;
+    for (; i + L <= n; i += L)
+        step(0, P::loadu(x + i), P(T(1) / static_cast<T>(++c0)));
+
+    moment_parts<T> r;
+    if (c0 > 0)
+    {
+        alignas(64) T mu[K * L], q[K * L];
+        for (std::size_t k = 0; k < K; ++k)
+        {
+            mean[k].storeu(mu + k * L);
+            m2[k].storeu(q + k * L);
+        }
+        for (std::size_t l = 0; l < K * L; ++l)
+            r.merge({l < L ? c0 : c, mu[l], q[l]});
+    }
+    for (; i < n; ++i)
+        r.add(x[i] - shift);
+    r.mean += shift;
+    return r;
+}
+
+} // namespace detail
+
+// sum_partial / sum_sq_partial: sum() / sum_sq() of x[0, n) as mergeable sum_parts.
+template <summation S = summation::Blocked, typename T>
+SENKAID_FORCE_INLINE sum_parts<T> sum_partial(const T* x, std::size_t n) noexcept
+{
+    static_assert(std::is_arithmetic_v<T>, "sum: arithmetic element types only");
+
+    if constexpr (S == summation::Compensated && std::is_floating_point_v<T>)
+        return detail::compensated_sum<false>(x, n);
+    else
+        return detail::blocked_sum(x, n, [](auto v, auto acc) { return acc + v; });
+}
+
+template <summation S = summation::Blocked, typename T>
+SENKAID_FORCE_INLINE sum_parts<T> sum_sq_partial(const T* x, std::size_t n) noexcept
+{
+    static_assert(std::is_arithmetic_v<T>, "sum_sq: arithmetic element types only");
+
+    if constexpr (S == summation::Compensated && std::is_floating_point_v<T>)
+        return detail::compensated_sum<true>(x, n);
+    else
+        return detail::blocked_sum(x, n, [](auto v, auto acc) { return fma(v, v, acc); });
+}
+
+// sum: x[0] + ... + x[n - 1]; integer sums wrap like the scalar loop.
+template <summation S = summation::Blocked, typename T>
+SENKAID_FORCE_INLINE T sum(const T* x, std::size_t n) noexcept
+{
+    return sum_partial<S>(x, n).value();
+}
+
+// sum_sq: x[0]^2 + ... + x[n - 1]^2. No scaling: overflows / underflows like the scalar loop.
+template <summation S = summation::Blocked, typename T>
+SENKAID_FORCE_INLINE T sum_sq(const T* x, std::size_t n) noexcept
+{
+    return sum_sq_partial<S>(x, n).value();
+}
+
+// reduce_min / reduce_max: Smallest / largest element of x[0, n).
+template <typename T>
+SENKAID_FORCE_INLINE T reduce_min(const T* x, std::size_t n) noexcept
+{
+    static_assert(std::is_arithmetic_v<T>, "reduce_min: arithmetic element types only");
+    return detail::extremum<false>(x, n, detail::extremum_identity<false, T>(), [](auto v) { return v; });
+}
+
+template <typename T>
+SENKAID_FORCE_INLINE T reduce_max(const T* x, std::size_t n) noexcept
+{
+    static_assert(std::is_arithmetic_v<T>, "reduce_max: arithmetic element types only");
+    return detail::extremum<true>(x, n, detail::extremum_identity<true, T>(), [](auto v) { return v; });
+}
+
+// reduce_argmin / reduce_argmax: Smallest / largest element of x[0, n) and its first position;
+// the first NaN if there is one; index npos if n == 0.
+template <typename T>
+SENKAID_FORCE_INLINE extremum_at<T> reduce_argmin(const T* x, std::size_t n) noexcept
+{
+    static_assert(std::is_arithmetic_v<T>, "reduce_argmin: arithmetic element types only");
+    return detail::arg_extremum<false>(x, n);
+}
+
+template <typename T>
+SENKAID_FORCE_INLINE extremum_at<T> reduce_argmax(const T* x, std::size_t n) noexcept
+{
+    static_assert(std::is_arithmetic_v<T>, "reduce_argmax: arithmetic element types only");
+    return detail::arg_extremum<true>(x, n);
+}
+
+// abs_sum_partial: |x[0]| + ... + |x[n - 1]| as sum_parts, Blocked (no cancellation to guard).
+template <typename T>
+SENKAID_FORCE_INLINE sum_parts<T> abs_sum_partial(const T* x, std::size_t n) noexcept
+{
+    static_assert(std::is_arithmetic_v<T>, "abs_sum: arithmetic element types only");
+    return detail::blocked_sum(x, n, [](auto v, auto acc) { return acc + abs(v); });
+}
+
+// reduce_max_abs: Largest |x[i]|; NaN if any element is NaN, 0 if n == 0.
+template <typename T>
+SENKAID_FORCE_INLINE T reduce_max_abs(const T* x, std::size_t n) noexcept
+{
+    static_assert(std::is_arithmetic_v<T>, "reduce_max_abs: arithmetic element types only");
+    return detail::extremum<true>(x, n, T(0), [](auto v) { return abs(v); });
+}
+
+// pow_sum_partial: (|x[0]| / d)^p + ... + (|x[n - 1]| / d)^p for p > 0 and d > 0. Integer
+// orders up to 64 multiply by squaring; others take exp(p log(|x| / d)) from simd_math.hpp. With
+// d = max |x[i]| every term lies in [0, 1], so the sum cannot overflow.
+template <typename T>
+SENKAID_FORCE_INLINE sum_parts<T> pow_sum_partial(const T* x, std::size_t n, T p, T d) noexcept
+{
+    static_assert(std::is_floating_point_v<T>, "pow_sum: floating-point element types only");
+
+    if (p == std::floor(p) && p <= T(64))
+        return detail::blocked_sum(x, n, [k = static_cast<unsigned>(p), d](auto v, auto acc) {
+            using P = decltype(v);
+            P y = abs(v) / P(d), r = P(T(1));
+            for (unsigned e = k;; y *= y)
+            {
+                if (e & 1u)
+                    r *= y;
+                if ((e >>= 1) == 0)
+                    break;
+            }
+            return acc + r;
+        });
+    return detail::blocked_sum(x, n, [p, d](auto v, auto acc) {
+        using P = decltype(v);
+        return acc + exp(P(p) * log(abs(v) / P(d)));
+    });
+}
+
+// nrm2_partial: Blue's accumulators of x[0, n) (see nrm2_parts).
+template <typename T>
+SENKAID_FORCE_INLINE nrm2_parts<T> nrm2_partial(const T* x, std::size_t n) noexcept
+{
+    static_assert(std::is_floating_point_v<T>, "nrm2: floating-point element types only");
+    return detail::blue_nrm2(x, n);
+}
+
+// nrm2: sqrt(x[0]^2 + ... + x[n - 1]^2) without intermediate overflow or underflow.
+template <typename T>
+SENKAID_FORCE_INLINE T nrm2(const T* x, std::size_t n) noexcept
+{
+    return nrm2_partial(x, n).value();
+}
+
+// moments_partial: Count, mean and m2 of x[0, n) in one pass (see moment_parts). Integers are
+// converted to double a sum_block at a time through a stack buffer.
+template <typename T>
+moment_parts<moment_value_t<T>> moments_partial(const T* x, std::size_t n) noexcept
+{
+    static_assert(std::is_arithmetic_v<T>, "moments: arithmetic element types only");
+
+    if constexpr (std::is_floating_point_v<T>)
+        return detail::welford(x, n);
+    else
+    {
+        moment_parts<double> r;
+        alignas(64) double buf[sum_block];
+        for (std::size_t b = 0; b < n; b += sum_block)
+        {
+            const std::size_t m = std::min(sum_block, n - b);
+            for (std::size_t i = 0; i < m; ++i)
+                buf[i] = static_cast<double>(x[b + i]);
+            r.merge(detail::welford(buf, m));
+        }
+        return r;
+    }
+}
+
+} // namespace senkaid::backend::simd::inline SENKAID_SIMD_ABI
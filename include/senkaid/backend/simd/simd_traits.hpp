@@ -0,0 +1,91 @@
+#pragma once
+
+// simd_traits.hpp: Compile-time width and capability queries for pack types.
+// Kernels use these to pick a pack width, size their tails and check alignment without
+// naming an ISA: the answers follow the target the translation unit is compiled for.
+
+#include <senkaid/utils/config/root.hpp>
+#include "simd_common.hpp"
+
+#include <cstddef>
+#include <type_traits>
+
+namespace senkaid::backend::simd::inline SENKAID_SIMD_ABI
+{
+
+// simd_isa: Instruction set behind the native packs of this translation unit.
+enum class simd_isa : uint8_t
+{
+    Scalar = 0x01,
+    SSE2 = 0x02,
+    AVX = 0x03,
+    AVX512 = 0x04
+};
+
+inline constexpr simd_isa current_isa =
+#if defined(SENKAID_HAS_AVX512)
+    simd_isa::AVX512;
+#elif defined(SENKAID_HAS_AVX)
+    simd_isa::AVX;
+#elif defined(SENKAID_HAS_SSE2)
+    simd_isa::SSE2;
+#else
+    simd_isa::Scalar;
+#endif
+
+// simd_traits: Native vector parameters for element type T.
+template <typename T>
+struct simd_traits
+{
+    using value_type = T;
+    using pack_type = pack<T, native_lanes<T>>;
+    using mask_type = mask<T, native_lanes<T>>;
+
+    static constexpr std::size_t lanes = native_lanes<T>;       // Elements per native register.
+    static constexpr std::size_t bytes = lanes * sizeof(T);     // Register width in bytes.
+    static constexpr std::size_t alignment = pack_type::alignment;
+    static constexpr bool vectorized = pack_type::native;       // False when only the scalar table exists.
+    static constexpr bool has_fma =
+#if defined(SENKAID_HAS_FMA) || defined(SENKAID_HAS_AVX512)
+        vectorized && std::is_floating_point_v<T>;
+#else
+        false;
+#endif
+};
+
+// native_pack: Widest hardware-backed pack for T.
+template <typename T>
+using native_pack = typename simd_traits<T>::pack_type;
+
+// is_pack: True for pack<T, N> specializations.
+template <typename P>
+struct is_pack : std::false_type {};
+
+template <typename T, std::size_t N>
+struct is_pack<pack<T, N>> : std::true_type {};
+
+template <typename P>
+inline constexpr bool is_pack_v = is_pack<P>::value;
+
+// pack_traits: Element type and lane count of a pack type.
+template <typename P>
+struct pack_traits;
+
+template <typename T, std::size_t N>
+struct pack_traits<pack<T, N>>
+{
+    using value_type = T;
+    using mask_type = mask<T, N>;
+
+    static constexpr std::size_t lanes = N;
+    static constexpr bool native = pack<T, N>::native;
+};
+
+// is_aligned: Whether `p` satisfies the aligned load/store requirement of P.
+template <typename P>
+SENKAID_FORCE_INLINE bool is_aligned(const void* p) noexcept
+{
+    return reinterpret_cast<std::uintptr_t>(p) % P::alignment == 0;
+}
+
+} // namespace senkaid::backend::simd::inline SENKAID_SIMD_ABI
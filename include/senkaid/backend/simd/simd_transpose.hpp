@@ -0,0 +1,302 @@
+#pragma once
+
+// simd_transpose.hpp: In-register transposes of square blocks.
+// Block edge is one vector: 8x8 double / 16x16 float with AVX-512, 4x4 / 8x8 with AVX,
+// 2x2 / 4x4 with SSE2. A block is read as `B` lines of `B` elements (stride lds) and written
+// transposed (stride ldd): dst[j * ldd + i] = src[i * lds + j].
+// The Stream variant writes with non-temporal stores; dst lines must then be vector aligned.
+// Builds with SENKAID_ENABLE_ASM take the 8x8 double block from backend/asm/transpose.s.
+
+#include <senkaid/utils/config/root.hpp>
+#include <senkaid/backend/asm/asm_dispatch.hpp>
+#include "simd_load_store.hpp"
+
+#include <cstddef>
+#include <type_traits>
+
+#if defined(SENKAID_HAS_SSE2) || defined(SENKAID_HAS_AVX) || defined(SENKAID_HAS_AVX512)
+    #include <immintrin.h>
+#endif
+
+namespace senkaid::backend::simd
+{
+
+// transpose_block_size: Edge of the block handled by transpose_block<TN>.
+template <typename TN>
+inline constexpr std::size_t transpose_block_size =
+#if defined(SENKAID_HAS_AVX512)
+    64 / sizeof(TN);
+#elif defined(SENKAID_HAS_AVX)
+    32 / sizeof(TN);
+#elif defined(SENKAID_HAS_SSE2)
+    16 / sizeof(TN);
+#else
+    4;
+#endif
+
+// transpose_vector_bytes: Alignment required of dst lines by the streaming variant.
+inline constexpr std::size_t transpose_vector_bytes =
+#if defined(SENKAID_HAS_AVX512)
+    64;
+#elif defined(SENKAID_HAS_AVX)
+    32;
+#elif defined(SENKAID_HAS_SSE2)
+    16;
+#else
+    0;
+#endif
+
+namespace detail
+{
+
+template <typename TN>
+SENKAID_FORCE_INLINE void transpose_block_scalar(const TN* SENKAID_RESTRICT src, std::size_t lds,
+                                                 TN* SENKAID_RESTRICT dst, std::size_t ldd, std::size_t b)
+{
+    for (std::size_t i = 0; i < b; ++i)
+        for (std::size_t j = 0; j < b; ++j)
+            dst[j * ldd + i] = src[i * lds + j];
+}
+
+#if defined(SENKAID_HAS_AVX512)
+
+template <bool Stream>
+SENKAID_FORCE_INLINE void store(double* p, __m512d v)
+{
+    if constexpr (Stream)
+        _mm512_stream_pd(p, v);
+    else
+        _mm512_storeu_pd(p, v);
+}
+
+template <bool Stream>
+SENKAID_FORCE_INLINE void store(float* p, __m512 v)
+{
+    if constexpr (Stream)
+        _mm512_stream_ps(p, v);
+    else
+        _mm512_storeu_ps(p, v);
+}
+
+// 8x8 double: unpack pairs of rows, then two rounds of 128-bit lane shuffles.
+template <bool Stream>
+SENKAID_FORCE_INLINE void transpose_block(const double* SENKAID_RESTRICT src, std::size_t lds,
+                                          double* SENKAID_RESTRICT dst, std::size_t ldd)
+{
+#if defined(SENKAID_ASM_TRANSPOSE_8X8_F64)
+    if constexpr (Stream)
+        senkaid_asm_transpose_8x8_f64_nt(src, lds, dst, ldd);
+    else
+        senkaid_asm_transpose_8x8_f64(src, lds, dst, ldd);
+#else
+    __m512d r[8];
+    for (int i = 0; i < 8; ++i)
+        r[i] = _mm512_loadu_pd(src + i * lds);
+
+    __m512d t[8];
+    for (int i = 0; i < 4; ++i)
+    {
+        t[2 * i] = _mm512_unpacklo_pd(r[2 * i], r[2 * i + 1]);
+        t[2 * i + 1] = _mm512_unpackhi_pd(r[2 * i], r[2 * i + 1]);
+    }
+
+    // t[0|1] hold rows 0-1, t[2|3] rows 2-3, ...; even t -> even columns, odd t -> odd columns.
+    for (int odd = 0; odd < 2; ++odd)
+    {
+        const __m512d s0 = _mm512_shuffle_f64x2(t[odd], t[2 + odd], 0x88);
+        const __m512d s1 = _mm512_shuffle_f64x2(t[4 + odd], t[6 + odd], 0x88);
+        const __m512d s2 = _mm512_shuffle_f64x2(t[odd], t[2 + odd], 0xDD);
+        const __m512d s3 = _mm512_shuffle_f64x2(t[4 + odd], t[6 + odd], 0xDD);
+
+        store<Stream>(dst + (0 + odd) * ldd, _mm512_shuffle_f64x2(s0, s1, 0x88));
+        store<Stream>(dst + (4 + odd) * ldd, _mm512_shuffle_f64x2(s0, s1, 0xDD));
+        store<Stream>(dst + (2 + odd) * ldd, _mm512_shuffle_f64x2(s2, s3, 0x88));
+        store<Stream>(dst + (6 + odd) * ldd, _mm512_shuffle_f64x2(s2, s3, 0xDD));
+    }
+#endif
+}
+
+// 16x16 float: unpack, 4-wide shuffles inside 128-bit lanes, then two rounds of lane shuffles.
+template <bool Stream>
+SENKAID_FORCE_INLINE void transpose_block(const float* SENKAID_RESTRICT src, std::size_t lds,
+                                          float* SENKAID_RESTRICT dst, std::size_t ldd)
+{
+    __m512 r[16];
+    for (int i = 0; i < 16; ++i)
+        r[i] = _mm512_loadu_ps(src + i * lds);
+
+    __m512 t[16];
+    for (int i = 0; i < 8; ++i)
+    {
+        t[2 * i] = _mm512_unpacklo_ps(r[2 * i], r[2 * i + 1]);
+        t[2 * i + 1] = _mm512_unpackhi_ps(r[2 * i], r[2 * i + 1]);
+    }
+
+    // u[4k + m], lane q: column 4q + m of rows 4k .. 4k + 3.
+    __m512 u[16];
+    for (int k = 0; k < 4; ++k)
+    {
+        u[4 * k + 0] = _mm512_shuffle_ps(t[4 * k], t[4 * k + 2], 0x44);
+        u[4 * k + 1] = _mm512_shuffle_ps(t[4 * k], t[4 * k + 2], 0xEE);
+        u[4 * k + 2] = _mm512_shuffle_ps(t[4 * k + 1], t[4 * k + 3], 0x44);
+        u[4 * k + 3] = _mm512_shuffle_ps(t[4 * k + 1], t[4 * k + 3], 0xEE);
+    }
+
+    for (int m = 0; m < 4; ++m)
+    {
+        const __m512 v0 = _mm512_shuffle_f32x4(u[m], u[4 + m], 0x88);
+        const __m512 v1 = _mm512_shuffle_f32x4(u[8 + m], u[12 + m], 0x88);
+        const __m512 w0 = _mm512_shuffle_f32x4(u[m], u[4 + m], 0xDD);
+        const __m512 w1 = _mm512_shuffle_f32x4(u[8 + m], u[12 + m], 0xDD);
+
+        store<Stream>(dst + (0 + m) * ldd, _mm512_shuffle_f32x4(v0, v1, 0x88));
+        store<Stream>(dst + (8 + m) * ldd, _mm512_shuffle_f32x4(v0, v1, 0xDD));
+        store<Stream>(dst + (4 + m) * ldd, _mm512_shuffle_f32x4(w0, w1, 0x88));
+        store<Stream>(dst + (12 + m) * ldd, _mm512_shuffle_f32x4(w0, w1, 0xDD));
+    }
+}
+
+#elif defined(SENKAID_HAS_AVX)
+
+template <bool Stream>
+SENKAID_FORCE_INLINE void store(double* p, __m256d v)
+{
+    if constexpr (Stream)
+        _mm256_stream_pd(p, v);
+    else
+        _mm256_storeu_pd(p, v);
+}
+
+template <bool Stream>
+SENKAID_FORCE_INLINE void store(float* p, __m256 v)
+{
+    if constexpr (Stream)
+        _mm256_stream_ps(p, v);
+    else
+        _mm256_storeu_ps(p, v);
+}
+
+// 4x4 double.
+template <bool Stream>
+SENKAID_FORCE_INLINE void transpose_block(const double* SENKAID_RESTRICT src, std::size_t lds,
+                                          double* SENKAID_RESTRICT dst, std::size_t ldd)
+{
+    const __m256d r0 = _mm256_loadu_pd(src);
+    const __m256d r1 = _mm256_loadu_pd(src + lds);
+    const __m256d r2 = _mm256_loadu_pd(src + 2 * lds);
+    const __m256d r3 = _mm256_loadu_pd(src + 3 * lds);
+
+    const __m256d t0 = _mm256_unpacklo_pd(r0, r1);
+    const __m256d t1 = _mm256_unpackhi_pd(r0, r1);
+    const __m256d t2 = _mm256_unpacklo_pd(r2, r3);
+    const __m256d t3 = _mm256_unpackhi_pd(r2, r3);
+
+    store<Stream>(dst, _mm256_permute2f128_pd(t0, t2, 0x20));
+    store<Stream>(dst + ldd, _mm256_permute2f128_pd(t1, t3, 0x20));
+    store<Stream>(dst + 2 * ldd, _mm256_permute2f128_pd(t0, t2, 0x31));
+    store<Stream>(dst + 3 * ldd, _mm256_permute2f128_pd(t1, t3, 0x31));
+}
+
+// 8x8 float.
+template <bool Stream>
+SENKAID_FORCE_INLINE void transpose_block(const float* SENKAID_RESTRICT src, std::size_t lds,
+                                          float* SENKAID_RESTRICT dst, std::size_t ldd)
+{
+    __m256 r[8];
+    for (int i = 0; i < 8; ++i)
+        r[i] = _mm256_loadu_ps(src + i * lds);
+
+    __m256 t[8];
+    for (int i = 0; i < 4; ++i)
+    {
+        t[2 * i] = _mm256_unpacklo_ps(r[2 * i], r[2 * i + 1]);
+        t[2 * i + 1] = _mm256_unpackhi_ps(r[2 * i], r[2 * i + 1]);
+    }
+
+    __m256 u[8];
+    for (int k = 0; k < 2; ++k)
+    {
+        u[4 * k + 0] = _mm256_shuffle_ps(t[4 * k], t[4 * k + 2], 0x44);
+        u[4 * k + 1] = _mm256_shuffle_ps(t[4 * k], t[4 * k + 2], 0xEE);
+        u[4 * k + 2] = _mm256_shuffle_ps(t[4 * k + 1], t[4 * k + 3], 0x44);
+        u[4 * k + 3] = _mm256_shuffle_ps(t[4 * k + 1], t[4 * k + 3], 0xEE);
+    }
+
+    for (int m = 0; m < 4; ++m)
+    {
+        store<Stream>(dst + m * ldd, _mm256_permute2f128_ps(u[m], u[4 + m], 0x20));
+        store<Stream>(dst + (4 + m) * ldd, _mm256_permute2f128_ps(u[m], u[4 + m], 0x31));
+    }
+}
+
+#elif defined(SENKAID_HAS_SSE2)
+
+// 2x2 double.
+template <bool Stream>
+SENKAID_FORCE_INLINE void transpose_block(const double* SENKAID_RESTRICT src, std::size_t lds,
+                                          double* SENKAID_RESTRICT dst, std::size_t ldd)
+{
+    const __m128d r0 = _mm_loadu_pd(src);
+    const __m128d r1 = _mm_loadu_pd(src + lds);
+
+    if constexpr (Stream)
+    {
+        _mm_stream_pd(dst, _mm_unpacklo_pd(r0, r1));
+        _mm_stream_pd(dst + ldd, _mm_unpackhi_pd(r0, r1));
+    }
+    else
+    {
+        _mm_storeu_pd(dst, _mm_unpacklo_pd(r0, r1));
+        _mm_storeu_pd(dst + ldd, _mm_unpackhi_pd(r0, r1));
+    }
+}
+
+// 4x4 float.
+template <bool Stream>
+SENKAID_FORCE_INLINE void transpose_block(const float* SENKAID_RESTRICT src, std::size_t lds,
+                                          float* SENKAID_RESTRICT dst, std::size_t ldd)
+{
+    __m128 r0 = _mm_loadu_ps(src);
+    __m128 r1 = _mm_loadu_ps(src + lds);
+    __m128 r2 = _mm_loadu_ps(src + 2 * lds);
+    __m128 r3 = _mm_loadu_ps(src + 3 * lds);
+    _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+    if constexpr (Stream)
+    {
+        _mm_stream_ps(dst, r0);
+        _mm_stream_ps(dst + ldd, r1);
+        _mm_stream_ps(dst + 2 * ldd, r2);
+        _mm_stream_ps(dst + 3 * ldd, r3);
+    }
+    else
+    {
+        _mm_storeu_ps(dst, r0);
+        _mm_storeu_ps(dst + ldd, r1);
+        _mm_storeu_ps(dst + 2 * ldd, r2);
+        _mm_storeu_ps(dst + 3 * ldd, r3);
+    }
+}
+
+#endif
+
+} // namespace detail
+
+// transpose_block: Transposes one transpose_block_size<TN> square block.
+// Parameters:
+//   src, lds - Source block and its line stride (elements).
+//   dst, ldd - Destination block and its line stride (elements).
+// Stream = true uses non-temporal stores; every dst line must be transpose_vector_bytes aligned.
+template <bool Stream = false, typename TN>
+SENKAID_FORCE_INLINE void transpose_block(const TN* SENKAID_RESTRICT src, std::size_t lds,
+                                          TN* SENKAID_RESTRICT dst, std::size_t ldd)
+{
+#if defined(SENKAID_HAS_SSE2) || defined(SENKAID_HAS_AVX) || defined(SENKAID_HAS_AVX512)
+    if constexpr (std::is_same_v<TN, double> || std::is_same_v<TN, float>)
+        detail::transpose_block<Stream>(src, lds, dst, ldd);
+    else
+#endif
+        detail::transpose_block_scalar(src, lds, dst, ldd, transpose_block_size<TN>);
+}
+
+} // namespace senkaid::backend::simd
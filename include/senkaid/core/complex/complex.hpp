@@ -1,5 +1,7 @@
 #pragma once
 
+#include <senkaid/utils/memory/traits.hpp>
+
 namespace senkaid::core::complex {
 
 template <typename TN>
@@ -18,6 +20,16 @@ public:
         return { _re + other._re, _im + other._im };
     }
 
+    constexpr complex operator-(const complex& other) const 
+    {
+        return { _re - other._re, _im - other._im };
+    }
+
+    constexpr complex operator-() const 
+    {
+        return { -_re, -_im };
+    }
+
     constexpr complex operator*(const complex& other) const 
     {
         return 
@@ -27,10 +39,29 @@ public:
         };
     }
 
+    constexpr complex& operator+=(const complex& other) { return *this = *this + other; }
+    constexpr complex& operator-=(const complex& other) { return *this = *this - other; }
+    constexpr complex& operator*=(const complex& other) { return *this = *this * other; }
+
+    constexpr bool operator==(const complex& other) const { return _re == other._re && _im == other._im; }
+    constexpr bool operator!=(const complex& other) const { return !(*this == other); }
+
     friend constexpr complex conjugate(const complex& z) 
     {
         return { z._re, -z._im };
     }
 };
 
+// The SIMD kernels in complex_simd.hpp treat complex<TN> arrays as interleaved TN arrays.
+static_assert(sizeof(complex<float>) == 2 * sizeof(float) && sizeof(complex<double>) == 2 * sizeof(double),
+              "complex: layout must be two packed parts");
+
 };
+
+namespace senkaid::memory {
+
+// complex() is two zero parts, so buffers of it may be cleared bytewise.
+template <typename TN>
+inline constexpr bool zero_bits<core::complex::complex<TN>> = zero_bits<TN>;
+
+} // namespace senkaid::memory
@@ -0,0 +1,42 @@
+#pragma once
+
+// complex_math.hpp: Scalar functions of core::complex::complex.
+// Array versions of abs() and arg() live in complex_simd.hpp.
+
+#include <senkaid/utils/config/root.hpp>
+#include "complex.hpp"
+
+#include <cmath>
+
+namespace senkaid::core::complex
+{
+
+// abs: |z|, without intermediate overflow or underflow.
+template <typename TN>
+SENKAID_FORCE_INLINE TN abs(const complex<TN>& z)
+{
+    return std::hypot(z._re, z._im);
+}
+
+// arg: Phase angle of z in [-pi, pi].
+template <typename TN>
+SENKAID_FORCE_INLINE TN arg(const complex<TN>& z)
+{
+    return std::atan2(z._im, z._re);
+}
+
+// norm: |z|^2.
+template <typename TN>
+constexpr SENKAID_FORCE_INLINE TN norm(const complex<TN>& z)
+{
+    return z._re * z._re + z._im * z._im;
+}
+
+// polar: r * (cos(theta) + i sin(theta)).
+template <typename TN>
+SENKAID_FORCE_INLINE complex<TN> polar(TN r, TN theta)
+{
+    return { r * std::cos(theta), r * std::sin(theta) };
+}
+
+} // namespace senkaid::core::complex
@@ -0,0 +1,384 @@
+#pragma once
+
+// complex_simd.hpp: Vectorized BLAS-1 style kernels over arrays of complex<float> / complex<double>.
+// The arrays are read as interleaved real arrays and processed with backend::simd::cpack; the
+// ragged end goes through a masked load/store rather than a scalar loop. Other element types
+// take a plain loop over the complex operators.
+//
+// The dot products do not multiply complex numbers inside the loop. They accumulate the real
+// products x * y and x * swap(y) lane by lane, which needs one shuffle and two FMAs per vector,
+// and form the complex result from the even and odd lane sums once at the end.
+
+#include <senkaid/utils/config/root.hpp>
+#include <senkaid/utils/debug/root.hpp>
+#include <senkaid/backend/simd/simd_complex.hpp>
+#include <senkaid/backend/simd/simd_load_store.hpp>
+#include "complex.hpp"
+#include "complex_math.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+
+namespace senkaid::core::complex
+{
+
+namespace detail
+{
+
+template <typename TN>
+inline constexpr bool simd_complex = std::is_same_v<TN, float> || std::is_same_v<TN, double>;
+
+template <typename TN>
+SENKAID_FORCE_INLINE const TN* parts(const complex<TN>* p) noexcept
+{
+    return reinterpret_cast<const TN*>(p);
+}
+
+template <typename TN>
+SENKAID_FORCE_INLINE TN* parts(complex<TN>* p) noexcept
+{
+    return reinterpret_cast<TN*>(p);
+}
+
+// dot_lanes: Lane sums of x * y into s1 and x * swap(y) into s2, over n complex elements.
+template <typename TN>
+SENKAID_FORCE_INLINE void dot_lanes(const TN* SENKAID_RESTRICT x, const TN* SENKAID_RESTRICT y, std::size_t n,
+                                    TN* s1, TN* s2)
+{
+    using C = backend::simd::cpack<TN>;
+    using P = typename C::real_pack;
+    constexpr std::size_t N = C::lanes;
+    constexpr std::size_t W = 2 * N;
+
+    P a0 = P::zero(), a1 = P::zero(), b0 = P::zero(), b1 = P::zero();
+
+    std::size_t i = 0;
+    for (; i + 2 * N <= n; i += 2 * N)
+    {
+        backend::simd::prefetch(x + 2 * i + backend::simd::prefetch_distance<TN>);
+        backend::simd::prefetch(y + 2 * i + backend::simd::prefetch_distance<TN>);
+        const C x0 = C::loadu(x + 2 * i), x1 = C::loadu(x + 2 * i + W);
+        const C y0 = C::loadu(y + 2 * i), y1 = C::loadu(y + 2 * i + W);
+        a0 = fma(x0.value(), y0.value(), a0);
+        a1 = fma(x1.value(), y1.value(), a1);
+        b0 = fma(x0.value(), swap(y0), b0);
+        b1 = fma(x1.value(), swap(y1), b1);
+    }
+    for (; i < n; i += N)
+    {
+        const std::size_t count = std::min(N, n - i);
+        const C x0 = C::load(x + 2 * i, count);
+        const C y0 = C::load(y + 2 * i, count);
+        a0 = fma(x0.value(), y0.value(), a0);
+        b0 = fma(x0.value(), swap(y0), b0);
+    }
+
+    (a0 + a1).storeu(s1);
+    (b0 + b1).storeu(s2);
+}
+
+} // namespace detail
+
+// dotu: sum of x[i] * y[i].
+template <typename TN>
+complex<TN> dotu(const complex<TN>* x, const complex<TN>* y, std::size_t n)
+{
+    if constexpr (detail::simd_complex<TN>)
+    {
+        constexpr std::size_t W = 2 * backend::simd::cpack<TN>::lanes;
+        TN s1[W], s2[W];
+        detail::dot_lanes(detail::parts(x), detail::parts(y), n, s1, s2);
+
+        // s1 = (xr yr, xi yi), s2 = (xr yi, xi yr) per pair.
+        complex<TN> r;
+        for (std::size_t k = 0; k < W; k += 2)
+        {
+            r._re += s1[k] - s1[k + 1];
+            r._im += s2[k] + s2[k + 1];
+        }
+        return r;
+    }
+    else
+    {
+        complex<TN> r;
+        for (std::size_t i = 0; i < n; ++i)
+            r += x[i] * y[i];
+        return r;
+    }
+}
+
+// dotc: sum of conj(x[i]) * y[i].
+template <typename TN>
+complex<TN> dotc(const complex<TN>* x, const complex<TN>* y, std::size_t n)
+{
+    if constexpr (detail::simd_complex<TN>)
+    {
+        constexpr std::size_t W = 2 * backend::simd::cpack<TN>::lanes;
+        TN s1[W], s2[W];
+        detail::dot_lanes(detail::parts(x), detail::parts(y), n, s1, s2);
+
+        complex<TN> r;
+        for (std::size_t k = 0; k < W; k += 2)
+        {
+            r._re += s1[k] + s1[k + 1];
+            r._im += s2[k] - s2[k + 1];
+        }
+        return r;
+    }
+    else
+    {
+        complex<TN> r;
+        for (std::size_t i = 0; i < n; ++i)
+            r += conjugate(x[i]) * y[i];
+        return r;
+    }
+}
+
+// axpy: y[i] += a * x[i].
+template <typename TN>
+void axpy(complex<TN> a, const complex<TN>* x, complex<TN>* y, std::size_t n)
+{
+    if constexpr (detail::simd_complex<TN>)
+    {
+        using C = backend::simd::cpack<TN>;
+        constexpr std::size_t N = C::lanes;
+
+        const TN* SENKAID_RESTRICT px = detail::parts(x);
+        TN* SENKAID_RESTRICT py = detail::parts(y);
+        const C va(a._re, a._im);
+
+        std::size_t i = 0;
+        for (; i + N <= n; i += N)
+            fma(C::loadu(px + 2 * i), va, C::loadu(py + 2 * i)).storeu(py + 2 * i);
+        if (i < n)
+            fma(C::load(px + 2 * i, n - i), va, C::load(py + 2 * i, n - i)).store(py + 2 * i, n - i);
+    }
+    else
+    {
+        for (std::size_t i = 0; i < n; ++i)
+            y[i] += a * x[i];
+    }
+}
+
+// rot: Plane rotation with real cosine, x[i] = c x[i] + s y[i], y[i] = c y[i] - conj(s) x[i].
+template <typename TN>
+void rot(complex<TN>* x, complex<TN>* y, std::size_t n, TN c, complex<TN> s)
+{
+    if constexpr (detail::simd_complex<TN>)
+    {
+        using C = backend::simd::cpack<TN>;
+        using P = typename C::real_pack;
+        constexpr std::size_t N = C::lanes;
+
+        TN* SENKAID_RESTRICT px = detail::parts(x);
+        TN* SENKAID_RESTRICT py = detail::parts(y);
+        const P vc(c);
+        const C vs(s._re, s._im);
+        const C vsc(s._re, -s._im);
+
+        const auto step = [&](C xi, C yi, C& xo, C& yo) {
+            xo = fma(yi, vs, scale(xi, vc));
+            yo = scale(yi, vc) - vsc * xi;
+        };
+
+        std::size_t i = 0;
+        for (; i + N <= n; i += N)
+        {
+            C xo, yo;
+            step(C::loadu(px + 2 * i), C::loadu(py + 2 * i), xo, yo);
+            xo.storeu(px + 2 * i);
+            yo.storeu(py + 2 * i);
+        }
+        if (i < n)
+        {
+            C xo, yo;
+            step(C::load(px + 2 * i, n - i), C::load(py + 2 * i, n - i), xo, yo);
+            xo.store(px + 2 * i, n - i);
+            yo.store(py + 2 * i, n - i);
+        }
+    }
+    else
+    {
+        const complex<TN> sc = conjugate(s);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const complex<TN> xi = x[i];
+            const complex<TN> yi = y[i];
+            x[i] = complex<TN>(c) * xi + s * yi;
+            y[i] = complex<TN>(c) * yi - sc * xi;
+        }
+    }
+}
+
+namespace detail
+{
+
+// binary_map: out[i] = fn(x[i], y[i]) on cpacks.
+template <typename TN, typename Fn>
+SENKAID_FORCE_INLINE void binary_map(const complex<TN>* x, const complex<TN>* y, complex<TN>* out, std::size_t n, Fn fn)
+{
+    using C = backend::simd::cpack<TN>;
+    constexpr std::size_t N = C::lanes;
+
+    const TN* px = parts(x);
+    const TN* py = parts(y);
+    TN* po = parts(out);
+
+    std::size_t i = 0;
+    for (; i + N <= n; i += N)
+        fn(C::loadu(px + 2 * i), C::loadu(py + 2 * i)).storeu(po + 2 * i);
+    if (i < n)
+        fn(C::load(px + 2 * i, n - i), C::load(py + 2 * i, n - i)).store(po + 2 * i, n - i);
+}
+
+// split_map: out[i] = fn(re(x[i]), im(x[i])) for a real result, 2N elements per step.
+template <typename TN, typename Fn>
+SENKAID_FORCE_INLINE void split_map(const complex<TN>* x, TN* out, std::size_t n, Fn fn)
+{
+    using C = backend::simd::cpack<TN>;
+    using P = typename C::real_pack;
+    constexpr std::size_t N = C::lanes;
+
+    const TN* px = parts(x);
+
+    std::size_t i = 0;
+    for (; i + 2 * N <= n; i += 2 * N)
+    {
+        P re, im;
+        deinterleave(C::loadu(px + 2 * i), C::loadu(px + 2 * i + 2 * N), re, im);
+        fn(re, im).storeu(out + i);
+    }
+    if (i < n)
+    {
+        const std::size_t rem = n - i;
+        P re, im;
+        deinterleave(C::load(px + 2 * i, std::min(rem, N)), C::load(px + 2 * i + 2 * N, rem > N ? rem - N : 0), re, im);
+        fn(re, im).store(out + i, P::mask_type::first_n(rem));
+    }
+}
+
+} // namespace detail
+
+// mul: out[i] = x[i] * y[i]; out may alias x or y.
+template <typename TN>
+void mul(const complex<TN>* x, const complex<TN>* y, complex<TN>* out, std::size_t n)
+{
+    if constexpr (detail::simd_complex<TN>)
+        detail::binary_map(x, y, out, n, [](auto a, auto b) { return a * b; });
+    else
+        for (std::size_t i = 0; i < n; ++i)
+            out[i] = x[i] * y[i];
+}
+
+// mul_conj: out[i] = conj(x[i]) * y[i]; out may alias x or y.
+template <typename TN>
+void mul_conj(const complex<TN>* x, const complex<TN>* y, complex<TN>* out, std::size_t n)
+{
+    if constexpr (detail::simd_complex<TN>)
+        detail::binary_map(x, y, out, n, [](auto a, auto b) { return mul_conj(a, b); });
+    else
+        for (std::size_t i = 0; i < n; ++i)
+            out[i] = conjugate(x[i]) * y[i];
+}
+
+// abs: out[i] = |x[i]|.
+template <typename TN>
+void abs(const complex<TN>* x, TN* out, std::size_t n)
+{
+    if constexpr (detail::simd_complex<TN>)
+        detail::split_map(x, out, n, [](auto re, auto im) { return backend::simd::hypot(re, im); });
+    else
+        for (std::size_t i = 0; i < n; ++i)
+            out[i] = abs(x[i]);
+}
+
+// arg: out[i] = arg(x[i]), within the atan2 bound of backend/simd/simd_math.hpp.
+template <typename TN>
+void arg(const complex<TN>* x, TN* out, std::size_t n)
+{
+    if constexpr (detail::simd_complex<TN>)
+        detail::split_map(x, out, n, [](auto re, auto im) { return backend::simd::atan2(im, re); });
+    else
+        for (std::size_t i = 0; i < n; ++i)
+            out[i] = arg(x[i]);
+}
+
+// split: Interleaved to planar, re[i] = x[i]._re, im[i] = x[i]._im.
+template <typename TN>
+void split(const complex<TN>* x, TN* re, TN* im, std::size_t n)
+{
+    if constexpr (detail::simd_complex<TN>)
+    {
+        using C = backend::simd::cpack<TN>;
+        using P = typename C::real_pack;
+        constexpr std::size_t N = C::lanes;
+
+        const TN* px = detail::parts(x);
+
+        std::size_t i = 0;
+        for (; i + 2 * N <= n; i += 2 * N)
+        {
+            P r, m;
+            deinterleave(C::loadu(px + 2 * i), C::loadu(px + 2 * i + 2 * N), r, m);
+            r.storeu(re + i);
+            m.storeu(im + i);
+        }
+        if (i < n)
+        {
+            const std::size_t rem = n - i;
+            const auto tail = P::mask_type::first_n(rem);
+            P r, m;
+            deinterleave(C::load(px + 2 * i, std::min(rem, N)), C::load(px + 2 * i + 2 * N, rem > N ? rem - N : 0), r, m);
+            r.store(re + i, tail);
+            m.store(im + i, tail);
+        }
+    }
+    else
+    {
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            re[i] = x[i]._re;
+            im[i] = x[i]._im;
+        }
+    }
+}
+
+// merge: Planar to interleaved, inverse of split().
+template <typename TN>
+void merge(const TN* re, const TN* im, complex<TN>* x, std::size_t n)
+{
+    if constexpr (detail::simd_complex<TN>)
+    {
+        using C = backend::simd::cpack<TN>;
+        using P = typename C::real_pack;
+        constexpr std::size_t N = C::lanes;
+
+        TN* px = detail::parts(x);
+
+        std::size_t i = 0;
+        for (; i + 2 * N <= n; i += 2 * N)
+        {
+            C a, b;
+            interleave(P::loadu(re + i), P::loadu(im + i), a, b);
+            a.storeu(px + 2 * i);
+            b.storeu(px + 2 * i + 2 * N);
+        }
+        if (i < n)
+        {
+            const std::size_t rem = n - i;
+            const auto tail = P::mask_type::first_n(rem);
+            C a, b;
+            interleave(P::load(re + i, tail), P::load(im + i, tail), a, b);
+            a.store(px + 2 * i, std::min(rem, N));
+            b.store(px + 2 * i + 2 * N, rem > N ? rem - N : 0);
+        }
+    }
+    else
+    {
+        for (std::size_t i = 0; i < n; ++i)
+            x[i] = complex<TN>(re[i], im[i]);
+    }
+}
+
+} // namespace senkaid::core::complex
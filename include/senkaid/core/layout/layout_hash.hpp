@@ -0,0 +1,60 @@
+#pragma once
+
+// layout_hash.hpp: Hashes of layout descriptors, for caches keyed on how a buffer is read.
+// A layout hash covers the extents, the leading dimension, the storage order and the element
+// type's size and kind: two buffers with equal hashes are read identically by any kernel, so a
+// cached artefact derived from one (a packed copy, a tuned kernel choice) fits the other. The
+// hash says nothing about the contents. Everything is constexpr and the mixing is splitmix64's
+// finalizer, so the values are the same on every platform and build.
+//
+//   const std::uint64_t key = core::layout::layout_hash(w);
+//   if (key != cached_key) repack(w);
+
+#include <senkaid/utils/config/root.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace senkaid::core::layout
+{
+
+// hash_mix: Folds v into the running hash h.
+constexpr std::uint64_t hash_mix(std::uint64_t h, std::uint64_t v) noexcept
+{
+    std::uint64_t x = h ^ (v + 0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2));
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+    return x ^ (x >> 31);
+}
+
+// element_tag: Size and kind (floating, signed, integral) of TN.
+template <typename TN>
+constexpr std::uint64_t element_tag() noexcept
+{
+    return static_cast<std::uint64_t>(sizeof(TN)) | static_cast<std::uint64_t>(std::is_floating_point_v<TN>) << 16
+         | static_cast<std::uint64_t>(std::is_signed_v<TN>) << 17 | static_cast<std::uint64_t>(std::is_integral_v<TN>) << 18;
+}
+
+// layout_hash: Hash of a rows x cols buffer of TN, row-major or column-major, with leading
+// dimension ld (elements between consecutive rows or columns).
+template <typename TN>
+constexpr std::uint64_t layout_hash(std::size_t rows, std::size_t cols, std::size_t ld, bool row_major) noexcept
+{
+    std::uint64_t h = hash_mix(0, element_tag<TN>());
+    h = hash_mix(h, rows);
+    h = hash_mix(h, cols);
+    h = hash_mix(h, ld);
+    return hash_mix(h, row_major ? 0x01 : 0x02);
+}
+
+// layout_hash: Hash of a contiguous matrix (anything with value_type, major, rows() and cols()).
+template <typename M>
+requires requires(const M& a) { typename M::value_type; M::major; a.rows(); a.cols(); }
+constexpr std::uint64_t layout_hash(const M& a) noexcept
+{
+    constexpr bool row_major = M::major == decltype(M::major)::RowMajor;
+    return layout_hash<typename M::value_type>(a.rows(), a.cols(), row_major ? a.cols() : a.rows(), row_major);
+}
+
+} // namespace senkaid::core::layout
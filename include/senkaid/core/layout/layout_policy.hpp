@@ -0,0 +1,110 @@
+#pragma once
+
+// layout_policy.hpp: Layout descriptors for matrix storage.
+// Describes how logical indices map to positions in a flat buffer; never owns memory.
+
+#include <senkaid/utils/config/root.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace senkaid::core::layout
+{
+
+// compact_vector_bytes: Width of one interleaved element group, i.e. the widest native vector.
+#if defined(SENKAID_HAS_AVX512)
+    inline constexpr std::size_t compact_vector_bytes = 64;
+#elif defined(SENKAID_HAS_AVX)
+    inline constexpr std::size_t compact_vector_bytes = 32;
+#else
+    inline constexpr std::size_t compact_vector_bytes = 16;
+#endif
+
+// compact_lanes: Number of matrices interleaved per group for element type TN.
+template <typename TN>
+inline constexpr std::size_t compact_lanes = compact_vector_bytes / sizeof(TN) > 0 ? compact_vector_bytes / sizeof(TN) : 1;
+
+// SDCompactLayout: "Compact" interleaved layout for batches of small Rows x Cols matrices.
+// Matrices are grouped Lanes at a time; inside a group, element (i, j) of all Lanes matrices
+// is stored contiguously (column-major over (i, j)), so one vector register holds the same
+// element of Lanes different problems:
+//
+//   group g: | a0(0,0) a1(0,0) .. aL(0,0) | a0(1,0) a1(1,0) .. aL(1,0) | ... | a0(R-1,C-1) .. |
+//
+// Kernels then run the scalar algorithm once per group with every operation Lanes wide,
+// which keeps the vector units full even for 4x4 problems.
+template <std::size_t Rows, std::size_t Cols, std::size_t Lanes>
+struct SDCompactLayout
+{
+    static constexpr std::size_t rows = Rows;
+    static constexpr std::size_t cols = Cols;
+    static constexpr std::size_t lanes = Lanes;
+    static constexpr std::size_t group_size = Rows * Cols * Lanes;
+
+    // groups: Number of groups needed for `count` matrices (the last one may be partial).
+    static constexpr std::size_t groups(std::size_t count) noexcept
+    {
+        return (count + Lanes - 1) / Lanes;
+    }
+
+    // element: Offset of element (i, j) inside a group, in units of TN (lane 0).
+    static constexpr std::size_t element(std::size_t i, std::size_t j) noexcept
+    {
+        return (i + j * Rows) * Lanes;
+    }
+
+    // offset: Position of element (i, j) of matrix `index` in the flat batch buffer.
+    static constexpr std::size_t offset(std::size_t index, std::size_t i, std::size_t j) noexcept
+    {
+        return (index / Lanes) * group_size + element(i, j) + index % Lanes;
+    }
+};
+
+// SDComplexLayout: How the two parts of complex elements are placed in memory.
+//   Interleaved - re, im, re, im, ... (complex<TN> arrays, SDDenseMatrix<..., complex<TN>>).
+//   Planar      - all real parts, then all imaginary parts (SDPlanarMatrix).
+enum class SDComplexLayout : std::uint8_t
+{
+    Interleaved = 0x01,
+    Planar = 0x02
+};
+
+// SDPlanarLayout: Split storage for `count` complex elements with parts of type TN.
+// The real plane comes first and the imaginary plane starts at the next vector boundary, so
+// both planes are aligned and element k has the same offset inside either one:
+//
+//   | re(0) re(1) .. re(count-1) pad | im(0) im(1) .. im(count-1) pad |
+//
+// A complex multiply on planar data is four real multiplies and two adds on whole vectors,
+// with none of the lane shuffles the interleaved layout needs.
+template <typename TN>
+struct SDPlanarLayout
+{
+    static constexpr SDComplexLayout kind = SDComplexLayout::Planar;
+    static constexpr std::size_t plane_granule = compact_lanes<TN>;
+
+    // plane_stride: Distance between the two planes, count rounded up to whole vectors.
+    static constexpr std::size_t plane_stride(std::size_t count) noexcept
+    {
+        return (count + plane_granule - 1) / plane_granule * plane_granule;
+    }
+
+    // buffer_size: Elements of TN needed for both planes.
+    static constexpr std::size_t buffer_size(std::size_t count) noexcept
+    {
+        return 2 * plane_stride(count);
+    }
+
+    // real / imag: Offsets of the parts of element k.
+    static constexpr std::size_t real(std::size_t, std::size_t k) noexcept
+    {
+        return k;
+    }
+
+    static constexpr std::size_t imag(std::size_t count, std::size_t k) noexcept
+    {
+        return plane_stride(count) + k;
+    }
+};
+
+} // namespace senkaid::core::layout
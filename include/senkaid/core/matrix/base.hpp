@@ -8,6 +8,9 @@
 #include <tuple>
 #include <type_traits>
 #include <senkaid/core/complex/complex.hpp>
+#include <senkaid/core/complex/complex_simd.hpp>
+#include <senkaid/backend/cpu/dot_cpu.hpp>
+#include <senkaid/backend/cpu/reduce_cpu.hpp>
 
 namespace senkaid::core::matrix
 {
@@ -88,23 +91,25 @@ public:
 
     constexpr SENKAID_FORCE_INLINE TN sum() const
     {
-        return Derived::sum(*this); 
+        return Derived::sum(static_cast<const Derived&>(*this));
     };
 
+    // fma: this * b + c entrywise; b and c are matrices of this shape or scalars.
     template <typename TM, typename TO>
     constexpr SENKAID_FORCE_INLINE Derived fma(const TM& b, const TO& c) const
     {
         if constexpr (MatrixScalar<TM, TO>)
-            return Derived::axpy(*this, b, c);
+            return Derived::axpy(static_cast<const Derived&>(*this), b, c);
         else
             static_assert(unsupported_false<TM>, "Unsupported argument types for fma");
     };
  
+    // fma_inplace: this = this * b + c entrywise.
     template <typename TM, typename TO>
-    constexpr SENKAID_FORCE_INLINE Derived fma_inplace(const TM& b, const TO& c)
+    constexpr SENKAID_FORCE_INLINE Derived& fma_inplace(const TM& b, const TO& c)
     {
         if constexpr (MatrixScalar<TM, TO>)
-            return Derived::axpy_inplace(*this, b, c);
+            return Derived::axpy_inplace(static_cast<Derived&>(*this), b, c);
         else
             static_assert(unsupported_false<TM>, "Unsupported argument types for fma_inplace");
     };
@@ -182,52 +187,50 @@ public:
         return Derived::conjugate_inplace(derived);
     }
 
-    constexpr SENKAID_FORCE_INLINE TN norm(size_t p_order = 2)
+    constexpr SENKAID_FORCE_INLINE TN norm(size_t p_order = 2) const
     {
         if (p_order < 1)
             SENKAID_LOG_WARNING("error in norm function: p_order less than 1");
 
-        return Derived::norm(*this, p_order);
+        return Derived::norm(static_cast<const Derived&>(*this), p_order);
     }
      
     template <typename TM>
-    constexpr static SENKAID_FORCE_INLINE void rot(TN* x, TN* y, std::size_t n, TN c, TN s) // TODO: SIMD and GPU instructions
+    constexpr static SENKAID_FORCE_INLINE void rot(TN* x, TN* y, std::size_t n, TN c, TN s) // TODO: GPU instructions
     {
         if constexpr (std::is_same_v<TN, senkaid::core::complex::complex<TM>>)
         {
-            for (std::size_t i = 0; i < n; ++i)
-            {
-                TN xi = x[i];
-                TN yi = y[i];
-
-                x[i] = c * xi + s * yi;
-                y[i] = Derived::conjugate(-s) * xi + c * yi;
-            }
-
+            // c is real for a complex rotation; only its real part is used.
+            senkaid::core::complex::rot(x, y, n, c._re, s);
         }
         else 
         {
-            for (std::size_t i = 0; i < n; ++i)
-            {
-                TN xi = x[i];
-                TN yi = y[i];
-
-                x[i] = c * xi + s * yi;
-                y[i] = -s * xi + c * yi;
-            }
+            senkaid::backend::cpu::rot(x, y, n, c, s);
         }
     }; 
 
-    constexpr static SENKAID_FORCE_INLINE TN norm(TN* x, std::size_t sox, std::size_t p_order)
+    // norm: p-norm of x[0, sox). Floating-point buffers use the one-pass kernels of
+    // backend/cpu/reduce_cpu.hpp (NaN for p_order 0); other types sum |x[i]|^p in double.
+    constexpr static SENKAID_FORCE_INLINE TN norm(const TN* x, std::size_t sox, std::size_t p_order)
     {
-        TN inner = 0;
-
-        for (std::size_t i = 0; i < sox; ++i)
+        if constexpr (std::is_floating_point_v<TN>)
         {
-            inner += std::pow(x, p_order);
+            return senkaid::backend::cpu::norm(x, sox, static_cast<TN>(p_order));
         }
+        else
+        {
+            using std::abs;
+            if (p_order < 1)
+                return TN(0);
 
-        return std::sqrt(inner, p_order);
+            double inner = 0;
+            for (std::size_t i = 0; i < sox; ++i)
+            {
+                inner += std::pow(static_cast<double>(abs(x[i])), static_cast<double>(p_order));
+            }
+
+            return TN(std::pow(inner, 1.0 / static_cast<double>(p_order)));
+        }
     };
 
     // Fortran-style based because code from drotmg.f
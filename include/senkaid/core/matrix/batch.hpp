@@ -0,0 +1,185 @@
+#pragma once
+
+// batch.hpp: Batches of fixed-size matrices stored in the compact interleaved layout.
+// SDCompactBatch owns the buffer; conversion from and to ordinary SDDenseMatrix objects
+// (either major) is done with pack() / unpack().
+
+#include <senkaid/utils/config/root.hpp>
+#include <senkaid/utils/debug/root.hpp>
+#include <senkaid/utils/memory/utils.hpp>
+#include <senkaid/core/allocator/alignment.hpp>
+#include <senkaid/core/layout/layout_policy.hpp>
+#include "dense.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <new>
+#include <span>
+#include <utility>
+
+namespace senkaid::core::matrix
+{
+
+// SDCompactBatch: `count` Rows x Cols matrices interleaved compact_lanes<TN> at a time.
+// Padding lanes of the last group hold the identity (zero for non-square shapes) so batched
+// factorizations never divide by zero in unused lanes.
+template <int Rows, int Cols, typename TN = double>
+class SDCompactBatch
+{
+    static_assert(Rows > 0 && Cols > 0, "SDCompactBatch: only fixed-size matrices can be batched");
+
+public:
+    using value_type = TN;
+    using size_type = std::size_t;
+    using layout_type = layout::SDCompactLayout<Rows, Cols, layout::compact_lanes<TN>>;
+
+    static constexpr size_type lanes = layout_type::lanes;
+    static constexpr size_type group_size = layout_type::group_size;
+
+    SDCompactBatch() noexcept : _data(nullptr), _count(0) {}
+
+    explicit SDCompactBatch(size_type count) : _data(nullptr), _count(count)
+    {
+        allocate();
+        reset_padding();
+    }
+
+    SDCompactBatch(const SDCompactBatch& other) : _data(nullptr), _count(other._count)
+    {
+        allocate();
+        if (_data)
+            memory::copy_elements(_data, other._data, buffer_size());
+    }
+
+    SDCompactBatch(SDCompactBatch&& other) noexcept
+        : _data(std::exchange(other._data, nullptr)), _count(std::exchange(other._count, 0))
+    {
+    }
+
+    SDCompactBatch& operator=(SDCompactBatch other) noexcept
+    {
+        std::swap(_data, other._data);
+        std::swap(_count, other._count);
+        return *this;
+    }
+
+    ~SDCompactBatch()
+    {
+        core::allocator::aligned_free(_data);
+    }
+
+    // from: Builds a batch holding a copy of `matrices`.
+    template <SDMajor Major>
+    static SDCompactBatch from(std::span<const SDDenseMatrix<Rows, Cols, TN, Major>> matrices)
+    {
+        SDCompactBatch batch(matrices.size());
+        batch.pack(matrices);
+        return batch;
+    }
+
+    // pack: Copies matrices[k] into slot `first + k` of the batch.
+    template <SDMajor Major>
+    void pack(std::span<const SDDenseMatrix<Rows, Cols, TN, Major>> matrices, size_type first = 0)
+    {
+        SENKAID_ASSERT(first + matrices.size() <= _count, "SDCompactBatch::pack: range exceeds batch");
+
+        for (size_type k = 0; k < matrices.size(); ++k)
+        {
+            const TN* src = matrices[k].data();
+            TN* dst = _data + layout_type::offset(first + k, 0, 0);
+
+            for (size_type j = 0; j < Cols; ++j)
+                for (size_type i = 0; i < Rows; ++i)
+                    dst[layout_type::element(i, j)] = src[matrices[k].index(i, j)];
+        }
+    }
+
+    // from / pack: The same for non-const matrices (Major is deduced, so std::span(v) on a non-const
+    // vector would not convert to the const overloads).
+    template <SDMajor Major>
+    static SDCompactBatch from(std::span<SDDenseMatrix<Rows, Cols, TN, Major>> matrices)
+    {
+        return from(std::span<const SDDenseMatrix<Rows, Cols, TN, Major>>(matrices));
+    }
+
+    template <SDMajor Major>
+    void pack(std::span<SDDenseMatrix<Rows, Cols, TN, Major>> matrices, size_type first = 0)
+    {
+        pack(std::span<const SDDenseMatrix<Rows, Cols, TN, Major>>(matrices), first);
+    }
+
+    // unpack: Copies slot `first + k` of the batch into matrices[k].
+    template <SDMajor Major>
+    void unpack(std::span<SDDenseMatrix<Rows, Cols, TN, Major>> matrices, size_type first = 0) const
+    {
+        SENKAID_ASSERT(first + matrices.size() <= _count, "SDCompactBatch::unpack: range exceeds batch");
+
+        for (size_type k = 0; k < matrices.size(); ++k)
+        {
+            TN* dst = matrices[k].data();
+            const TN* src = _data + layout_type::offset(first + k, 0, 0);
+
+            for (size_type j = 0; j < Cols; ++j)
+                for (size_type i = 0; i < Rows; ++i)
+                    dst[matrices[k].index(i, j)] = src[layout_type::element(i, j)];
+        }
+    }
+
+    // operator(): Element (i, j) of matrix `index`.
+    SENKAID_FORCE_INLINE TN& operator()(size_type index, size_type i, size_type j)
+    {
+        SENKAID_ASSERT(index < _count && i < Rows && j < Cols, "SDCompactBatch: index out of range");
+        return _data[layout_type::offset(index, i, j)];
+    }
+
+    SENKAID_FORCE_INLINE const TN& operator()(size_type index, size_type i, size_type j) const
+    {
+        SENKAID_ASSERT(index < _count && i < Rows && j < Cols, "SDCompactBatch: index out of range");
+        return _data[layout_type::offset(index, i, j)];
+    }
+
+    // group: First element of interleaved group g (lanes * Rows * Cols values).
+    SENKAID_FORCE_INLINE TN* group(size_type g) noexcept { return _data + g * group_size; }
+    SENKAID_FORCE_INLINE const TN* group(size_type g) const noexcept { return _data + g * group_size; }
+
+    // reset_padding: Restores the identity in the unused lanes of the last group.
+    void reset_padding() noexcept
+    {
+        const size_type used = _count % lanes;
+        if (used == 0)
+            return;
+
+        TN* last = group(groups() - 1);
+        for (size_type j = 0; j < Cols; ++j)
+            for (size_type i = 0; i < Rows; ++i)
+                for (size_type l = used; l < lanes; ++l)
+                    last[layout_type::element(i, j) + l] = i == j ? TN(1) : TN(0);
+    }
+
+    SENKAID_FORCE_INLINE size_type count() const noexcept { return _count; }
+    SENKAID_FORCE_INLINE size_type groups() const noexcept { return layout_type::groups(_count); }
+    SENKAID_FORCE_INLINE size_type buffer_size() const noexcept { return groups() * group_size; }
+    SENKAID_FORCE_INLINE TN* data() noexcept { return _data; }
+    SENKAID_FORCE_INLINE const TN* data() const noexcept { return _data; }
+
+    static constexpr size_type rows() noexcept { return Rows; }
+    static constexpr size_type cols() noexcept { return Cols; }
+
+private:
+    void allocate()
+    {
+        if (_count == 0)
+            return;
+
+        _data = static_cast<TN*>(core::allocator::aligned_malloc(buffer_size() * sizeof(TN),
+                                                                 layout::compact_vector_bytes));
+        if (SENKAID_UNLIKELY(_data == nullptr))
+            throw std::bad_alloc();
+        memory::zero_elements(_data, buffer_size());
+    }
+
+    TN* _data;
+    size_type _count;
+};
+
+} // namespace senkaid::core::matrix
@@ -1,8 +1,10 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
-#include <iostream>
+#include <type_traits>
 #include "base.hpp"
+#include "storage.hpp"
 
 namespace senkaid::core::matrix 
 {
@@ -20,6 +22,8 @@ public:
     using Base = SDMatrixBase<TN, SDDenseMatrix<Rows, Columns, TN, Major>>;
     using Base::rotg;
     using Base::rot;
+    using Base::sum;
+    using Base::norm;
 
     using SDDM = SDDenseMatrix<Rows, Columns, TN, Major>;
 
@@ -27,30 +31,82 @@ public:
     using index_type = std::size_t;
     using size_type = std::size_t;
     using shape_type = TN*;
+    using storage_type = SDDenseStorage<TN, Rows, Columns>;
 
-    constexpr SDDenseMatrix()
+    static constexpr int rows_at_compile_time = Rows;
+    static constexpr int cols_at_compile_time = Columns;
+    static constexpr bool is_fixed = Rows > 0 && Columns > 0;
+    static constexpr SDMajor major = Major;
+
+    // Fixed-size matrices are zero-initialized; dynamic ones start empty.
+    constexpr SDDenseMatrix() = default;
+
+    SDDenseMatrix(size_type rows, size_type cols) : _storage(rows, cols) {}
+
+    // ACCESS
+
+    constexpr SENKAID_FORCE_INLINE size_type rows() const noexcept { return _storage.rows(); }
+    constexpr SENKAID_FORCE_INLINE size_type cols() const noexcept { return _storage.cols(); }
+    constexpr SENKAID_FORCE_INLINE size_type size() const noexcept { return _storage.size(); }
+
+    constexpr SENKAID_FORCE_INLINE TN* data() noexcept { return _storage.data(); }
+    constexpr SENKAID_FORCE_INLINE const TN* data() const noexcept { return _storage.data(); }
+
+    // index: Linear position of (i, j) in data() for this matrix's Major.
+    constexpr SENKAID_FORCE_INLINE size_type index(size_type i, size_type j) const noexcept
     {
-        std::cout << "Constructor with no parameters called.\n";
+        if constexpr (Major == SDMajor::RowMajor)
+            return i * cols() + j;
+        else
+            return i + j * rows();
+    }
+
+    constexpr SENKAID_FORCE_INLINE TN& operator()(size_type i, size_type j)
+    {
+        SENKAID_ASSERT(i < rows() && j < cols(), "SDDenseMatrix: index out of range");
+        return _storage.data()[index(i, j)];
+    }
+
+    constexpr SENKAID_FORCE_INLINE const TN& operator()(size_type i, size_type j) const
+    {
+        SENKAID_ASSERT(i < rows() && j < cols(), "SDDenseMatrix: index out of range");
+        return _storage.data()[index(i, j)];
     }
 
-    
 
     // FUNCTIONS
 
     /* TODO:
-        static axpy(a, b, c)
         static dot(a, b) with support
             - a as value
             - a as ref (&a, b)
-        static sum(Argc...)
         static copy(&a, &b)
         static conjugate(a)
-        static norm(a, p_order)
     */
 
+    // axpy: a * b + c entrywise. Each argument is a matrix of the result's shape and layout or a
+    // scalar, and at least one is a matrix. scalar * matrix + matrix is one fused pass
+    // (backend::cpu::waxpby); the other combinations are a plain element loop.
     template <typename TM, typename TO, typename TP>
     requires MatrixScalar<TM, TO> && MatrixScalar<TO, TP>
-    constexpr SENKAID_FORCE_INLINE static SDDM axpy(TM a, TO b, TP c);
+    static SDDM axpy(const TM& a, const TO& b, const TP& c)
+    {
+        static_assert(!(Scalar<TM> && Scalar<TO> && Scalar<TP>), "axpy: at least one argument must be a matrix");
+
+        const auto& shape = first_matrix(a, b, c);
+        SDDM out(shape.rows(), shape.cols());
+        axpy_into(a, b, c, out);
+        return out;
+    }
+
+    // axpy_inplace: a = a * b + c entrywise; matrix * scalar + matrix is backend::cpu::xpby.
+    template <typename TO, typename TP>
+    requires MatrixScalar<TO, TP>
+    static SDDM& axpy_inplace(SDDM& a, const TO& b, const TP& c)
+    {
+        axpy_into(a, b, c, a);
+        return a;
+    }
 
     template <typename TM, typename TO>
     requires MatrixScalar<TM, TO>
@@ -60,8 +116,19 @@ public:
     requires MatrixScalar<TM, TO>
     constexpr SENKAID_FORCE_INLINE static SDDM dot(TM& a, const TO& b);
 
+    // sum: Sum of every entry of every argument; scalars count once. Matrices of arithmetic TN go
+    // through the blocked vector reduction of backend/cpu/reduce_cpu.hpp.
     template <typename... Args>
-    constexpr SENKAID_FORCE_INLINE static TN sum(Args... args); // usecase: args...
+    constexpr SENKAID_FORCE_INLINE static TN sum(const Args&... args) // usecase: args...
+    {
+        return (TN(0) + ... + sum_of(args));
+    }
+
+    // norm: Entrywise p-norm of a (p_order = 2: Frobenius). Induced norms: ops/linalg/norm.hpp.
+    static TN norm(const SDDM& a, std::size_t p_order)
+    {
+        return Base::norm(a.data(), a.size(), p_order);
+    }
    
     template <typename FROM, typename TO>
     requires Matrix<FROM> && Matrix<TO>
@@ -77,9 +144,75 @@ public:
 
 
 private:
-    TN* _data;
-    size_type _capacity;
-    size_type _size;
+    storage_type _storage;
+
+    template <typename TM, typename... Rest>
+    static const auto& first_matrix(const TM& a, const Rest&... rest)
+    {
+        if constexpr (Scalar<TM>)
+            return first_matrix(rest...);
+        else
+            return a;
+    }
+
+    template <typename TM>
+    static SENKAID_FORCE_INLINE TN entry_of(const TM& a, std::size_t i)
+    {
+        if constexpr (Scalar<TM>)
+            return TN(a);
+        else
+            return TN(a.data()[i]);
+    }
+
+    // axpy_into: out = a * b + c; any matrix argument may be out itself.
+    template <typename TM, typename TO, typename TP>
+    static void axpy_into(const TM& a, const TO& b, const TP& c, SDDM& out)
+    {
+        const auto fits = [&](const auto& m) {
+            if constexpr (Scalar<std::remove_cvref_t<decltype(m)>>)
+                return true;
+            else
+                return m.rows() == out.rows() && m.cols() == out.cols() && std::remove_cvref_t<decltype(m)>::major == Major;
+        };
+        SENKAID_ASSERT(fits(a) && fits(b) && fits(c), "SDDenseMatrix::axpy: operand shape or layout differs from the result");
+
+        const std::size_t n = out.size();
+        TN* w = out.data();
+        if constexpr (std::is_floating_point_v<TN> && Scalar<TM> != Scalar<TO> && Matrix<TP>)
+        {
+            using X = std::remove_cvref_t<decltype(first_matrix(a, b))>;
+            if constexpr (std::is_same_v<typename X::value_type, TN> && std::is_same_v<typename TP::value_type, TN>)
+            {
+                const TN s = Scalar<TM> ? entry_of(a, 0) : entry_of(b, 0);
+                const TN* x = first_matrix(a, b).data();
+                const TN* y = c.data();
+                if (y == w && x != w)
+                    return backend::cpu::axpy(s, x, w, n);
+                if (x == w && y != w)
+                    return backend::cpu::xpby(y, s, w, n);
+                if (x != w && y != w)
+                    return backend::cpu::waxpby(s, x, TN(1), y, w, n);
+            }
+        }
+        for (std::size_t i = 0; i < n; ++i)
+            w[i] = entry_of(a, i) * entry_of(b, i) + entry_of(c, i);
+    }
+
+    template <typename TM>
+    static TN sum_of(const TM& a)
+    {
+        if constexpr (Scalar<TM>)
+            return TN(a);
+        else if constexpr (std::is_arithmetic_v<TN> && std::is_same_v<typename TM::value_type, TN>)
+            return backend::cpu::sum(a.data(), a.size());
+        else
+        {
+            TN s = TN(0);
+            for (std::size_t i = 0; i < a.size(); ++i)
+                s += TN(a.data()[i]);
+            return s;
+        }
+    }
 
     friend struct SDMatrixBase<TN, SDDenseMatrix<Rows, Columns, TN, Major>>;
 };
@@ -0,0 +1,162 @@
+#pragma once
+
+// planar.hpp: Complex matrices in split (planar) storage.
+// SDPlanarMatrix keeps the real and imaginary parts of its elements in two separate planes
+// (see core/layout/layout_policy.hpp, SDPlanarLayout), so complex kernels work on plain real
+// vectors. Conversion from and to the interleaved SDDenseMatrix<..., complex<TN>> is done with
+// from() / to_interleaved(), both vectorized.
+
+#include <senkaid/utils/config/root.hpp>
+#include <senkaid/utils/debug/root.hpp>
+#include <senkaid/utils/memory/utils.hpp>
+#include <senkaid/core/allocator/alignment.hpp>
+#include <senkaid/core/layout/layout_policy.hpp>
+#include <senkaid/core/complex/complex.hpp>
+#include <senkaid/core/complex/complex_simd.hpp>
+#include "dense.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <new>
+#include <utility>
+
+namespace senkaid::core::matrix
+{
+
+// SDPlanarMatrix: Rows x Cols complex matrix with parts of type TN, stored as two planes in Major order.
+template <int Rows = -1, int Cols = -1, typename TN = double, SDMajor Major = SDMajor::RowMajor>
+class SDPlanarMatrix
+{
+public:
+    using value_type = complex::complex<TN>;
+    using part_type = TN;
+    using size_type = std::size_t;
+    using layout_type = layout::SDPlanarLayout<TN>;
+    using interleaved_type = SDDenseMatrix<Rows, Cols, complex::complex<TN>, Major>;
+
+    static constexpr SDMajor major = Major;
+    static constexpr layout::SDComplexLayout complex_layout = layout_type::kind;
+
+    SDPlanarMatrix() : _data(nullptr), _rows(Rows > 0 ? Rows : 0), _cols(Cols > 0 ? Cols : 0)
+    {
+        if constexpr (Rows > 0 && Cols > 0)
+            allocate();
+    }
+
+    SDPlanarMatrix(size_type rows, size_type cols) : _data(nullptr), _rows(rows), _cols(cols)
+    {
+        SENKAID_ASSERT((Rows < 0 || rows == static_cast<size_type>(Rows)) &&
+                       (Cols < 0 || cols == static_cast<size_type>(Cols)),
+                       "SDPlanarMatrix: shape does not match the fixed extent");
+        allocate();
+    }
+
+    SDPlanarMatrix(const SDPlanarMatrix& other) : _data(nullptr), _rows(other._rows), _cols(other._cols)
+    {
+        allocate();
+        if (_data)
+            memory::copy_elements(_data, other._data, buffer_size());
+    }
+
+    SDPlanarMatrix(SDPlanarMatrix&& other) noexcept
+        : _data(std::exchange(other._data, nullptr)), _rows(other._rows), _cols(other._cols)
+    {
+        other._rows = Rows > 0 ? Rows : 0;
+        other._cols = Cols > 0 ? Cols : 0;
+    }
+
+    SDPlanarMatrix& operator=(SDPlanarMatrix other) noexcept
+    {
+        std::swap(_data, other._data);
+        std::swap(_rows, other._rows);
+        std::swap(_cols, other._cols);
+        return *this;
+    }
+
+    ~SDPlanarMatrix()
+    {
+        core::allocator::aligned_free(_data);
+    }
+
+    // from: Planar copy of an interleaved complex matrix.
+    static SDPlanarMatrix from(const interleaved_type& a)
+    {
+        SDPlanarMatrix result(a.rows(), a.cols());
+        complex::split(a.data(), result.real(), result.imag(), a.size());
+        return result;
+    }
+
+    // to_interleaved: Copies the elements into `a`, which must have the same shape.
+    void to_interleaved(interleaved_type& a) const
+    {
+        SENKAID_ASSERT(a.rows() == _rows && a.cols() == _cols, "SDPlanarMatrix::to_interleaved: shape mismatch");
+        complex::merge(real(), imag(), a.data(), size());
+    }
+
+    interleaved_type to_interleaved() const
+    {
+        interleaved_type a(_rows, _cols);
+        to_interleaved(a);
+        return a;
+    }
+
+    // ACCESS
+
+    SENKAID_FORCE_INLINE size_type rows() const noexcept { return _rows; }
+    SENKAID_FORCE_INLINE size_type cols() const noexcept { return _cols; }
+    SENKAID_FORCE_INLINE size_type size() const noexcept { return _rows * _cols; }
+
+    // ld: Leading dimension of either plane.
+    SENKAID_FORCE_INLINE size_type ld() const noexcept { return Major == SDMajor::RowMajor ? _cols : _rows; }
+
+    // real / imag: The two planes, each size() elements in Major order.
+    SENKAID_FORCE_INLINE TN* real() noexcept { return _data + layout_type::real(size(), 0); }
+    SENKAID_FORCE_INLINE const TN* real() const noexcept { return _data + layout_type::real(size(), 0); }
+    SENKAID_FORCE_INLINE TN* imag() noexcept { return _data + layout_type::imag(size(), 0); }
+    SENKAID_FORCE_INLINE const TN* imag() const noexcept { return _data + layout_type::imag(size(), 0); }
+
+    SENKAID_FORCE_INLINE size_type index(size_type i, size_type j) const noexcept
+    {
+        if constexpr (Major == SDMajor::RowMajor)
+            return i * _cols + j;
+        else
+            return i + j * _rows;
+    }
+
+    // operator(): Element (i, j) by value; the parts are not adjacent, so there is no reference.
+    SENKAID_FORCE_INLINE value_type operator()(size_type i, size_type j) const
+    {
+        SENKAID_ASSERT(i < _rows && j < _cols, "SDPlanarMatrix: index out of range");
+        const size_type k = index(i, j);
+        return value_type(real()[k], imag()[k]);
+    }
+
+    SENKAID_FORCE_INLINE void set(size_type i, size_type j, value_type z)
+    {
+        SENKAID_ASSERT(i < _rows && j < _cols, "SDPlanarMatrix: index out of range");
+        const size_type k = index(i, j);
+        real()[k] = z._re;
+        imag()[k] = z._im;
+    }
+
+    SENKAID_FORCE_INLINE size_type buffer_size() const noexcept { return layout_type::buffer_size(size()); }
+
+private:
+    void allocate()
+    {
+        if (size() == 0)
+            return;
+
+        _data = static_cast<TN*>(core::allocator::aligned_malloc(buffer_size() * sizeof(TN),
+                                                                 layout::compact_vector_bytes));
+        if (SENKAID_UNLIKELY(_data == nullptr))
+            throw std::bad_alloc();
+        memory::zero_elements(_data, buffer_size());
+    }
+
+    TN* _data;
+    size_type _rows;
+    size_type _cols;
+};
+
+} // namespace senkaid::core::matrix
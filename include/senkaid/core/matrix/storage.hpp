@@ -0,0 +1,125 @@
+#pragma once
+
+// storage.hpp: Raw element storage behind SDDenseMatrix.
+// Fixed-size shapes (Rows > 0 && Cols > 0) keep their elements inline so small matrices
+// live on the stack and can be packed into batches without indirection; any dynamic extent
+// falls back to an aligned heap buffer.
+
+#include <senkaid/utils/config/root.hpp>
+#include <senkaid/utils/debug/root.hpp>
+#include <senkaid/utils/memory/utils.hpp>
+#include <senkaid/core/allocator/alignment.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <new>
+#include <utility>
+
+namespace senkaid::core::matrix
+{
+
+// storage_alignment: Alignment of inline storage. Capped at the SIMD alignment and at the
+// buffer size itself so a 2x2 float matrix is not padded to a full cache line.
+template <typename TN, std::size_t Count>
+inline constexpr std::size_t storage_alignment =
+    std::max(alignof(TN), std::min<std::size_t>(SENKAID_DEFAULT_ALIGNMENT, std::bit_floor(sizeof(TN) * Count)));
+
+template <typename TN, int Rows, int Cols>
+class SDDenseStorage
+{
+public:
+    static constexpr std::size_t count = static_cast<std::size_t>(Rows) * static_cast<std::size_t>(Cols);
+
+    constexpr SDDenseStorage() : _data{} {}
+
+    constexpr SDDenseStorage(std::size_t rows, std::size_t cols) : _data{}
+    {
+        SENKAID_ASSERT(rows == static_cast<std::size_t>(Rows) && cols == static_cast<std::size_t>(Cols),
+                       "SDDenseStorage: shape does not match the fixed size");
+        (void)rows;
+        (void)cols;
+    }
+
+    constexpr TN* data() noexcept { return _data; }
+    constexpr const TN* data() const noexcept { return _data; }
+
+    static constexpr std::size_t rows() noexcept { return static_cast<std::size_t>(Rows); }
+    static constexpr std::size_t cols() noexcept { return static_cast<std::size_t>(Cols); }
+    static constexpr std::size_t size() noexcept { return count; }
+
+private:
+    alignas(storage_alignment<TN, count>) TN _data[count];
+};
+
+template <typename TN, int Rows, int Cols>
+requires (Rows < 0 || Cols < 0)
+class SDDenseStorage<TN, Rows, Cols>
+{
+public:
+    SDDenseStorage() noexcept
+        : _data(nullptr), _rows(Rows > 0 ? Rows : 0), _cols(Cols > 0 ? Cols : 0)
+    {
+    }
+
+    SDDenseStorage(std::size_t rows, std::size_t cols) : _data(nullptr), _rows(rows), _cols(cols)
+    {
+        SENKAID_ASSERT((Rows < 0 || rows == static_cast<std::size_t>(Rows)) &&
+                       (Cols < 0 || cols == static_cast<std::size_t>(Cols)),
+                       "SDDenseStorage: shape does not match the fixed extent");
+        allocate();
+        if (_data)
+            memory::zero_elements(_data, size());
+    }
+
+    SDDenseStorage(const SDDenseStorage& other) : _data(nullptr), _rows(other._rows), _cols(other._cols)
+    {
+        allocate();
+        if (_data)
+            memory::copy_elements(_data, other._data, size());
+    }
+
+    SDDenseStorage(SDDenseStorage&& other) noexcept
+        : _data(std::exchange(other._data, nullptr)), _rows(other._rows), _cols(other._cols)
+    {
+        other._rows = Rows > 0 ? Rows : 0;
+        other._cols = Cols > 0 ? Cols : 0;
+    }
+
+    SDDenseStorage& operator=(SDDenseStorage other) noexcept
+    {
+        std::swap(_data, other._data);
+        std::swap(_rows, other._rows);
+        std::swap(_cols, other._cols);
+        return *this;
+    }
+
+    ~SDDenseStorage()
+    {
+        core::allocator::aligned_free(_data);
+    }
+
+    TN* data() noexcept { return _data; }
+    const TN* data() const noexcept { return _data; }
+
+    std::size_t rows() const noexcept { return _rows; }
+    std::size_t cols() const noexcept { return _cols; }
+    std::size_t size() const noexcept { return _rows * _cols; }
+
+private:
+    void allocate()
+    {
+        if (size() == 0)
+            return;
+
+        _data = static_cast<TN*>(core::allocator::aligned_malloc(size() * sizeof(TN), SENKAID_DEFAULT_ALIGNMENT));
+        if (SENKAID_UNLIKELY(_data == nullptr))
+            throw std::bad_alloc();
+    }
+
+    TN* _data;
+    std::size_t _rows;
+    std::size_t _cols;
+};
+
+} // namespace senkaid::core::matrix
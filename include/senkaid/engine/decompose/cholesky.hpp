@@ -0,0 +1,113 @@
+#pragma once
+
+// cholesky.hpp: Tiled Cholesky factorization A = L * L^T expressed as a task DAG.
+// The matrix is split into nb x nb tiles; each step k issues
+//   POTRF(k)      - factor the diagonal tile,
+//   TRSM(i, k)    - solve the panel tiles below it,
+//   SYRK(i) and GEMM(i, j) - update the trailing submatrix,
+// and the TaskGraph releases each tile kernel as soon as its inputs are final, so the
+// panel of step k + 1 overlaps the trailing update of step k instead of waiting at a barrier.
+
+#include <senkaid/utils/config/root.hpp>
+#include <senkaid/utils/debug/root.hpp>
+#include <senkaid/backend/parallel/task_graph.hpp>
+#include "decompose_utils.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+
+namespace senkaid::engine::decompose
+{
+
+// cholesky: In-place tiled Cholesky of a symmetric positive definite matrix, column-major.
+// Only the lower triangle is referenced and overwritten with L; the strict upper triangle is untouched.
+// Parameters:
+//   a       - Matrix data.
+//   n       - Order of the matrix.
+//   lda     - Leading dimension (>= n).
+//   options - Tile size, pool, cancellation token.
+// Returns:
+//   0 on success, j > 0 if the leading minor of order j is not positive definite,
+//   -1 on invalid arguments. Throws CancelledError if the token is cancelled.
+template <typename TN>
+int cholesky(TN* a, std::size_t n, std::size_t lda, const TileOptions& options = {})
+{
+    if (SENKAID_UNLIKELY(lda < n || (n != 0 && a == nullptr)))
+    {
+        SENKAID_LOG_ERROR("cholesky: invalid arguments");
+        return -1;
+    }
+
+    if (n == 0)
+        return 0;
+
+    const std::size_t nb = select_tile(options, n, n);
+    const std::size_t nt = (n + nb - 1) / nb;
+
+    auto tile = [=](std::size_t i, std::size_t j) { return a + i * nb + j * nb * lda; };
+    auto extent = [=](std::size_t i) { return std::min(nb, n - i * nb); };
+
+    std::atomic<int> info{0};
+
+    backend::parallel::TaskGraph graph(select_pool(options), options.token, options.parallel && nt > 1);
+    using backend::parallel::Access;
+
+    for (std::size_t k = 0; k < nt; ++k)
+    {
+        const std::size_t kb = extent(k);
+        TN* akk = tile(k, k);
+
+        graph.insert([=, &info, &graph] {
+            const int status = kernels::potrf_lower(kb, akk, lda);
+            if (status != 0)
+            {
+                int expected = 0;
+                info.compare_exchange_strong(expected, static_cast<int>(k * nb) + status);
+                graph.abort();
+            }
+        }, {Access::write(akk)}, tile_priority(k, nt, true));
+
+        for (std::size_t i = k + 1; i < nt; ++i)
+        {
+            TN* aik = tile(i, k);
+            const std::size_t ib = extent(i);
+            graph.insert([=] { kernels::trsm_rlt(ib, kb, akk, lda, aik, lda); },
+                         {Access::read(akk), Access::write(aik)}, tile_priority(k, nt, true));
+        }
+
+        for (std::size_t i = k + 1; i < nt; ++i)
+        {
+            TN* aik = tile(i, k);
+            TN* aii = tile(i, i);
+            const std::size_t ib = extent(i);
+
+            graph.insert([=] { kernels::syrk_ln(ib, kb, aik, lda, aii, lda); },
+                         {Access::read(aik), Access::write(aii)}, tile_priority(k, nt, i == k + 1));
+
+            for (std::size_t j = k + 1; j < i; ++j)
+            {
+                TN* ajk = tile(j, k);
+                TN* aij = tile(i, j);
+                const std::size_t jb = extent(j);
+                graph.insert([=] { kernels::gemm_nt_sub(ib, jb, kb, aik, lda, ajk, lda, aij, lda); },
+                             {Access::read(aik), Access::read(ajk), Access::write(aij)},
+                             tile_priority(k, nt, j == k + 1));
+            }
+        }
+    }
+
+    graph.wait();
+    return info.load();
+}
+
+// cholesky_async: Awaitable cholesky(); runs on options.pool (or the shared pool).
+// The caller keeps `a` alive until the task completes.
+template <typename TN>
+backend::parallel::Task<int> cholesky_async(TN* a, std::size_t n, std::size_t lda, TileOptions options = {})
+{
+    return backend::parallel::async_invoke(select_pool(options), options.token,
+        [a, n, lda, options] { return cholesky(a, n, lda, options); });
+}
+
+} // namespace senkaid::engine::decompose
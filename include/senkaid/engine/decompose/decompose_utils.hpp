@@ -0,0 +1,498 @@
+#pragma once
+
+// decompose_utils.hpp: Shared pieces of the tiled dense factorizations.
+// Provides the tile options, tile-size selection, lookahead priorities and the
+// sequential tile kernels (POTRF, TRSM, SYRK, GETRF, LASWP, GEQRT, UNMQR, TSQRT, TSMQR)
+// that cholesky.hpp, lu.hpp and qr.hpp schedule as task DAGs.
+// All kernels operate in place on column-major storage with an explicit leading dimension.
+
+#include <senkaid/utils/config/root.hpp>
+#include <senkaid/utils/debug/root.hpp>
+#include <senkaid/backend/cpu/matmul_cpu.hpp>
+#include <senkaid/backend/parallel/async_task.hpp>
+#include <senkaid/backend/parallel/parallel_std.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace senkaid::engine::decompose
+{
+
+// TileOptions: Execution controls shared by the tiled factorizations.
+struct TileOptions
+{
+    std::size_t tile = 0;                                   // Tile edge; 0 picks one from the problem size.
+    bool parallel = true;                                   // false runs the DAG on the calling thread only.
+    backend::parallel::ThreadPool* pool = nullptr;          // nullptr uses ThreadPool::instance().
+    backend::parallel::CancellationToken token;             // Checked between tile tasks.
+};
+
+// select_tile: Tile edge for an m x n problem.
+// Small tiles expose more parallelism; large tiles amortize per-task overhead and keep the
+// GEMM updates efficient. Never below SENKAID_DEFAULT_TILE_SIZE unless the matrix is smaller.
+SENKAID_FORCE_INLINE std::size_t select_tile(const TileOptions& options, std::size_t m, std::size_t n)
+{
+    if (options.tile != 0)
+        return options.tile;
+
+    const std::size_t dim = std::max(m, n);
+    std::size_t tile = dim <= 1024 ? 64 : dim <= 4096 ? 128 : 256;
+    return std::max<std::size_t>(tile, SENKAID_DEFAULT_TILE_SIZE);
+}
+
+SENKAID_FORCE_INLINE backend::parallel::ThreadPool& select_pool(const TileOptions& options)
+{
+    return options.pool ? *options.pool : backend::parallel::ThreadPool::instance();
+}
+
+// tile_priority: Priority of a task belonging to elimination step k of nt.
+// Earlier steps come first; tasks on the critical path (the next panel and the updates
+// feeding it) get a boost larger than one step, giving a lookahead of one panel.
+SENKAID_FORCE_INLINE int tile_priority(std::size_t k, std::size_t nt, bool critical)
+{
+    return 2 * static_cast<int>(nt - k) + (critical ? 3 : 0);
+}
+
+namespace kernels
+{
+
+using backend::cpu::Op;
+
+// nrm2: Euclidean norm of a contiguous vector, scaled to avoid overflow/underflow.
+template <typename TN>
+TN nrm2(std::size_t n, const TN* x)
+{
+    TN scale = TN(0);
+    for (std::size_t i = 0; i < n; ++i)
+        scale = std::max(scale, std::abs(x[i]));
+
+    if (scale == TN(0) || !std::isfinite(scale))
+        return scale;
+
+    TN sum = TN(0);
+    const TN inv = TN(1) / scale;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        const TN v = x[i] * inv;
+        sum += v * v;
+    }
+    return scale * std::sqrt(sum);
+}
+
+// potrf_lower: Unblocked left-looking Cholesky of an n x n tile, lower triangle.
+// Returns 0 on success or j + 1 if the j-th leading minor is not positive definite.
+template <typename TN>
+int potrf_lower(std::size_t n, TN* a, std::size_t lda)
+{
+    for (std::size_t j = 0; j < n; ++j)
+    {
+        TN* colj = a + j * lda;
+
+        for (std::size_t p = 0; p < j; ++p)
+        {
+            const TN ajp = a[j + p * lda];
+            const TN* colp = a + p * lda;
+            for (std::size_t i = j; i < n; ++i)
+                colj[i] -= ajp * colp[i];
+        }
+
+        const TN d = colj[j];
+        if (!(d > TN(0)))
+            return static_cast<int>(j + 1);
+
+        const TN root = std::sqrt(d);
+        const TN inv = TN(1) / root;
+        colj[j] = root;
+        for (std::size_t i = j + 1; i < n; ++i)
+            colj[i] *= inv;
+    }
+    return 0;
+}
+
+// trsm_rlt: B := B * L^{-T} with L n x n lower triangular (non-unit) and B m x n.
+template <typename TN>
+void trsm_rlt(std::size_t m, std::size_t n, const TN* l, std::size_t ldl, TN* b, std::size_t ldb)
+{
+    for (std::size_t j = 0; j < n; ++j)
+    {
+        TN* colj = b + j * ldb;
+
+        for (std::size_t p = 0; p < j; ++p)
+        {
+            const TN ljp = l[j + p * ldl];
+            const TN* colp = b + p * ldb;
+            for (std::size_t i = 0; i < m; ++i)
+                colj[i] -= ljp * colp[i];
+        }
+
+        const TN inv = TN(1) / l[j + j * ldl];
+        for (std::size_t i = 0; i < m; ++i)
+            colj[i] *= inv;
+    }
+}
+
+// trsm_llnu: B := L^{-1} * B with L m x m unit lower triangular and B m x n.
+template <typename TN>
+void trsm_llnu(std::size_t m, std::size_t n, const TN* l, std::size_t ldl, TN* b, std::size_t ldb)
+{
+    for (std::size_t c = 0; c < n; ++c)
+    {
+        TN* col = b + c * ldb;
+        for (std::size_t j = 0; j < m; ++j)
+        {
+            const TN bj = col[j];
+            if (bj == TN(0))
+                continue;
+            const TN* lj = l + j * ldl;
+            for (std::size_t i = j + 1; i < m; ++i)
+                col[i] -= bj * lj[i];
+        }
+    }
+}
+
+// syrk_ln: C := C - A * A^T on the lower triangle of the n x n tile C, A is n x k.
+template <typename TN>
+void syrk_ln(std::size_t n, std::size_t k, const TN* a, std::size_t lda, TN* c, std::size_t ldc)
+{
+    for (std::size_t j = 0; j < n; ++j)
+    {
+        TN* colj = c + j * ldc;
+        for (std::size_t p = 0; p < k; ++p)
+        {
+            const TN ajp = a[j + p * lda];
+            const TN* colp = a + p * lda;
+            for (std::size_t i = j; i < n; ++i)
+                colj[i] -= ajp * colp[i];
+        }
+    }
+}
+
+// gemm_nt_sub: C := C - A * B^T (A m x k, B n x k).
+template <typename TN>
+SENKAID_FORCE_INLINE void gemm_nt_sub(std::size_t m, std::size_t n, std::size_t k, const TN* a, std::size_t lda,
+                                      const TN* b, std::size_t ldb, TN* c, std::size_t ldc)
+{
+    backend::cpu::gemm<TN>(Op::NoTrans, Op::Trans, m, n, k, TN(-1), a, lda, b, ldb, TN(1), c, ldc);
+}
+
+// gemm_nn_sub: C := C - A * B (A m x k, B k x n).
+template <typename TN>
+SENKAID_FORCE_INLINE void gemm_nn_sub(std::size_t m, std::size_t n, std::size_t k, const TN* a, std::size_t lda,
+                                      const TN* b, std::size_t ldb, TN* c, std::size_t ldc)
+{
+    backend::cpu::gemm<TN>(Op::NoTrans, Op::NoTrans, m, n, k, TN(-1), a, lda, b, ldb, TN(1), c, ldc);
+}
+
+// laswp: Applies row interchanges ipiv[k1..k2) (row r <-> row ipiv[r]) to `ncols` columns.
+// Row indices are relative to `a`.
+template <typename TN>
+void laswp(std::size_t ncols, TN* a, std::size_t lda, std::size_t k1, std::size_t k2, const std::size_t* ipiv)
+{
+    for (std::size_t c = 0; c < ncols; ++c)
+    {
+        TN* col = a + c * lda;
+        for (std::size_t r = k1; r < k2; ++r)
+        {
+            const std::size_t p = ipiv[r];
+            if (p != r)
+                std::swap(col[r], col[p]);
+        }
+    }
+}
+
+// getrf_unblocked: Right-looking LU with partial pivoting of an m x n block.
+// ipiv receives min(m, n) pivot rows relative to `a`. Returns LAPACK-style info.
+template <typename TN>
+int getrf_unblocked(std::size_t m, std::size_t n, TN* a, std::size_t lda, std::size_t* ipiv)
+{
+    int info = 0;
+    const std::size_t mn = std::min(m, n);
+
+    for (std::size_t j = 0; j < mn; ++j)
+    {
+        TN* colj = a + j * lda;
+
+        std::size_t p = j;
+        TN best = std::abs(colj[j]);
+        for (std::size_t i = j + 1; i < m; ++i)
+        {
+            const TN v = std::abs(colj[i]);
+            if (v > best)
+            {
+                best = v;
+                p = i;
+            }
+        }
+        ipiv[j] = p;
+
+        if (colj[p] != TN(0))
+        {
+            if (p != j)
+                for (std::size_t c = 0; c < n; ++c)
+                    std::swap(a[j + c * lda], a[p + c * lda]);
+
+            const TN inv = TN(1) / colj[j];
+            for (std::size_t i = j + 1; i < m; ++i)
+                colj[i] *= inv;
+        }
+        else if (info == 0)
+        {
+            info = static_cast<int>(j + 1);
+        }
+
+        for (std::size_t c = j + 1; c < n; ++c)
+        {
+            TN* colc = a + c * lda;
+            const TN u = colc[j];
+            if (u == TN(0))
+                continue;
+            for (std::size_t i = j + 1; i < m; ++i)
+                colc[i] -= u * colj[i];
+        }
+    }
+    return info;
+}
+
+// getrf_recursive: Recursive (Toledo) LU with partial pivoting of an m x n panel.
+// Splits the columns in half so most of the work becomes GEMM. Same contract as getrf_unblocked.
+template <typename TN>
+int getrf_recursive(std::size_t m, std::size_t n, TN* a, std::size_t lda, std::size_t* ipiv)
+{
+    const std::size_t mn = std::min(m, n);
+    if (mn <= 16)
+        return getrf_unblocked(m, n, a, lda, ipiv);
+
+    const std::size_t n1 = mn / 2;
+    const std::size_t n2 = n - n1;
+
+    int info = getrf_recursive(m, n1, a, lda, ipiv);
+
+    TN* a12 = a + n1 * lda;
+    TN* a21 = a + n1;
+    TN* a22 = a + n1 + n1 * lda;
+
+    laswp(n2, a12, lda, 0, n1, ipiv);
+    trsm_llnu(n1, n2, a, lda, a12, lda);
+    gemm_nn_sub(m - n1, n2, n1, a21, lda, a12, lda, a22, lda);
+
+    const int info2 = getrf_recursive(m - n1, n2, a22, lda, ipiv + n1);
+    if (info == 0 && info2 != 0)
+        info = info2 + static_cast<int>(n1);
+
+    for (std::size_t i = n1; i < mn; ++i)
+        ipiv[i] += n1;
+    laswp(n1, a, lda, n1, mn, ipiv);
+
+    return info;
+}
+
+namespace detail
+{
+
+// householder: Generates H = I - tau * v * v^T with H * [alpha; x] = [beta; 0], v = [1; x / (alpha - beta)].
+// Overwrites alpha with beta and x with the tail of v; returns tau.
+template <typename TN>
+TN householder(TN& alpha, std::size_t n, TN* x)
+{
+    const TN xnorm = nrm2(n, x);
+    if (xnorm == TN(0))
+        return TN(0);
+
+    const TN beta = -std::copysign(std::hypot(alpha, xnorm), alpha);
+    const TN tau = (beta - alpha) / beta;
+    const TN inv = TN(1) / (alpha - beta);
+    for (std::size_t i = 0; i < n; ++i)
+        x[i] *= inv;
+    alpha = beta;
+    return tau;
+}
+
+// larft_column: T(0:j, j) = -tau_j * T(0:j, 0:j) * w, with T upper triangular (ldt) and w of length j.
+template <typename TN>
+void larft_column(std::size_t j, TN tau, const TN* w, TN* t, std::size_t ldt)
+{
+    TN* tj = t + j * ldt;
+    for (std::size_t i = 0; i < j; ++i)
+    {
+        TN s = TN(0);
+        for (std::size_t l = i; l < j; ++l)
+            s += t[i + l * ldt] * w[l];
+        tj[i] = -tau * s;
+    }
+    tj[j] = tau;
+}
+
+template <typename TN>
+std::vector<TN>& workspace(std::size_t size)
+{
+    static thread_local std::vector<TN> buffer;
+    if (buffer.size() < size)
+        buffer.resize(size);
+    return buffer;
+}
+
+// apply_ttrans: W := T^T * W for T k x k upper triangular, W k x nc (ldw = k).
+template <typename TN>
+void apply_ttrans(std::size_t k, std::size_t nc, const TN* t, std::size_t ldt, TN* w)
+{
+    for (std::size_t c = 0; c < nc; ++c)
+    {
+        TN* col = w + c * k;
+        for (std::size_t l = k; l-- > 0;)
+        {
+            TN s = TN(0);
+            for (std::size_t p = 0; p <= l; ++p)
+                s += t[p + l * ldt] * col[p];
+            col[l] = s;
+        }
+    }
+}
+
+} // namespace detail
+
+// geqrt: Householder QR of an m x n tile. R overwrites the upper triangle, the reflector tails
+// V the strict lower part, and the k x k block-reflector factor T (k = min(m, n)) is written
+// to t so that Q = I - V * T * V^T.
+template <typename TN>
+void geqrt(std::size_t m, std::size_t n, TN* a, std::size_t lda, TN* t, std::size_t ldt)
+{
+    const std::size_t k = std::min(m, n);
+    std::vector<TN>& w = detail::workspace<TN>(k);
+
+    for (std::size_t j = 0; j < k; ++j)
+    {
+        TN* colj = a + j * lda;
+        const TN tau = detail::householder(colj[j], m - j - 1, colj + j + 1);
+
+        if (tau != TN(0))
+        {
+            for (std::size_t c = j + 1; c < n; ++c)
+            {
+                TN* colc = a + c * lda;
+                TN s = colc[j];
+                for (std::size_t i = j + 1; i < m; ++i)
+                    s += colj[i] * colc[i];
+                s *= tau;
+                colc[j] -= s;
+                for (std::size_t i = j + 1; i < m; ++i)
+                    colc[i] -= s * colj[i];
+            }
+        }
+
+        for (std::size_t l = 0; l < j; ++l)
+        {
+            const TN* coll = a + l * lda;
+            TN s = coll[j];
+            for (std::size_t i = j + 1; i < m; ++i)
+                s += coll[i] * colj[i];
+            w[l] = s;
+        }
+        detail::larft_column(j, tau, w.data(), t, ldt);
+    }
+}
+
+// unmqr: C := Q^T * C for the reflectors produced by geqrt on an m x k panel (V in v, T in t).
+// C is m x nc.
+template <typename TN>
+void unmqr(std::size_t m, std::size_t k, std::size_t nc, const TN* v, std::size_t ldv,
+           const TN* t, std::size_t ldt, TN* c, std::size_t ldc)
+{
+    std::vector<TN>& w = detail::workspace<TN>(k * nc);
+
+    for (std::size_t col = 0; col < nc; ++col)
+    {
+        const TN* cc = c + col * ldc;
+        for (std::size_t l = 0; l < k; ++l)
+        {
+            const TN* vl = v + l * ldv;
+            TN s = cc[l];
+            for (std::size_t i = l + 1; i < m; ++i)
+                s += vl[i] * cc[i];
+            w[l + col * k] = s;
+        }
+    }
+
+    detail::apply_ttrans(k, nc, t, ldt, w.data());
+
+    for (std::size_t col = 0; col < nc; ++col)
+    {
+        TN* cc = c + col * ldc;
+        const TN* wc = w.data() + col * k;
+        for (std::size_t l = 0; l < k; ++l)
+        {
+            const TN* vl = v + l * ldv;
+            const TN s = wc[l];
+            cc[l] -= s;
+            for (std::size_t i = l + 1; i < m; ++i)
+                cc[i] -= s * vl[i];
+        }
+    }
+}
+
+// tsqrt: QR of the stacked pair [R; A], R k x k upper triangular, A m x k.
+// R is updated in place, A is overwritten by the reflector tails V2 and T receives the
+// k x k factor so that Q = I - [I; V2] * T * [I; V2]^T.
+template <typename TN>
+void tsqrt(std::size_t k, TN* r, std::size_t ldr, std::size_t m, TN* a, std::size_t lda, TN* t, std::size_t ldt)
+{
+    std::vector<TN>& w = detail::workspace<TN>(k);
+
+    for (std::size_t j = 0; j < k; ++j)
+    {
+        TN* aj = a + j * lda;
+        const TN tau = detail::householder(r[j + j * ldr], m, aj);
+
+        if (tau != TN(0))
+        {
+            for (std::size_t c = j + 1; c < k; ++c)
+            {
+                TN* ac = a + c * lda;
+                TN s = r[j + c * ldr];
+                for (std::size_t i = 0; i < m; ++i)
+                    s += aj[i] * ac[i];
+                s *= tau;
+                r[j + c * ldr] -= s;
+                for (std::size_t i = 0; i < m; ++i)
+                    ac[i] -= s * aj[i];
+            }
+        }
+
+        for (std::size_t l = 0; l < j; ++l)
+        {
+            const TN* al = a + l * lda;
+            TN s = TN(0);
+            for (std::size_t i = 0; i < m; ++i)
+                s += al[i] * aj[i];
+            w[l] = s;
+        }
+        detail::larft_column(j, tau, w.data(), t, ldt);
+    }
+}
+
+// tsmqr: Applies Q^T from tsqrt to the stacked pair [C1; C2], C1 k x nc, C2 m x nc.
+template <typename TN>
+void tsmqr(std::size_t k, std::size_t nc, TN* c1, std::size_t ldc1, std::size_t m, TN* c2, std::size_t ldc2,
+           const TN* v, std::size_t ldv, const TN* t, std::size_t ldt)
+{
+    std::vector<TN>& w = detail::workspace<TN>(k * nc);
+
+    // W = C1 + V2^T * C2
+    for (std::size_t col = 0; col < nc; ++col)
+        for (std::size_t l = 0; l < k; ++l)
+            w[l + col * k] = c1[l + col * ldc1];
+    backend::cpu::gemm<TN>(Op::Trans, Op::NoTrans, k, nc, m, TN(1), v, ldv, c2, ldc2, TN(1), w.data(), k);
+
+    detail::apply_ttrans(k, nc, t, ldt, w.data());
+
+    // C1 -= W, C2 -= V2 * W
+    for (std::size_t col = 0; col < nc; ++col)
+        for (std::size_t l = 0; l < k; ++l)
+            c1[l + col * ldc1] -= w[l + col * k];
+    backend::cpu::gemm<TN>(Op::NoTrans, Op::NoTrans, m, nc, k, TN(-1), v, ldv, w.data(), k, TN(1), c2, ldc2);
+}
+
+} // namespace kernels
+
+} // namespace senkaid::engine::decompose
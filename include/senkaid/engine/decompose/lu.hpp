@@ -0,0 +1,146 @@
+#pragma once
+
+// lu.hpp: Tiled LU factorization with partial pivoting, P * A = L * U, expressed as a task DAG.
+// Each step k issues
+//   PANEL(k)          - recursive GETRF of the tile column k (rows k*nb..m),
+//   SWAP_TRSM(k, j)   - apply the panel's row swaps to tile column j > k and solve U(k, j),
+//   GEMM(i, j, k)     - trailing update A(i, j) -= L(i, k) * U(k, j),
+//   SWAP_LEFT(k, j)   - apply the panel's row swaps to the already factored columns j < k.
+// Left swaps are off the critical path and get the lowest priority.
+
+#include <senkaid/utils/config/root.hpp>
+#include <senkaid/utils/debug/root.hpp>
+#include <senkaid/backend/parallel/task_graph.hpp>
+#include "decompose_utils.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace senkaid::engine::decompose
+{
+
+// lu: In-place tiled LU with partial pivoting, column-major.
+// L (unit diagonal, not stored) and U overwrite A.
+// Parameters:
+//   a       - m x n matrix data.
+//   m, n    - Dimensions.
+//   lda     - Leading dimension (>= m).
+//   ipiv    - Receives min(m, n) 0-based pivot rows: row r was interchanged with row ipiv[r].
+//   options - Tile size, pool, cancellation token.
+// Returns:
+//   0 on success, j > 0 if U(j-1, j-1) is exactly zero (the factorization is still completed),
+//   -1 on invalid arguments. Throws CancelledError if the token is cancelled.
+template <typename TN>
+int lu(TN* a, std::size_t m, std::size_t n, std::size_t lda, std::size_t* ipiv, const TileOptions& options = {})
+{
+    if (SENKAID_UNLIKELY(lda < m || (m != 0 && n != 0 && (a == nullptr || ipiv == nullptr))))
+    {
+        SENKAID_LOG_ERROR("lu: invalid arguments");
+        return -1;
+    }
+
+    const std::size_t mn = std::min(m, n);
+    if (mn == 0)
+        return 0;
+
+    const std::size_t nb = select_tile(options, m, n);
+    const std::size_t mt = (m + nb - 1) / nb;
+    const std::size_t nt = (n + nb - 1) / nb;
+    const std::size_t kt = (mn + nb - 1) / nb;
+
+    auto tile = [=](std::size_t i, std::size_t j) { return a + i * nb + j * nb * lda; };
+    auto rows = [=](std::size_t i) { return std::min(nb, m - i * nb); };
+    auto cols = [=](std::size_t j) { return std::min(nb, n - j * nb); };
+
+    std::atomic<int> info{0};
+
+    backend::parallel::TaskGraph graph(select_pool(options), options.token,
+                                       options.parallel && std::max(mt, nt) > 1);
+    using backend::parallel::Access;
+    std::vector<Access> accesses;
+
+    // Writes every tile of column j from tile row k down.
+    auto column_accesses = [&](std::size_t k, std::size_t j) {
+        for (std::size_t i = k; i < mt; ++i)
+            accesses.push_back(Access::write(tile(i, j)));
+    };
+
+    for (std::size_t k = 0; k < kt; ++k)
+    {
+        const std::size_t row0 = k * nb;
+        const std::size_t kb = cols(k);
+        const std::size_t kpiv = std::min(m - row0, kb);
+        TN* akk = tile(k, k);
+
+        accesses.clear();
+        column_accesses(k, k);
+        graph.insert([=, &info] {
+            const int status = kernels::getrf_recursive(m - row0, kb, akk, lda, ipiv + row0);
+            for (std::size_t r = row0; r < row0 + kpiv; ++r)
+                ipiv[r] += row0;
+            if (status != 0)
+            {
+                int expected = 0;
+                info.compare_exchange_strong(expected, static_cast<int>(row0) + status);
+            }
+        }, accesses, tile_priority(k, kt, true));
+
+        for (std::size_t j = k + 1; j < nt; ++j)
+        {
+            const std::size_t jb = cols(j);
+            TN* col = a + j * nb * lda;
+            TN* akj = tile(k, j);
+
+            accesses.clear();
+            accesses.push_back(Access::read(akk));
+            column_accesses(k, j);
+            graph.insert([=] {
+                kernels::laswp(jb, col, lda, row0, row0 + kpiv, ipiv);
+                kernels::trsm_llnu(kpiv, jb, akk, lda, akj, lda);
+            }, accesses, tile_priority(k, kt, j == k + 1));
+        }
+
+        for (std::size_t j = k + 1; j < nt; ++j)
+        {
+            const std::size_t jb = cols(j);
+            TN* akj = tile(k, j);
+
+            for (std::size_t i = k + 1; i < mt; ++i)
+            {
+                TN* aik = tile(i, k);
+                TN* aij = tile(i, j);
+                const std::size_t ib = rows(i);
+                graph.insert([=] { kernels::gemm_nn_sub(ib, jb, kpiv, aik, lda, akj, lda, aij, lda); },
+                             {Access::read(aik), Access::read(akj), Access::write(aij)},
+                             tile_priority(k, kt, j == k + 1));
+            }
+        }
+
+        for (std::size_t j = 0; j < k; ++j)
+        {
+            TN* col = a + j * nb * lda;
+
+            accesses.clear();
+            accesses.push_back(Access::read(akk));
+            column_accesses(k, j);
+            graph.insert([=] { kernels::laswp(nb, col, lda, row0, row0 + kpiv, ipiv); }, accesses, 0);
+        }
+    }
+
+    graph.wait();
+    return info.load();
+}
+
+// lu_async: Awaitable lu(); runs on options.pool (or the shared pool).
+// The caller keeps `a` and `ipiv` alive until the task completes.
+template <typename TN>
+backend::parallel::Task<int> lu_async(TN* a, std::size_t m, std::size_t n, std::size_t lda, std::size_t* ipiv,
+                                      TileOptions options = {})
+{
+    return backend::parallel::async_invoke(select_pool(options), options.token,
+        [a, m, n, lda, ipiv, options] { return lu(a, m, n, lda, ipiv, options); });
+}
+
+} // namespace senkaid::engine::decompose
@@ -0,0 +1,229 @@
+#pragma once
+
+// qr.hpp: Tiled Householder QR factorization A = Q * R expressed as a task DAG.
+// Each step k issues
+//   GEQRT(k)        - QR of the diagonal tile,
+//   UNMQR(k, j)     - apply its reflectors to the tiles right of it,
+//   TSQRT(i, k)     - annihilate tile (i, k) against R(k, k),
+//   TSMQR(i, j, k)  - apply those reflectors to the tile pair (k, j), (i, j).
+// The diagonal tile is tracked as two handles (its R triangle and its reflector part) because
+// TSQRT only rewrites R while UNMQR only reads the reflectors; they may run concurrently.
+
+#include <senkaid/utils/config/root.hpp>
+#include <senkaid/utils/debug/root.hpp>
+#include <senkaid/backend/parallel/task_graph.hpp>
+#include "decompose_utils.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace senkaid::engine::decompose
+{
+
+// QRFactors: Block-reflector factors T produced by qr(), one nb x nb block per eliminated tile.
+// Together with the reflectors stored below the diagonal of A they represent Q.
+template <typename TN>
+class QRFactors
+{
+public:
+    QRFactors() = default;
+
+    // reset: Sizes the storage for an m x n factorization with tile edge nb.
+    void reset(std::size_t m, std::size_t n, std::size_t nb)
+    {
+        _m = m;
+        _n = n;
+        _nb = nb;
+        _mt = (m + nb - 1) / nb;
+        _kt = (std::min(m, n) + nb - 1) / nb;
+        _t.assign(_mt * _kt * nb * nb, TN(0));
+    }
+
+    // t: T factor of the reflectors that eliminated tile (i, k); leading dimension tile().
+    TN* t(std::size_t i, std::size_t k) noexcept { return _t.data() + (i + k * _mt) * _nb * _nb; }
+    const TN* t(std::size_t i, std::size_t k) const noexcept { return _t.data() + (i + k * _mt) * _nb * _nb; }
+
+    std::size_t rows() const noexcept { return _m; }
+    std::size_t cols() const noexcept { return _n; }
+    std::size_t tile() const noexcept { return _nb; }
+    std::size_t tile_rows() const noexcept { return _mt; }
+    std::size_t steps() const noexcept { return _kt; }
+
+private:
+    std::vector<TN> _t;
+    std::size_t _m = 0;
+    std::size_t _n = 0;
+    std::size_t _nb = 0;
+    std::size_t _mt = 0;
+    std::size_t _kt = 0;
+};
+
+// qr: In-place tiled Householder QR, column-major.
+// R overwrites the upper triangle of A; the reflectors are kept below the diagonal of each tile
+// and their T factors in `factors`.
+// Parameters:
+//   a       - m x n matrix data.
+//   m, n    - Dimensions.
+//   lda     - Leading dimension (>= m).
+//   factors - Receives the T factors; reused storage is resized as needed.
+//   options - Tile size, pool, cancellation token.
+// Returns:
+//   0 on success, -1 on invalid arguments. Throws CancelledError if the token is cancelled.
+template <typename TN>
+int qr(TN* a, std::size_t m, std::size_t n, std::size_t lda, QRFactors<TN>& factors, const TileOptions& options = {})
+{
+    if (SENKAID_UNLIKELY(lda < m || (m != 0 && n != 0 && a == nullptr)))
+    {
+        SENKAID_LOG_ERROR("qr: invalid arguments");
+        return -1;
+    }
+
+    const std::size_t nb = select_tile(options, m, n);
+    factors.reset(m, n, nb);
+
+    if (std::min(m, n) == 0)
+        return 0;
+
+    const std::size_t mt = factors.tile_rows();
+    const std::size_t nt = (n + nb - 1) / nb;
+    const std::size_t kt = factors.steps();
+
+    auto tile = [=](std::size_t i, std::size_t j) { return a + i * nb + j * nb * lda; };
+    auto rows = [=](std::size_t i) { return std::min(nb, m - i * nb); };
+    auto cols = [=](std::size_t j) { return std::min(nb, n - j * nb); };
+
+    // Separate handles for the R triangles of the diagonal tiles.
+    std::unique_ptr<char[]> r_keys(new char[kt]);
+
+    backend::parallel::TaskGraph graph(select_pool(options), options.token,
+                                       options.parallel && std::max(mt, nt) > 1);
+    using backend::parallel::Access;
+
+    for (std::size_t k = 0; k < kt; ++k)
+    {
+        const std::size_t kb = cols(k);
+        const std::size_t kr = rows(k);
+        const std::size_t kk = std::min(kr, kb);
+        TN* akk = tile(k, k);
+        TN* tkk = factors.t(k, k);
+        const char* rkk = &r_keys[k];
+
+        graph.insert([=] { kernels::geqrt(kr, kb, akk, lda, tkk, nb); },
+                     {Access::write(akk), Access::write(rkk)}, tile_priority(k, kt, true));
+
+        for (std::size_t j = k + 1; j < nt; ++j)
+        {
+            TN* akj = tile(k, j);
+            const std::size_t jb = cols(j);
+            graph.insert([=] { kernels::unmqr(kr, kk, jb, akk, lda, tkk, nb, akj, lda); },
+                         {Access::read(akk), Access::write(akj)}, tile_priority(k, kt, j == k + 1));
+        }
+
+        for (std::size_t i = k + 1; i < mt; ++i)
+        {
+            TN* aik = tile(i, k);
+            TN* tik = factors.t(i, k);
+            const std::size_t ib = rows(i);
+
+            graph.insert([=] { kernels::tsqrt(kb, akk, lda, ib, aik, lda, tik, nb); },
+                         {Access::write(rkk), Access::write(aik)}, tile_priority(k, kt, true));
+
+            for (std::size_t j = k + 1; j < nt; ++j)
+            {
+                TN* akj = tile(k, j);
+                TN* aij = tile(i, j);
+                const std::size_t jb = cols(j);
+                graph.insert([=] { kernels::tsmqr(kb, jb, akj, lda, ib, aij, lda, aik, lda, tik, nb); },
+                             {Access::read(aik), Access::write(akj), Access::write(aij)},
+                             tile_priority(k, kt, j == k + 1));
+            }
+        }
+    }
+
+    graph.wait();
+    return 0;
+}
+
+// apply_qt: B := Q^T * B using the reflectors left in `a` by qr().
+// The update is scheduled as a DAG over the tiles of B.
+// Parameters:
+//   a, lda     - Factored matrix from qr().
+//   factors    - T factors from qr().
+//   b, ldb     - m x nrhs right-hand sides (ldb >= m).
+//   nrhs       - Number of columns of B.
+//   options    - Pool and cancellation token (the tile size is taken from factors).
+// Returns:
+//   0 on success, -1 on invalid arguments.
+template <typename TN>
+int apply_qt(const TN* a, std::size_t lda, const QRFactors<TN>& factors, TN* b, std::size_t ldb, std::size_t nrhs,
+             const TileOptions& options = {})
+{
+    const std::size_t m = factors.rows();
+    const std::size_t n = factors.cols();
+
+    if (SENKAID_UNLIKELY(lda < m || ldb < m || (m != 0 && nrhs != 0 && (a == nullptr || b == nullptr))))
+    {
+        SENKAID_LOG_ERROR("apply_qt: invalid arguments");
+        return -1;
+    }
+
+    if (factors.steps() == 0 || nrhs == 0)
+        return 0;
+
+    const std::size_t nb = factors.tile();
+    const std::size_t mt = factors.tile_rows();
+    const std::size_t kt = factors.steps();
+    const std::size_t rt = (nrhs + nb - 1) / nb;
+
+    auto tile = [=](std::size_t i, std::size_t j) { return a + i * nb + j * nb * lda; };
+    auto btile = [=](std::size_t i, std::size_t j) { return b + i * nb + j * nb * ldb; };
+    auto rows = [=](std::size_t i) { return std::min(nb, m - i * nb); };
+
+    backend::parallel::TaskGraph graph(select_pool(options), options.token,
+                                       options.parallel && std::max(mt, rt) > 1);
+    using backend::parallel::Access;
+
+    for (std::size_t k = 0; k < kt; ++k)
+    {
+        const std::size_t kb = std::min(nb, n - k * nb);
+        const std::size_t kr = rows(k);
+        const std::size_t kk = std::min(kr, kb);
+        const TN* akk = tile(k, k);
+        const TN* tkk = factors.t(k, k);
+
+        for (std::size_t j = 0; j < rt; ++j)
+        {
+            TN* bkj = btile(k, j);
+            const std::size_t jb = std::min(nb, nrhs - j * nb);
+            graph.insert([=] { kernels::unmqr(kr, kk, jb, akk, lda, tkk, nb, bkj, ldb); },
+                         {Access::write(bkj)}, tile_priority(k, kt, true));
+
+            for (std::size_t i = k + 1; i < mt; ++i)
+            {
+                TN* bij = btile(i, j);
+                const TN* aik = tile(i, k);
+                const TN* tik = factors.t(i, k);
+                const std::size_t ib = rows(i);
+                graph.insert([=] { kernels::tsmqr(kb, jb, bkj, ldb, ib, bij, ldb, aik, lda, tik, nb); },
+                             {Access::write(bkj), Access::write(bij)}, tile_priority(k, kt, i == k + 1));
+            }
+        }
+    }
+
+    graph.wait();
+    return 0;
+}
+
+// qr_async: Awaitable qr(); runs on options.pool (or the shared pool).
+// The caller keeps `a` and `factors` alive until the task completes.
+template <typename TN>
+backend::parallel::Task<int> qr_async(TN* a, std::size_t m, std::size_t n, std::size_t lda, QRFactors<TN>& factors,
+                                      TileOptions options = {})
+{
+    return backend::parallel::async_invoke(select_pool(options), options.token,
+        [a, m, n, lda, &factors, options] { return qr(a, m, n, lda, factors, options); });
+}
+
+} // namespace senkaid::engine::decompose
@@ -0,0 +1,229 @@
+#pragma once
+
+// batched.hpp: Batched small-matrix solvers over SDCompactBatch.
+// Each entry point walks the interleaved groups of its batches (in parallel over groups)
+// and runs the matching backend/cpu/batched_cpu.hpp kernel, so a group of compact_lanes<TN>
+// problems is processed with every arithmetic operation at full vector width.
+//
+// Typical use for many 4x4 systems:
+//   auto a = SDCompactBatch<4, 4>::from(std::span(matrices));
+//   auto b = SDCompactBatch<4, 1>::from(std::span(rhs));
+//   SDCompactBatch<4, 1> piv(a.count());
+//   batched_lu(a, piv);
+//   batched_lu_solve(a, piv, b);
+//   b.unpack(std::span(rhs));
+
+#include <senkaid/utils/config/root.hpp>
+#include <senkaid/utils/debug/root.hpp>
+#include <senkaid/core/matrix/batch.hpp>
+#include <senkaid/backend/cpu/batched_cpu.hpp>
+#include <senkaid/backend/parallel/parallel_for.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace senkaid::engine::solver
+{
+
+using core::matrix::SDCompactBatch;
+
+namespace detail
+{
+
+// Groups per parallel chunk: keep a chunk around 16K elements so per-chunk overhead stays small.
+template <typename Batch>
+inline constexpr std::size_t batch_grain = std::max<std::size_t>(1, 16384 / Batch::group_size);
+
+// Converts per-lane info values of group g into `info` and counts non-zero entries.
+template <typename TN, std::size_t L>
+std::size_t store_info(const TN (&lanes)[L], std::size_t g, std::size_t count, std::span<int> info)
+{
+    std::size_t failures = 0;
+    for (std::size_t l = 0; l < L && g * L + l < count; ++l)
+    {
+        const int value = static_cast<int>(lanes[l]);
+        failures += value != 0;
+        if (!info.empty())
+            info[g * L + l] = value;
+    }
+    return failures;
+}
+
+// Runs fn(g, failures&) over all groups and returns the summed failures.
+template <typename Batch, typename Fn>
+std::size_t for_each_group(const Batch& batch, Fn&& fn)
+{
+    std::vector<std::size_t> failures(batch.groups(), 0);
+
+    backend::parallel::parallel_for(0, batch.groups(), batch_grain<Batch>, [&](std::size_t lo, std::size_t hi) {
+        for (std::size_t g = lo; g < hi; ++g)
+            failures[g] = fn(g);
+    });
+
+    std::size_t total = 0;
+    for (std::size_t f : failures)
+        total += f;
+    return total;
+}
+
+} // namespace detail
+
+// batched_gemm: C[k] := alpha * A[k] * B[k] + beta * C[k] for every matrix in the batch.
+// beta == 0 ignores C's contents.
+template <int M, int N, int K, typename TN>
+void batched_gemm(TN alpha, const SDCompactBatch<M, K, TN>& a, const SDCompactBatch<K, N, TN>& b, TN beta,
+                  SDCompactBatch<M, N, TN>& c)
+{
+    if (SENKAID_UNLIKELY(a.count() != b.count() || a.count() != c.count()))
+    {
+        SENKAID_LOG_ERROR("batched_gemm: batch sizes differ");
+        return;
+    }
+
+    constexpr std::size_t L = SDCompactBatch<M, N, TN>::lanes;
+
+    detail::for_each_group(c, [&](std::size_t g) -> std::size_t {
+        backend::cpu::compact::gemm<M, N, K, L>(alpha, a.group(g), b.group(g), beta, c.group(g));
+        return 0;
+    });
+
+    c.reset_padding();
+}
+
+// batched_lu: In-place LU with partial pivoting of every matrix, P * A = L * U.
+// Parameters:
+//   a    - Batch of N x N matrices, overwritten by the factors.
+//   piv  - Receives the pivot rows of each matrix (0-based, stored as TN).
+//   info - Optional, one entry per matrix: 0 or the 1-based index of the first zero pivot.
+// Returns:
+//   Number of singular matrices.
+template <int N, typename TN>
+std::size_t batched_lu(SDCompactBatch<N, N, TN>& a, SDCompactBatch<N, 1, TN>& piv, std::span<int> info = {})
+{
+    if (SENKAID_UNLIKELY(a.count() != piv.count() || (!info.empty() && info.size() < a.count())))
+    {
+        SENKAID_LOG_ERROR("batched_lu: batch sizes differ");
+        return a.count();
+    }
+
+    constexpr std::size_t L = SDCompactBatch<N, N, TN>::lanes;
+
+    return detail::for_each_group(a, [&](std::size_t g) {
+        TN lanes[L];
+        backend::cpu::compact::getrf<N, L>(a.group(g), piv.group(g), lanes);
+        return detail::store_info(lanes, g, a.count(), info);
+    });
+}
+
+// batched_lu_solve: Solves A[k] * X[k] = B[k] from batched_lu() factors; B is overwritten by X.
+template <int N, int NRHS, typename TN>
+void batched_lu_solve(const SDCompactBatch<N, N, TN>& lu, const SDCompactBatch<N, 1, TN>& piv,
+                      SDCompactBatch<N, NRHS, TN>& b)
+{
+    if (SENKAID_UNLIKELY(lu.count() != piv.count() || lu.count() != b.count()))
+    {
+        SENKAID_LOG_ERROR("batched_lu_solve: batch sizes differ");
+        return;
+    }
+
+    constexpr std::size_t L = SDCompactBatch<N, N, TN>::lanes;
+
+    detail::for_each_group(b, [&](std::size_t g) -> std::size_t {
+        backend::cpu::compact::getrs<N, NRHS, L>(lu.group(g), piv.group(g), b.group(g));
+        return 0;
+    });
+
+    b.reset_padding();
+}
+
+// batched_cholesky: In-place Cholesky A[k] = L[k] * L[k]^T, lower triangle only.
+// Parameters:
+//   a    - Batch of symmetric positive definite N x N matrices.
+//   info - Optional, one entry per matrix: 0 or the order of the first non-positive leading minor.
+// Returns:
+//   Number of matrices that are not positive definite.
+template <int N, typename TN>
+std::size_t batched_cholesky(SDCompactBatch<N, N, TN>& a, std::span<int> info = {})
+{
+    if (SENKAID_UNLIKELY(!info.empty() && info.size() < a.count()))
+    {
+        SENKAID_LOG_ERROR("batched_cholesky: info span too small");
+        return a.count();
+    }
+
+    constexpr std::size_t L = SDCompactBatch<N, N, TN>::lanes;
+
+    return detail::for_each_group(a, [&](std::size_t g) {
+        TN lanes[L];
+        backend::cpu::compact::potrf<N, L>(a.group(g), lanes);
+        return detail::store_info(lanes, g, a.count(), info);
+    });
+}
+
+// batched_cholesky_solve: Solves A[k] * X[k] = B[k] from batched_cholesky() factors.
+template <int N, int NRHS, typename TN>
+void batched_cholesky_solve(const SDCompactBatch<N, N, TN>& l, SDCompactBatch<N, NRHS, TN>& b)
+{
+    if (SENKAID_UNLIKELY(l.count() != b.count()))
+    {
+        SENKAID_LOG_ERROR("batched_cholesky_solve: batch sizes differ");
+        return;
+    }
+
+    constexpr std::size_t L = SDCompactBatch<N, N, TN>::lanes;
+
+    detail::for_each_group(b, [&](std::size_t g) -> std::size_t {
+        backend::cpu::compact::potrs<N, NRHS, L>(l.group(g), b.group(g));
+        return 0;
+    });
+
+    b.reset_padding();
+}
+
+// batched_inverse: inv[k] := A[k]^{-1} via LU with partial pivoting; `a` is left unchanged.
+// Parameters:
+//   a    - Batch of N x N matrices.
+//   inv  - Receives the inverses (same count as a).
+//   info - Optional, per matrix: 0 or the 1-based index of the first zero pivot (inverse undefined).
+// Returns:
+//   Number of singular matrices.
+template <int N, typename TN>
+std::size_t batched_inverse(const SDCompactBatch<N, N, TN>& a, SDCompactBatch<N, N, TN>& inv,
+                            std::span<int> info = {})
+{
+    using Batch = SDCompactBatch<N, N, TN>;
+    constexpr std::size_t L = Batch::lanes;
+
+    if (SENKAID_UNLIKELY(a.count() != inv.count() || (!info.empty() && info.size() < a.count())))
+    {
+        SENKAID_LOG_ERROR("batched_inverse: batch sizes differ");
+        return a.count();
+    }
+
+    const std::size_t failures = detail::for_each_group(a, [&](std::size_t g) {
+        // Factor a private copy of the group so `a` stays intact and the work stays in L1.
+        static thread_local std::vector<TN> work;
+        work.resize(Batch::group_size + N * L);
+        TN* lu = work.data();
+        TN* piv = lu + Batch::group_size;
+        std::copy(a.group(g), a.group(g) + Batch::group_size, lu);
+
+        TN lanes[L];
+        backend::cpu::compact::getrf<N, L>(lu, piv, lanes);
+
+        TN* out = inv.group(g);
+        for (std::size_t j = 0; j < static_cast<std::size_t>(N); ++j)
+            for (std::size_t i = 0; i < static_cast<std::size_t>(N); ++i)
+                std::fill_n(out + (i + j * N) * L, L, i == j ? TN(1) : TN(0));
+
+        backend::cpu::compact::getrs<N, N, L>(lu, piv, out);
+        return detail::store_info(lanes, g, a.count(), info);
+    });
+
+    inv.reset_padding();
+    return failures;
+}
+
+} // namespace senkaid::engine::solver
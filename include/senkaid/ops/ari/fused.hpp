@@ -0,0 +1,192 @@
+#pragma once
+
+// fused.hpp: Compound level-1 updates that make one pass over memory where separate calls make two
+// or three: axpby, xpby, waxpby and scal_copy, and axpy_dot, which updates a vector and returns
+// its dot product with another (or itself) from the values still in registers. This is the core
+// of Krylov iterations, e.g. one CG step:
+//
+//   double rr_new = ops::ari::axpy_dot(-alpha, ap, r);        // r -= alpha A p; rr = r . r
+//   ops::ari::xpby(r, rr_new / rr, p);                        // p = r + beta p
+//
+// The single-thread kernels live in backend/cpu/dot_cpu.hpp. Here large buffers are split over
+// the thread pool in fixed fused_grain blocks, and the partial dots of axpy_dot are added in
+// block order, so its result does not depend on the number of threads.
+
+#include <senkaid/utils/config/root.hpp>
+#include <senkaid/utils/debug/root.hpp>
+#include <senkaid/core/matrix/dense.hpp>
+#include <senkaid/backend/cpu/dot_cpu.hpp>
+#include <senkaid/backend/parallel/parallel_for.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace senkaid::ops::ari
+{
+
+// fused_grain: Elements per parallel block.
+inline constexpr std::size_t fused_grain = 64 * 1024;
+
+namespace detail
+{
+
+// fused_blocks: kernel(lo, hi) over fused_grain blocks of [0, n) on the thread pool.
+template <typename Kernel>
+void fused_blocks(std::size_t n, Kernel kernel)
+{
+    backend::parallel::parallel_for(0, n, fused_grain, kernel);
+}
+
+// fused_dot_blocks: Sum of kernel(lo, hi) over the fused_grain blocks of [0, n), in block order.
+template <typename TN, typename Kernel>
+TN fused_dot_blocks(std::size_t n, Kernel kernel)
+{
+    const std::size_t blocks = (n + fused_grain - 1) / fused_grain;
+    if (blocks <= 1)
+        return kernel(0, n);
+
+    std::vector<TN> partial(blocks);
+    backend::parallel::parallel_for(0, blocks, 1, [&](std::size_t b0, std::size_t b1) {
+        for (std::size_t b = b0; b < b1; ++b)
+            partial[b] = kernel(b * fused_grain, std::min(n, (b + 1) * fused_grain));
+    });
+
+    TN s = partial[0];
+    for (std::size_t b = 1; b < blocks; ++b)
+        s += partial[b];
+    return s;
+}
+
+template <typename A, typename B>
+SENKAID_FORCE_INLINE bool same_shape(const A& a, const B& b) noexcept
+{
+    return a.rows() == b.rows() && a.cols() == b.cols();
+}
+
+} // namespace detail
+
+// axpby: y = a x + b y.
+template <typename TN>
+void axpby(TN a, const TN* x, TN b, TN* y, std::size_t n)
+{
+    detail::fused_blocks(n, [&](std::size_t lo, std::size_t hi) { backend::cpu::axpby(a, x + lo, b, y + lo, hi - lo); });
+}
+
+// xpby: y = x + b y.
+template <typename TN>
+void xpby(const TN* x, TN b, TN* y, std::size_t n)
+{
+    detail::fused_blocks(n, [&](std::size_t lo, std::size_t hi) { backend::cpu::xpby(x + lo, b, y + lo, hi - lo); });
+}
+
+// waxpby: w = a x + b y; w must not overlap x or y.
+template <typename TN>
+void waxpby(TN a, const TN* x, TN b, const TN* y, TN* w, std::size_t n)
+{
+    detail::fused_blocks(n, [&](std::size_t lo, std::size_t hi) { backend::cpu::waxpby(a, x + lo, b, y + lo, w + lo, hi - lo); });
+}
+
+// scal_copy: y = a x.
+template <typename TN>
+void scal_copy(TN a, const TN* x, TN* y, std::size_t n)
+{
+    detail::fused_blocks(n, [&](std::size_t lo, std::size_t hi) { backend::cpu::scal_copy(a, x + lo, y + lo, hi - lo); });
+}
+
+// axpy_dot: y += a x, returning (updated y) . z; z may be y.
+template <typename TN>
+TN axpy_dot(TN a, const TN* x, TN* y, const TN* z, std::size_t n)
+{
+    return detail::fused_dot_blocks<TN>(n, [&](std::size_t lo, std::size_t hi) {
+        return backend::cpu::axpy_dot(a, x + lo, y + lo, z + lo, hi - lo);
+    });
+}
+
+// axpy_dot: y += a x, returning (updated y) . (updated y).
+template <typename TN>
+TN axpy_dot(TN a, const TN* x, TN* y, std::size_t n)
+{
+    return axpy_dot(a, x, y, y, n);
+}
+
+// Dense overloads: operands are matrices of one shape and layout, taken entrywise (vectors are
+// n x 1 or 1 x n). On a shape mismatch they log an error and leave the outputs unchanged
+// (axpy_dot returns 0).
+
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+void axpby(TN a, const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& x, TN b,
+           core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& y)
+{
+    if (SENKAID_UNLIKELY(!detail::same_shape(x, y)))
+    {
+        SENKAID_LOG_ERROR("axpby: operand shapes differ");
+        return;
+    }
+    axpby(a, x.data(), b, y.data(), y.size());
+}
+
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+void xpby(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& x, TN b,
+          core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& y)
+{
+    if (SENKAID_UNLIKELY(!detail::same_shape(x, y)))
+    {
+        SENKAID_LOG_ERROR("xpby: operand shapes differ");
+        return;
+    }
+    xpby(x.data(), b, y.data(), y.size());
+}
+
+// waxpby: Resizes a dynamic w to the shape of x.
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+void waxpby(TN a, const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& x, TN b,
+            const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& y, core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& w)
+{
+    if (SENKAID_UNLIKELY(!detail::same_shape(x, y)))
+    {
+        SENKAID_LOG_ERROR("waxpby: operand shapes differ");
+        return;
+    }
+    if (!detail::same_shape(w, x))
+        w = core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>(x.rows(), x.cols());
+    waxpby(a, x.data(), b, y.data(), w.data(), w.size());
+}
+
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+core::matrix::SDDenseMatrix<Rows, Cols, TN, Major> waxpby(TN a, const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& x, TN b,
+                                                          const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& y)
+{
+    core::matrix::SDDenseMatrix<Rows, Cols, TN, Major> w;
+    waxpby(a, x, b, y, w);
+    return w;
+}
+
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+void scal_copy(TN a, const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& x,
+               core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& y)
+{
+    if (!detail::same_shape(y, x))
+        y = core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>(x.rows(), x.cols());
+    scal_copy(a, x.data(), y.data(), y.size());
+}
+
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+TN axpy_dot(TN a, const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& x, core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& y,
+            const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& z)
+{
+    if (SENKAID_UNLIKELY(!detail::same_shape(x, y) || !detail::same_shape(y, z)))
+    {
+        SENKAID_LOG_ERROR("axpy_dot: operand shapes differ");
+        return TN(0);
+    }
+    return axpy_dot(a, x.data(), y.data(), z.data(), y.size());
+}
+
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+TN axpy_dot(TN a, const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& x, core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& y)
+{
+    return axpy_dot(a, x, y, y);
+}
+
+} // namespace senkaid::ops::ari
@@ -0,0 +1,242 @@
+#pragma once
+
+// broadcast_binary.hpp: Element-wise binary operations between broadcast operands.
+// The output is walked line by line in its own storage order. Along a line, every operand
+// either advances one element per element (a contiguous line of a dense operand, or the
+// repeated row of a Row view) or stays put (a Column view, which is one value per output row,
+// or a Scalar); each of the four combinations has its own pack loop with a masked tail, and the
+// stationary side is a single broadcast register. Anything else (an operand stored in the
+// other order) reads element by element. When both operands are flat over the whole output,
+// the output is processed as one long line. Lines are spread over the thread pool.
+//
+// So x + bias for a 1000000 x 256 row-major x and a 1 x 256 bias is 1000000 vector loops over
+// the same 256 bias elements, and x * s for a column s scales each row by one register.
+//
+//   auto y = ops::broadcast::add_broadcast(x, bias);
+//   ops::broadcast::broadcast_binary(view_of(x), broadcast_to(s, n, m), y, ops::broadcast::Mul{});
+
+#include <senkaid/utils/config/root.hpp>
+#include <senkaid/utils/debug/root.hpp>
+#include <senkaid/core/matrix/dense.hpp>
+#include <senkaid/backend/simd/simd_load_store.hpp>
+#include <senkaid/backend/parallel/parallel_for.hpp>
+#include "broadcast_shape.hpp"
+#include "broadcast_expr.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+
+namespace senkaid::ops::broadcast
+{
+
+// broadcast_grain: Output elements per parallel chunk.
+inline constexpr std::size_t broadcast_grain = 16 * 1024;
+
+// Operation functors; each applies to packs and to single elements.
+struct Add
+{
+    template <typename P>
+    SENKAID_FORCE_INLINE P operator()(P a, P b) const noexcept { return a + b; }
+};
+
+struct Sub
+{
+    template <typename P>
+    SENKAID_FORCE_INLINE P operator()(P a, P b) const noexcept { return a - b; }
+};
+
+struct Mul
+{
+    template <typename P>
+    SENKAID_FORCE_INLINE P operator()(P a, P b) const noexcept { return a * b; }
+};
+
+struct Div
+{
+    template <typename P>
+    SENKAID_FORCE_INLINE P operator()(P a, P b) const noexcept { return a / b; }
+};
+
+struct Min
+{
+    template <typename P>
+    SENKAID_FORCE_INLINE P operator()(P a, P b) const noexcept
+    {
+        using std::min;
+        return min(a, b);
+    }
+};
+
+struct Max
+{
+    template <typename P>
+    SENKAID_FORCE_INLINE P operator()(P a, P b) const noexcept
+    {
+        using std::max;
+        return max(a, b);
+    }
+};
+
+namespace detail
+{
+
+// line: out[k] = op(a[k * sa], b[k * sb]) for k < len. out may be a itself (in place).
+template <typename TN, typename Op>
+SENKAID_FORCE_INLINE void line(TN* out, const TN* a, std::ptrdiff_t sa, const TN* b, std::ptrdiff_t sb,
+                               std::size_t len, Op& op)
+{
+    namespace simd = backend::simd;
+    using P = simd::pack<TN>;
+
+    // Integer division traps on the zeros a masked tail reads, so integer tails go element-wise.
+    const std::size_t body = std::is_integral_v<TN> ? len - len % P::lanes : len;
+
+    const auto run = [&](auto load_a, auto load_b) {
+        simd::for_each_pack<TN>(0, body, [&](std::size_t k, auto io) { io.store(out + k, op(load_a(k, io), load_b(k, io))); });
+        return body;
+    };
+    const auto contiguous = [](const TN* p) { return [p](std::size_t k, auto io) { return io.load(p + k); }; };
+    const auto stationary = [](const TN* p) { return [v = P(*p)](std::size_t, auto) { return v; }; };
+
+    std::size_t k = 0;
+    if (sa == 1 && sb == 1)
+        k = run(contiguous(a), contiguous(b));
+    else if (sa == 1 && sb == 0)
+        k = run(contiguous(a), stationary(b));
+    else if (sa == 0 && sb == 1)
+        k = run(stationary(a), contiguous(b));
+    else if (sa == 0 && sb == 0)
+        k = run(stationary(a), stationary(b));
+
+    for (; k < len; ++k)
+        out[k] = op(a[static_cast<std::ptrdiff_t>(k) * sa], b[static_cast<std::ptrdiff_t>(k) * sb]);
+}
+
+// apply: out = op(a, b) over a rows x cols output stored row- or column-major; a and b are
+// views of that shape.
+template <typename TN, typename Op>
+void apply(const BroadcastView<TN>& a, const BroadcastView<TN>& b, TN* out, std::size_t rows, std::size_t cols,
+           bool row_major, Op& op)
+{
+    const std::size_t lines = row_major ? rows : cols;
+    const std::size_t len = row_major ? cols : rows;
+    if (lines == 0 || len == 0)
+        return;
+
+    const auto line_stride = [&](const BroadcastView<TN>& v) { return row_major ? v.row_stride : v.col_stride; };
+    const auto step = [&](const BroadcastView<TN>& v) { return row_major ? v.col_stride : v.row_stride; };
+    const auto flat = [&](const BroadcastView<TN>& v) {
+        return (step(v) == 1 && line_stride(v) == static_cast<std::ptrdiff_t>(len)) || (step(v) == 0 && line_stride(v) == 0);
+    };
+
+    if (flat(a) && flat(b))
+    {
+        backend::parallel::parallel_for(0, lines * len, broadcast_grain, [&](std::size_t lo, std::size_t hi) {
+            const auto at = static_cast<std::ptrdiff_t>(lo);
+            line(out + lo, a.base() + at * step(a), step(a), b.base() + at * step(b), step(b), hi - lo, op);
+        });
+        return;
+    }
+
+    const std::size_t grain = std::max<std::size_t>(1, broadcast_grain / len);
+    backend::parallel::parallel_for(0, lines, grain, [&](std::size_t lo, std::size_t hi) {
+        for (std::size_t i = lo; i < hi; ++i)
+        {
+            const auto at = static_cast<std::ptrdiff_t>(i);
+            line(out + i * len, a.base() + at * line_stride(a), step(a), b.base() + at * line_stride(b), step(b), len, op);
+        }
+    });
+}
+
+// operand_view: View of a matrix or scalar operand as a rows x cols matrix of TN.
+template <typename TN, typename A>
+SENKAID_FORCE_INLINE BroadcastView<TN> operand_view(const A& a, std::size_t rows, std::size_t cols)
+{
+    if constexpr (core::matrix::Scalar<A>)
+        return broadcast_to(static_cast<TN>(a), rows, cols);
+    else
+        return broadcast_to(a, rows, cols);
+}
+
+} // namespace detail
+
+// broadcast_result: Dense result type of broadcasting A and B (matrices or scalars, at least one
+// matrix). Element type and layout come from the first matrix operand; each extent is fixed when
+// broadcast_extent can tell it at compile time.
+template <typename A, typename B>
+struct broadcast_result
+{
+    using matrix = std::conditional_t<core::matrix::Scalar<A>, B, A>;
+    using value_type = typename matrix::value_type;
+
+    static constexpr int rows = broadcast_extent<matrix_extents<A>::rows, matrix_extents<B>::rows>;
+    static constexpr int cols = broadcast_extent<matrix_extents<A>::cols, matrix_extents<B>::cols>;
+
+    using type = core::matrix::SDDenseMatrix<rows, cols, value_type, matrix::major>;
+};
+
+// broadcast_binary: out = op(a, b) element-wise, with a and b already viewed at out's shape.
+template <typename Op, typename TN, int Rows, int Cols, core::matrix::SDMajor Major>
+void broadcast_binary(const BroadcastView<TN>& a, const BroadcastView<TN>& b,
+                      core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& out, Op op)
+{
+    if (SENKAID_UNLIKELY(a.rows != out.rows() || a.cols != out.cols() || b.rows != out.rows() || b.cols != out.cols()))
+    {
+        SENKAID_LOG_ERROR("broadcast_binary: operand views and output shapes differ");
+        return;
+    }
+    detail::apply(a, b, out.data(), out.rows(), out.cols(), Major == core::matrix::SDMajor::RowMajor, op);
+}
+
+// broadcast_binary: op(a, b) element-wise over the broadcast shape of a and b (NumPy rules).
+// Logs an error and returns a default matrix if the shapes are incompatible; incompatible
+// fixed extents do not compile.
+template <typename Op, typename A, typename B>
+requires (!core::matrix::Scalar<A> || !core::matrix::Scalar<B>)
+typename broadcast_result<A, B>::type broadcast_binary(const A& a, const B& b, Op op)
+{
+    using R = broadcast_result<A, B>;
+    using TN = typename R::value_type;
+    static_assert(can_broadcast_extent<matrix_extents<A>::rows, matrix_extents<B>::rows> &&
+                      can_broadcast_extent<matrix_extents<A>::cols, matrix_extents<B>::cols>,
+                  "broadcast_binary: fixed shapes do not broadcast");
+
+    BroadcastShape s;
+    if (SENKAID_UNLIKELY(!broadcast_shape(shape_of(a), shape_of(b), s)))
+    {
+        SENKAID_LOG_ERROR("broadcast_binary: shapes do not broadcast");
+        return {};
+    }
+
+    typename R::type out(s[0], s[1]);
+    broadcast_binary(detail::operand_view<TN>(a, s[0], s[1]), detail::operand_view<TN>(b, s[0], s[1]), out, op);
+    return out;
+}
+
+// add_broadcast / sub_broadcast / mul_broadcast / div_broadcast: broadcast_binary with Add, ...
+template <typename A, typename B>
+auto add_broadcast(const A& a, const B& b)
+{
+    return broadcast_binary(a, b, Add{});
+}
+
+template <typename A, typename B>
+auto sub_broadcast(const A& a, const B& b)
+{
+    return broadcast_binary(a, b, Sub{});
+}
+
+template <typename A, typename B>
+auto mul_broadcast(const A& a, const B& b)
+{
+    return broadcast_binary(a, b, Mul{});
+}
+
+template <typename A, typename B>
+auto div_broadcast(const A& a, const B& b)
+{
+    return broadcast_binary(a, b, Div{});
+}
+
+} // namespace senkaid::ops::broadcast
@@ -0,0 +1,122 @@
+#pragma once
+
+// broadcast_expr.hpp: Stride-0 views that present a matrix, vector or scalar as a larger matrix.
+// A BroadcastView never owns or copies data: element (i, j) is read from
+// data[i * row_stride + j * col_stride], with the stride of every stretched axis set to 0. A
+// 1 x 256 bias row viewed as 1000000 x 256 is the same 256 numbers with row_stride == 0.
+//
+// pattern() names the common shapes so kernels can pick a contiguous loop for each:
+//   Dense  - No stretched axis.
+//   Row    - One row repeated down the rows (row_stride == 0).
+//   Column - One column repeated across the columns (col_stride == 0).
+//   Scalar - One value everywhere.
+//
+//   auto bias = broadcast_to(b, x.rows(), x.cols());     // b is 1 x x.cols()
+
+#include <senkaid/utils/config/root.hpp>
+#include <senkaid/utils/debug/root.hpp>
+#include <senkaid/core/matrix/dense.hpp>
+#include "broadcast_shape.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace senkaid::ops::broadcast
+{
+
+// BroadcastPattern: Which axes of a BroadcastView are stretched.
+enum class BroadcastPattern : uint8_t
+{
+    Dense = 0x01,
+    Row = 0x02,
+    Column = 0x03,
+    Scalar = 0x04
+};
+
+// BroadcastView: Read-only rows x cols view with element strides that may be 0. Scalar views
+// keep their value inline (data == nullptr); use base() for a pointer that is always valid.
+template <typename TN>
+struct BroadcastView
+{
+    using value_type = TN;
+
+    const TN* data = nullptr;
+    std::size_t rows = 0;
+    std::size_t cols = 0;
+    std::ptrdiff_t row_stride = 0;
+    std::ptrdiff_t col_stride = 0;
+    TN value = TN(0);
+
+    // base: Address of element (0, 0).
+    constexpr SENKAID_FORCE_INLINE const TN* base() const noexcept { return data != nullptr ? data : &value; }
+
+    constexpr SENKAID_FORCE_INLINE TN operator()(std::size_t i, std::size_t j) const noexcept
+    {
+        return base()[static_cast<std::ptrdiff_t>(i) * row_stride + static_cast<std::ptrdiff_t>(j) * col_stride];
+    }
+
+    constexpr SENKAID_FORCE_INLINE BroadcastShape shape() const noexcept { return BroadcastShape{rows, cols}; }
+
+    constexpr BroadcastPattern pattern() const noexcept
+    {
+        const bool stretched_rows = row_stride == 0 && rows > 1;
+        const bool stretched_cols = col_stride == 0 && cols > 1;
+        if (stretched_rows && stretched_cols)
+            return BroadcastPattern::Scalar;
+        if (stretched_rows)
+            return BroadcastPattern::Row;
+        if (stretched_cols)
+            return BroadcastPattern::Column;
+        return BroadcastPattern::Dense;
+    }
+};
+
+// view_of: Unstretched view of a dense matrix in its own layout.
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+constexpr BroadcastView<TN> view_of(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a) noexcept
+{
+    BroadcastView<TN> v;
+    v.data = a.data();
+    v.rows = a.rows();
+    v.cols = a.cols();
+    v.row_stride = Major == core::matrix::SDMajor::RowMajor ? static_cast<std::ptrdiff_t>(a.cols()) : 1;
+    v.col_stride = Major == core::matrix::SDMajor::RowMajor ? 1 : static_cast<std::ptrdiff_t>(a.rows());
+    return v;
+}
+
+// broadcast_to: View of `a` as a rows x cols matrix. Logs an error and returns an empty view if
+// a's shape does not broadcast to (rows, cols); check with broadcasts_to() to tell the cases apart.
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+constexpr BroadcastView<TN> broadcast_to(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a,
+                                         std::size_t rows, std::size_t cols) noexcept
+{
+    const BroadcastView<TN> src = view_of(a);
+    std::array<std::ptrdiff_t, max_broadcast_rank> strides{src.row_stride, src.col_stride}, out{};
+    if (SENKAID_UNLIKELY(!broadcast_strides(src.shape(), strides, BroadcastShape{rows, cols}, out)))
+    {
+        SENKAID_LOG_ERROR("broadcast_to: shape does not broadcast to the target");
+        return {};
+    }
+
+    BroadcastView<TN> v = src;
+    v.rows = rows;
+    v.cols = cols;
+    v.row_stride = out[0];
+    v.col_stride = out[1];
+    return v;
+}
+
+// broadcast_to: A scalar viewed as a rows x cols matrix.
+template <typename TN>
+requires core::matrix::Scalar<TN>
+constexpr BroadcastView<TN> broadcast_to(TN value, std::size_t rows, std::size_t cols) noexcept
+{
+    BroadcastView<TN> v;
+    v.rows = rows;
+    v.cols = cols;
+    v.value = value;
+    return v;
+}
+
+} // namespace senkaid::ops::broadcast
@@ -0,0 +1,63 @@
+#pragma once
+
+// broadcast_inplace.hpp: a = op(a, b) with b broadcast to the shape of a.
+// b may be a matrix whose shape stretches to a's (a row, a column, a 1 x 1) or a scalar; a is
+// never resized. The update runs the line kernels of broadcast_binary.hpp directly on a's
+// storage, so adding a bias row to every row of a large matrix reads the row from cache and
+// touches each element of a once.
+//
+//   ops::broadcast::broadcast_add_inplace(x, bias);     // x(i, j) += bias(0, j)
+//   ops::broadcast::broadcast_mul_inplace(x, 0.5);
+
+#include <senkaid/utils/config/root.hpp>
+#include <senkaid/utils/debug/root.hpp>
+#include <senkaid/core/matrix/dense.hpp>
+#include "broadcast_shape.hpp"
+#include "broadcast_expr.hpp"
+#include "broadcast_binary.hpp"
+
+namespace senkaid::ops::broadcast
+{
+
+// broadcast_inplace: a(i, j) = op(a(i, j), b(i, j)) with b stretched to a's shape. Logs an error
+// and leaves a unchanged if b's shape does not broadcast to it.
+template <typename Op, int Rows, int Cols, typename TN, core::matrix::SDMajor Major, typename B>
+void broadcast_inplace(core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a, const B& b, Op op)
+{
+    static_assert(can_broadcast_extent<Rows, matrix_extents<B>::rows> && can_broadcast_extent<Cols, matrix_extents<B>::cols>,
+                  "broadcast_inplace: fixed shapes do not broadcast");
+
+    if (SENKAID_UNLIKELY(!broadcasts_to(shape_of(b), shape_of(a))))
+    {
+        SENKAID_LOG_ERROR("broadcast_inplace: operand does not broadcast to the target shape");
+        return;
+    }
+    broadcast_binary(view_of(a), detail::operand_view<TN>(b, a.rows(), a.cols()), a, op);
+}
+
+// broadcast_add_inplace / sub / mul / div: broadcast_inplace with Add, Sub, Mul, Div.
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major, typename B>
+void broadcast_add_inplace(core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a, const B& b)
+{
+    broadcast_inplace(a, b, Add{});
+}
+
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major, typename B>
+void broadcast_sub_inplace(core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a, const B& b)
+{
+    broadcast_inplace(a, b, Sub{});
+}
+
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major, typename B>
+void broadcast_mul_inplace(core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a, const B& b)
+{
+    broadcast_inplace(a, b, Mul{});
+}
+
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major, typename B>
+void broadcast_div_inplace(core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a, const B& b)
+{
+    broadcast_inplace(a, b, Div{});
+}
+
+} // namespace senkaid::ops::broadcast
@@ -0,0 +1,158 @@
+#pragma once
+
+// broadcast_shape.hpp: NumPy broadcasting rules for shapes, and the strides they imply.
+// Shapes are aligned at their last extent; a missing leading extent counts as 1. Two extents
+// are compatible when they are equal or one of them is 1, and the result takes the other one.
+// Wherever a source extent is stretched, its stride becomes 0, so a broadcast operand is read
+// in place and never replicated.
+//
+// The same rules run at compile time on matrix extents (-1 = dynamic), so the result type of a
+// broadcast between fixed-size matrices is fixed-size as well, and incompatible fixed shapes
+// fail to compile.
+//
+//   BroadcastShape s;
+//   broadcast_shape({1000000, 256}, {1, 256}, s);    // s == {1000000, 256}, the row has stride 0
+
+#include <senkaid/utils/config/root.hpp>
+#include <senkaid/core/matrix/dense.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <type_traits>
+
+namespace senkaid::ops::broadcast
+{
+
+// max_broadcast_rank: Largest rank a BroadcastShape holds.
+inline constexpr std::size_t max_broadcast_rank = 8;
+
+// dynamic_extent: Extent only known at run time (the -1 of SDDenseMatrix).
+inline constexpr int dynamic_extent = -1;
+
+// BroadcastShape: Extents of a rank <= max_broadcast_rank array, outermost first.
+struct BroadcastShape
+{
+    std::size_t rank = 0;
+    std::array<std::size_t, max_broadcast_rank> extents{};
+
+    constexpr BroadcastShape() = default;
+
+    constexpr BroadcastShape(std::initializer_list<std::size_t> e) : rank(e.size() < max_broadcast_rank ? e.size() : max_broadcast_rank)
+    {
+        std::size_t d = 0;
+        for (auto it = e.begin(); d < rank; ++it, ++d)
+            extents[d] = *it;
+    }
+
+    constexpr std::size_t operator[](std::size_t d) const noexcept { return extents[d]; }
+
+    // extent_from_back: Extent k places from the innermost one; 1 beyond the rank.
+    constexpr std::size_t extent_from_back(std::size_t k) const noexcept { return k < rank ? extents[rank - 1 - k] : 1; }
+
+    constexpr std::size_t size() const noexcept
+    {
+        std::size_t n = 1;
+        for (std::size_t d = 0; d < rank; ++d)
+            n *= extents[d];
+        return n;
+    }
+
+    friend constexpr bool operator==(const BroadcastShape& a, const BroadcastShape& b) noexcept
+    {
+        if (a.rank != b.rank)
+            return false;
+        for (std::size_t d = 0; d < a.rank; ++d)
+            if (a.extents[d] != b.extents[d])
+                return false;
+        return true;
+    }
+};
+
+// broadcast_shape: Shape of the broadcast of a and b into `out`; false, leaving `out` alone,
+// if some aligned extents differ and neither is 1.
+constexpr bool broadcast_shape(const BroadcastShape& a, const BroadcastShape& b, BroadcastShape& out) noexcept
+{
+    BroadcastShape r;
+    r.rank = a.rank > b.rank ? a.rank : b.rank;
+    for (std::size_t k = 0; k < r.rank; ++k)
+    {
+        const std::size_t ea = a.extent_from_back(k), eb = b.extent_from_back(k);
+        if (ea != eb && ea != 1 && eb != 1)
+            return false;
+        r.extents[r.rank - 1 - k] = ea == 1 ? eb : ea;
+    }
+    out = r;
+    return true;
+}
+
+// can_broadcast: a and b have a common broadcast shape.
+constexpr bool can_broadcast(const BroadcastShape& a, const BroadcastShape& b) noexcept
+{
+    BroadcastShape r;
+    return broadcast_shape(a, b, r);
+}
+
+// broadcasts_to: `from` stretches to exactly `to` (to is not enlarged in the process).
+constexpr bool broadcasts_to(const BroadcastShape& from, const BroadcastShape& to) noexcept
+{
+    BroadcastShape r;
+    return from.rank <= to.rank && broadcast_shape(from, to, r) && r == to;
+}
+
+// broadcast_strides: Element strides that read an array of shape `from` and strides `strides`
+// as shape `to`: stretched and missing extents get stride 0. Returns false if `from` does not
+// broadcast to `to`.
+constexpr bool broadcast_strides(const BroadcastShape& from, const std::array<std::ptrdiff_t, max_broadcast_rank>& strides,
+                                 const BroadcastShape& to, std::array<std::ptrdiff_t, max_broadcast_rank>& out) noexcept
+{
+    if (!broadcasts_to(from, to))
+        return false;
+
+    for (std::size_t k = 0; k < to.rank; ++k)
+    {
+        const std::size_t d = to.rank - 1 - k;
+        out[d] = k < from.rank && from.extents[from.rank - 1 - k] != 1 ? strides[from.rank - 1 - k] : 0;
+    }
+    return true;
+}
+
+// can_broadcast_extent / broadcast_extent: The rules on compile-time extents. A dynamic extent
+// is assumed compatible; the result is fixed when one side is a fixed extent other than 1.
+template <int A, int B>
+inline constexpr bool can_broadcast_extent = A < 0 || B < 0 || A == B || A == 1 || B == 1;
+
+template <int A, int B>
+inline constexpr int broadcast_extent = (A > 1) ? A : (B > 1) ? B : (A == 1 && B == 1) ? 1 : dynamic_extent;
+
+// matrix_extents: Compile-time rows / cols of a broadcast operand; scalars are 1 x 1.
+template <typename T>
+struct matrix_extents
+{
+    static constexpr int rows = 1;
+    static constexpr int cols = 1;
+};
+
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+struct matrix_extents<core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>>
+{
+    static constexpr int rows = Rows;
+    static constexpr int cols = Cols;
+};
+
+// shape_of: Run-time shape of an operand; rank 2 for matrices, rank 0 for scalars.
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+constexpr BroadcastShape shape_of(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a) noexcept
+{
+    return BroadcastShape{a.rows(), a.cols()};
+}
+
+template <typename TN>
+requires core::matrix::Scalar<TN>
+constexpr BroadcastShape shape_of(const TN&) noexcept
+{
+    return BroadcastShape{};
+}
+
+} // namespace senkaid::ops::broadcast
@@ -0,0 +1,313 @@
+#pragma once
+
+// kronecker.hpp: Lazy Kronecker products A ⊗ B and sums of them, applied without materializing.
+// A ⊗ B of a p x q and an r x s factor is the pr x qs matrix whose (i r + k, j s + l) entry is
+// a(i, j) b(k, l); for 1000 x 1000 factors that is 10^12 entries. kron() records the factors
+// instead (non-owning, like a BroadcastView: they must outlive the expression), and terms add
+// up with + and scale with a scalar, as long as the total shapes agree.
+//
+// apply() uses the vec trick: with x read as the s x q column-major matrix X (x = vec(X)),
+// (A ⊗ B) x = vec(B X Aᵀ). That is two GEMMs (backend/cpu/matmul_cpu.hpp), O(rs q + r q p)
+// work in place of O(pr qs); each term picks the cheaper of (B X) Aᵀ and B (X Aᵀ). With many
+// right-hand sides one of the two products is a single GEMM over all of them and the other a
+// batch of equal GEMMs, in either layout and without copies. A single GEMM is split by output
+// columns over the thread pool, a batch by its members. materialize() builds the dense matrix for
+// small products: each output line is a run of scaled lines of B, written with the level-1
+// kernels of backend/cpu/dot_cpu.hpp, lines spread over the pool.
+//
+//   auto k = ops::linalg::kron(a, b) + ops::linalg::kron(c, d) * 0.5;
+//   auto y = k.apply(x);                                   // x: k.cols() x m, y: k.rows() x m
+//   auto dense = k.materialize();                          // only when k is small
+
+#include <senkaid/utils/config/root.hpp>
+#include <senkaid/utils/debug/root.hpp>
+#include <senkaid/core/matrix/dense.hpp>
+#include <senkaid/backend/cpu/matmul_cpu.hpp>
+#include <senkaid/backend/cpu/dot_cpu.hpp>
+#include <senkaid/backend/parallel/parallel_for.hpp>
+#include "matmul.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace senkaid::ops::linalg
+{
+
+// KroneckerFactor: Non-owning view of one dense factor.
+template <typename TN>
+struct KroneckerFactor
+{
+    const TN* data = nullptr;
+    std::size_t rows = 0;
+    std::size_t cols = 0;
+    bool row_major = true;
+
+    SENKAID_FORCE_INLINE TN operator()(std::size_t i, std::size_t j) const noexcept
+    {
+        return row_major ? data[i * cols + j] : data[i + j * rows];
+    }
+
+    // op / ld: The factor as a column-major GEMM operand; a row-major factor is its transpose.
+    backend::cpu::Op op(bool transposed = false) const noexcept
+    {
+        return row_major != transposed ? backend::cpu::Op::Trans : backend::cpu::Op::NoTrans;
+    }
+    std::size_t ld() const noexcept { return std::max<std::size_t>(1, row_major ? cols : rows); }
+};
+
+// KroneckerTerm: alpha (a ⊗ b).
+template <typename TN>
+struct KroneckerTerm
+{
+    TN alpha = TN(1);
+    KroneckerFactor<TN> a;
+    KroneckerFactor<TN> b;
+};
+
+namespace detail
+{
+
+// factor_of: View of a dense matrix.
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+KroneckerFactor<TN> factor_of(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a) noexcept
+{
+    return {a.data(), a.rows(), a.cols(), Major == core::matrix::SDMajor::RowMajor};
+}
+
+// kron_work_elements: Intermediate kept per chunk of column-major right-hand sides (L2-sized).
+inline constexpr std::size_t kron_work_elements = std::size_t(1) << 15;
+
+// gemm_batch: `count` column-major GEMMs C_i = alpha op(A_i) op(B_i) + beta C_i, operand i of each at
+// i * its stride (0 shares it). One is split over the pool by columns, several run one per task.
+template <typename TN>
+void gemm_batch(std::size_t count, backend::cpu::Op opa, backend::cpu::Op opb, std::size_t m, std::size_t n, std::size_t k, TN alpha,
+                const TN* a, std::size_t lda, std::size_t stride_a, const TN* b, std::size_t ldb, std::size_t stride_b, TN beta, TN* c,
+                std::size_t ldc, std::size_t stride_c)
+{
+    constexpr std::size_t work = std::size_t(1) << 21;
+
+    if (count == 1)
+    {
+        gemm_columns(opa, opb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+        return;
+    }
+    const std::size_t grain = std::max<std::size_t>(1, work / std::max<std::size_t>(1, m * n * std::max<std::size_t>(1, k)));
+    backend::parallel::parallel_for(0, count, grain, [&](std::size_t i0, std::size_t i1) {
+        for (std::size_t i = i0; i < i1; ++i)
+            backend::cpu::gemm(opa, opb, m, n, k, alpha, a + i * stride_a, lda, b + i * stride_b, ldb, beta, c + i * stride_c, ldc);
+    });
+}
+
+// apply_term: Y = alpha t X + beta Y for one term, X the cols() x n and Y the rows() x n matrices of
+// n right-hand sides, both column-major or both row-major and unpadded. Per right-hand side this
+// is vec(B X_c Aᵀ) with X_c the s x q reshape of column c; across them one factor is a single GEMM
+// over all right-hand sides and the other a batch of equal GEMMs.
+template <typename TN>
+void apply_term(const KroneckerTerm<TN>& t, TN alpha, const TN* x, TN beta, TN* y, std::size_t n, bool row_major)
+{
+    using backend::cpu::Op;
+    const std::size_t p = t.a.rows, q = t.a.cols, r = t.b.rows, s = t.b.cols;
+    const auto ld = [](std::size_t v) { return std::max<std::size_t>(1, v); };
+    static thread_local std::vector<TN> work;
+
+    // B first: T_c = B X_c (r x q), then Y_c = T_c Aᵀ; otherwise U_c = X_c Aᵀ (s x p), then Y_c = B U_c.
+    const bool b_first = r * q * (s + p) <= s * p * (q + r);
+    work.resize(row_major ? (b_first ? r * q * n : s * p * n) : std::max(kron_work_elements, b_first ? r * q : s * p));
+    TN* w = work.data();
+    const TN scale = alpha * t.alpha;
+
+    if (!row_major)
+    {
+        // The X_c lie side by side as one s x qn matrix, the Y_c as one r x pn matrix. They are
+        // taken in chunks that keep the intermediate in cache.
+        const std::size_t chunk = std::max<std::size_t>(1, kron_work_elements / std::max<std::size_t>(1, b_first ? r * q : s * p));
+        for (std::size_t c0 = 0; c0 < n; c0 += chunk)
+        {
+            const std::size_t nc = std::min(chunk, n - c0);
+            const TN* xc = x + c0 * s * q;
+            TN* yc = y + c0 * r * p;
+            if (b_first)
+            {
+                gemm_columns(t.b.op(), Op::NoTrans, r, q * nc, s, TN(1), t.b.data, t.b.ld(), xc, ld(s), TN(0), w, ld(r));
+                gemm_batch(nc, Op::NoTrans, t.a.op(true), r, p, q, scale, w, ld(r), r * q, t.a.data, t.a.ld(), 0, beta, yc, ld(r), r * p);
+            }
+            else
+            {
+                gemm_batch(nc, Op::NoTrans, t.a.op(true), s, p, q, TN(1), xc, ld(s), s * q, t.a.data, t.a.ld(), 0, TN(0), w, ld(s), s * p);
+                gemm_columns(t.b.op(), Op::NoTrans, r, p * nc, s, scale, t.b.data, t.b.ld(), w, ld(s), beta, yc, ld(r));
+            }
+        }
+    }
+    else
+    {
+        // Read column-major, X is n x sq with X_c(l, j) at c + (l + j s) n: for each j an n x s
+        // slice, the slices stacked into one ns x q matrix. Y likewise is n x rp.
+        if (b_first)
+        {
+            gemm_batch(q, Op::NoTrans, t.b.op(true), n, r, s, TN(1), x, ld(n), n * s, t.b.data, t.b.ld(), 0, TN(0), w, ld(n), n * r);
+            gemm_columns(Op::NoTrans, t.a.op(true), n * r, p, q, scale, w, ld(n * r), t.a.data, t.a.ld(), beta, y, ld(n * r));
+        }
+        else
+        {
+            gemm_columns(Op::NoTrans, t.a.op(true), n * s, p, q, TN(1), x, ld(n * s), t.a.data, t.a.ld(), TN(0), w, ld(n * s));
+            gemm_batch(p, Op::NoTrans, t.b.op(true), n, r, s, scale, w, ld(n), n * s, t.b.data, t.b.ld(), 0, beta, y, ld(n), n * r);
+        }
+    }
+}
+
+} // namespace detail
+
+// Kronecker: Sum of terms alpha_t (a_t ⊗ b_t), all of one total shape, evaluated lazily.
+template <typename TN>
+class Kronecker
+{
+public:
+    using value_type = TN;
+
+    Kronecker() = default;
+
+    explicit Kronecker(const KroneckerTerm<TN>& term) : _terms{term} {}
+
+    std::size_t rows() const noexcept { return _terms.empty() ? 0 : _terms[0].a.rows * _terms[0].b.rows; }
+    std::size_t cols() const noexcept { return _terms.empty() ? 0 : _terms[0].a.cols * _terms[0].b.cols; }
+    const std::vector<KroneckerTerm<TN>>& terms() const noexcept { return _terms; }
+
+    // Entry (i, j), summed over the terms.
+    TN operator()(std::size_t i, std::size_t j) const noexcept
+    {
+        SENKAID_ASSERT(i < rows() && j < cols(), "Kronecker: index out of range");
+        TN v = TN(0);
+        for (const auto& t : _terms)
+            v += t.alpha * t.a(i / t.b.rows, j / t.b.cols) * t.b(i % t.b.rows, j % t.b.cols);
+        return v;
+    }
+
+    // +: The terms of both sums; logs an error and returns *this if the shapes differ.
+    Kronecker operator+(const Kronecker& other) const
+    {
+        if (SENKAID_UNLIKELY(!_terms.empty() && !other._terms.empty() && (rows() != other.rows() || cols() != other.cols())))
+        {
+            SENKAID_LOG_ERROR("Kronecker: summed products differ in shape");
+            return *this;
+        }
+        Kronecker out = *this;
+        out._terms.insert(out._terms.end(), other._terms.begin(), other._terms.end());
+        return out;
+    }
+
+    Kronecker operator*(TN c) const
+    {
+        Kronecker out = *this;
+        for (auto& t : out._terms)
+            t.alpha *= c;
+        return out;
+    }
+
+    friend Kronecker operator*(TN c, const Kronecker& k) { return k * c; }
+
+    // apply: y = alpha K x + beta y for a contiguous x of cols() and y of rows() elements. beta == 0
+    // ignores y's contents.
+    void apply(const TN* x, TN* y, TN alpha = TN(1), TN beta = TN(0)) const
+    {
+        apply_columns(x, y, 1, false, alpha, beta);
+    }
+
+    // apply: K x for every column of x (cols() rows), in x's layout. The columns go through the
+    // GEMMs together, in either layout, without copies. Logs an error and returns an empty matrix
+    // if the shapes do not match.
+    template <int Rows, int Cols, core::matrix::SDMajor Major>
+    core::matrix::SDDenseMatrix<-1, -1, TN, Major> apply(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& x) const
+    {
+        if (SENKAID_UNLIKELY(x.rows() != cols()))
+        {
+            SENKAID_LOG_ERROR("Kronecker: operand rows differ from the product's columns");
+            return {};
+        }
+
+        core::matrix::SDDenseMatrix<-1, -1, TN, Major> y(rows(), x.cols());
+        apply_columns(x.data(), y.data(), x.cols(), Major == core::matrix::SDMajor::RowMajor, TN(1), TN(0));
+        return y;
+    }
+
+    // materialize: The dense rows() x cols() matrix. Each output line is a run of scaled lines of
+    // b_t, one per entry of a_t in that line's block; b_t is copied into the output layout first if
+    // it is stored the other way.
+    template <core::matrix::SDMajor Major = core::matrix::SDMajor::RowMajor>
+    core::matrix::SDDenseMatrix<-1, -1, TN, Major> materialize() const
+    {
+        constexpr bool row_major = Major == core::matrix::SDMajor::RowMajor;
+
+        core::matrix::SDDenseMatrix<-1, -1, TN, Major> out(rows(), cols());
+        if (rows() == 0 || cols() == 0)
+            return out;
+        const std::size_t lines = row_major ? rows() : cols(), len = row_major ? cols() : rows();
+        TN* o = out.data();
+
+        for (std::size_t t = 0; t < _terms.size(); ++t)
+        {
+            const KroneckerTerm<TN>& term = _terms[t];
+            const std::size_t br = term.b.rows, bc = term.b.cols;
+
+            // b's lines along the output lines: rows of b (row-major output) or its columns.
+            const std::size_t blines = row_major ? br : bc, blen = row_major ? bc : br;
+            std::vector<TN> copy;
+            const TN* bl = term.b.data;
+            if (term.b.row_major != row_major)
+            {
+                copy.resize(br * bc);
+                for (std::size_t u = 0; u < blines; ++u)
+                    for (std::size_t v = 0; v < blen; ++v)
+                        copy[u * blen + v] = row_major ? term.b(u, v) : term.b(v, u);
+                bl = copy.data();
+            }
+
+            const std::size_t grain = std::max<std::size_t>(1, (std::size_t(1) << 16) / std::max<std::size_t>(len, 1));
+            backend::parallel::parallel_for(0, lines, grain, [&](std::size_t l0, std::size_t l1) {
+                for (std::size_t line = l0; line < l1; ++line)
+                {
+                    // Output line `line` is line (line % blines) of b, once per entry of a's line
+                    // (line / blines): a row of a for row-major output, a column otherwise.
+                    const std::size_t ai = line / blines;
+                    const TN* src = bl + (line % blines) * blen;
+                    TN* dst = o + line * len;
+                    for (std::size_t k = 0; k < len / blen; ++k)
+                    {
+                        const TN c = term.alpha * (row_major ? term.a(ai, k) : term.a(k, ai));
+                        if (t == 0)
+                            backend::cpu::scal_copy(c, src, dst + k * blen, blen);
+                        else
+                            backend::cpu::axpy(c, src, dst + k * blen, blen);
+                    }
+                }
+            });
+        }
+        return out;
+    }
+
+private:
+    // apply_columns: Y = alpha K X + beta Y, X cols() x n and Y rows() x n in one layout, unpadded.
+    void apply_columns(const TN* x, TN* y, std::size_t n, bool row_major, TN alpha, TN beta) const
+    {
+        if (_terms.empty())
+        {
+            for (std::size_t i = 0; i < rows() * n; ++i)
+                y[i] = beta == TN(0) ? TN(0) : beta * y[i];
+            return;
+        }
+        for (std::size_t t = 0; t < _terms.size(); ++t)
+            detail::apply_term(_terms[t], alpha, x, t == 0 ? beta : TN(1), y, n, row_major);
+    }
+
+    std::vector<KroneckerTerm<TN>> _terms;
+};
+
+// kron: Lazy a ⊗ b of two dense matrices of one element type; they must outlive the result.
+template <int RA, int CA, core::matrix::SDMajor MA, int RB, int CB, core::matrix::SDMajor MB, typename TN>
+Kronecker<TN> kron(const core::matrix::SDDenseMatrix<RA, CA, TN, MA>& a, const core::matrix::SDDenseMatrix<RB, CB, TN, MB>& b)
+{
+    return Kronecker<TN>(KroneckerTerm<TN>{TN(1), detail::factor_of(a), detail::factor_of(b)});
+}
+
+} // namespace senkaid::ops::linalg
@@ -0,0 +1,550 @@
+#pragma once
+
+// matmul.hpp: Dense matrix products with a fused epilogue.
+// matmul() runs the blocked GEMM of backend/cpu/matmul_cpu.hpp with the output split into column
+// chunks over the thread pool. An Epilogue describes what happens to each entry of
+// alpha * a * b + beta * c before it is stored:
+//   c = act(alpha * a * b + beta * c + bias) clamped to [lo, hi], + residual,
+// where every part is optional. It runs on each register tile of the output as soon as the tile
+// is final, while it is still in L1, so `act(a * b + bias) + residual` costs one pass over the
+// output instead of four. Operands and output may have any layout: a row-major output is computed
+// as its column-major transpose (c^T = b^T a^T), and neither operand is copied.
+//
+//   ops::linalg::Epilogue<float> ep;
+//   ep.bias = b1.data();                                  // one per output column
+//   ep.activation = ops::linalg::Activation::Gelu;
+//   ep.residual = x.data();                               // x: same shape and layout as the output
+//   auto h = ops::linalg::matmul(x, w1, ep);
+//
+// A weight used in many products can be packed once into the kernel's panel format, so the GEMM
+// only packs the other operand. With a small batch (down to a single row, a GEMV) packing the
+// weight is a large share of each product.
+//
+//   auto pw = ops::linalg::pack(w1);                      // for x * w1, output in w1's layout
+//   auto h = ops::linalg::matmul(x, pw, ep);
+//   if (!pw.matches(w1)) pw.repack(w1);                   // w1 reallocated or reshaped
+
+#include <senkaid/utils/config/root.hpp>
+#include <senkaid/utils/debug/root.hpp>
+#include <senkaid/utils/memory/utils.hpp>
+#include <senkaid/core/allocator/alignment.hpp>
+#include <senkaid/core/layout/layout_hash.hpp>
+#include <senkaid/core/matrix/dense.hpp>
+#include <senkaid/backend/simd/simd_common.hpp>
+#include <senkaid/backend/cpu/matmul_cpu.hpp>
+#include <senkaid/backend/cpu/transform_cpu.hpp>
+#include <senkaid/backend/parallel/parallel_for.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace senkaid::ops::linalg
+{
+
+using Op = backend::cpu::Op;
+using Side = backend::cpu::Side;
+
+// Activation: Point-wise function applied after the bias.
+enum class Activation : uint8_t
+{
+    None = 0x00,
+    Relu = 0x01,
+    Gelu = 0x02,        // Exact (erf) form, backend::cpu::Gelu.
+    Tanh = 0x03
+};
+
+// BiasAxis: How the bias vector is broadcast over the output.
+enum class BiasAxis : uint8_t
+{
+    PerColumn = 0x01,   // c(i, j) += bias[j]; the usual layer bias, one per output feature.
+    PerRow = 0x02       // c(i, j) += bias[i].
+};
+
+// Epilogue: Scaling and point-wise work fused into matmul(); the defaults give c = a * b.
+// bias and residual are non-owning and must outlive the call; residual has the output's shape
+// and layout and must not be the output (use beta for that).
+template <typename TN>
+struct Epilogue
+{
+    TN alpha = TN(1);
+    TN beta = TN(0);                                        // Scale of the existing output; 0 ignores it.
+    const TN* bias = nullptr;
+    BiasAxis bias_axis = BiasAxis::PerColumn;
+    Activation activation = Activation::None;
+    bool clamp = false;                                     // Clamp to [lo, hi] after the activation.
+    TN lo = std::numeric_limits<TN>::lowest();
+    TN hi = std::numeric_limits<TN>::max();
+    const TN* residual = nullptr;
+};
+
+namespace detail
+{
+
+// TileEpilogue: An Epilogue as a gemm() epilogue on column-major storage. The bias runs along
+// gemm rows (bias_rows) or columns; residual has the output's leading dimension.
+template <typename TN>
+struct TileEpilogue
+{
+    const TN* bias = nullptr;
+    bool bias_rows = false;
+    Activation activation = Activation::None;
+    bool clamp = false;
+    TN lo{}, hi{};
+    const TN* residual = nullptr;
+    std::size_t ldr = 0;
+
+    SENKAID_FORCE_INLINE void operator()(TN* c, std::size_t i, std::size_t j, std::size_t len) const noexcept
+    {
+        using P = backend::simd::pack<TN>;
+        constexpr std::size_t L = P::lanes;
+
+        const TN* r = residual != nullptr ? residual + i + j * ldr : nullptr;
+        for (std::size_t k = 0; k < len; k += L)
+        {
+            const bool full = k + L <= len;
+            const auto m = P::mask_type::first_n(len - k);
+            const auto load = [&](const TN* p) { return full ? P::loadu(p) : P::load(p, m); };
+
+            P v = load(c + k);
+            if (bias != nullptr)
+                v = v + (bias_rows ? load(bias + i + k) : P(bias[j]));
+            switch (activation)
+            {
+                case Activation::Relu: v = max(v, P(TN(0))); break;
+                case Activation::Gelu: v = backend::cpu::Gelu{}(v); break;
+                case Activation::Tanh: v = backend::cpu::Tanh{}(v); break;
+                default: break;
+            }
+            if (clamp)
+                v = min(max(v, P(lo)), P(hi));
+            if (r != nullptr)
+                v = v + load(r + k);
+            if (full)
+                v.storeu(c + k);
+            else
+                v.store(c + k, m);
+        }
+    }
+
+    // columns_from: The same epilogue for the output columns from j0 on.
+    TileEpilogue columns_from(std::size_t j0) const noexcept
+    {
+        TileEpilogue out = *this;
+        if (bias != nullptr && !bias_rows)
+            out.bias += j0;
+        if (residual != nullptr)
+            out.residual += j0 * ldr;
+        return out;
+    }
+};
+
+// for_column_chunks: Calls fn(j0, j1) over the n columns of an m x n x k product in chunks of
+// whole register tiles, over the thread pool.
+template <typename TN, typename Fn>
+void for_column_chunks(std::size_t m, std::size_t n, std::size_t k, Fn&& fn)
+{
+    constexpr std::size_t NR = backend::cpu::detail::GemmBlocking<TN>::NR;
+    constexpr std::size_t work = std::size_t(1) << 21;
+
+    const std::size_t grain = (std::max<std::size_t>(1, work / std::max<std::size_t>(1, m * k)) + NR - 1) / NR * NR;
+    backend::parallel::parallel_for(0, n, grain, fn);
+}
+
+// chunk_epilogue: The epilogue for the output columns from j0 on.
+template <typename Ep>
+SENKAID_FORCE_INLINE Ep chunk_epilogue(const Ep& epilogue, std::size_t j0) noexcept
+{
+    if constexpr (std::is_same_v<Ep, backend::cpu::NoEpilogue>)
+        return epilogue;
+    else
+        return epilogue.columns_from(j0);
+}
+
+// gemm_columns: Column-major gemm() with the n columns of C cut into chunks over the thread pool.
+template <typename TN, typename Ep = backend::cpu::NoEpilogue>
+void gemm_columns(Op opa, Op opb, std::size_t m, std::size_t n, std::size_t k, TN alpha, const TN* a, std::size_t lda, const TN* b,
+                  std::size_t ldb, TN beta, TN* c, std::size_t ldc, const Ep& epilogue = Ep{})
+{
+    for_column_chunks<TN>(m, n, k, [&](std::size_t j0, std::size_t j1) {
+        const TN* bj = opb == Op::NoTrans ? b + j0 * ldb : b + j0;
+        backend::cpu::gemm(opa, opb, m, j1 - j0, k, alpha, a, lda, bj, ldb, beta, c + j0 * ldc, ldc, chunk_epilogue(epilogue, j0));
+    });
+}
+
+// gemm_columns_packed: gemm_columns() with A (Side::Left) or B (Side::Right) taken from packed panels;
+// x, ldx and opx describe the other operand.
+template <typename TN, typename Ep = backend::cpu::NoEpilogue>
+void gemm_columns_packed(Side side, Op opx, std::size_t m, std::size_t n, std::size_t k, TN alpha, backend::cpu::GemmPanels<TN> panels,
+                         const TN* x, std::size_t ldx, TN beta, TN* c, std::size_t ldc, const Ep& epilogue = Ep{})
+{
+    for_column_chunks<TN>(m, n, k, [&](std::size_t j0, std::size_t j1) {
+        backend::cpu::GemmPanels<TN> p = panels;
+        const TN* xj = x;
+        if (side == Side::Right)
+            p.first += j0;
+        else
+            xj = opx == Op::NoTrans ? x + j0 * ldx : x + j0;
+        backend::cpu::gemm_packed(side, opx, m, j1 - j0, k, alpha, p, xj, ldx, beta, c + j0 * ldc, ldc, chunk_epilogue(epilogue, j0));
+    });
+}
+
+// with_epilogue: Calls run(e) with e the gemm() epilogue for ep on a column-major output with leading
+// dimension ldc (backend::cpu::NoEpilogue if ep has no point-wise part). cm: the product's output is
+// column-major, so ep's rows are gemm rows.
+template <typename TN, typename Run>
+void with_epilogue(const Epilogue<TN>& ep, bool cm, std::size_t ldc, Run&& run)
+{
+    if (ep.bias == nullptr && ep.activation == Activation::None && !ep.clamp && ep.residual == nullptr)
+    {
+        run(backend::cpu::NoEpilogue{});
+        return;
+    }
+
+    if constexpr (std::is_floating_point_v<TN>)
+    {
+        TileEpilogue<TN> tile;
+        tile.bias = ep.bias;
+        tile.bias_rows = (ep.bias_axis == BiasAxis::PerRow) == cm;
+        tile.activation = ep.activation;
+        tile.clamp = ep.clamp;
+        tile.lo = ep.lo;
+        tile.hi = ep.hi;
+        tile.residual = ep.residual;
+        tile.ldr = ldc;
+        run(tile);
+    }
+    else
+        SENKAID_LOG_ERROR("matmul: bias, activation and residual epilogues need a floating-point element type");
+}
+
+// operand: Storage of x (its transpose if row-major) as the column-major gemm() operand for x, or
+// for x^T if `transposed`.
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+SENKAID_FORCE_INLINE std::pair<Op, std::size_t> operand(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& x,
+                                                                     bool transposed) noexcept
+{
+    constexpr bool row_major = Major == core::matrix::SDMajor::RowMajor;
+    return {row_major == transposed ? Op::NoTrans : Op::Trans,
+            std::max<std::size_t>(1, row_major ? x.cols() : x.rows())};
+}
+
+// matmul_into: c = the epilogue of a * b; c already has the product's shape.
+template <int RA, int CA, int RB, int CB, int RC, int CC, typename TN, core::matrix::SDMajor MA, core::matrix::SDMajor MB,
+          core::matrix::SDMajor MC>
+void matmul_into(const core::matrix::SDDenseMatrix<RA, CA, TN, MA>& a, const core::matrix::SDDenseMatrix<RB, CB, TN, MB>& b,
+                 core::matrix::SDDenseMatrix<RC, CC, TN, MC>& c, const Epilogue<TN>& ep)
+{
+    // A row-major c is stored as c^T = b^T a^T: gemm rows are c's columns.
+    constexpr bool cm = MC == core::matrix::SDMajor::ColumnMajor;
+    const std::size_t m = cm ? a.rows() : b.cols(), n = cm ? b.cols() : a.rows(), k = a.cols();
+    const auto [opx, ldx] = cm ? operand(a, false) : operand(b, true);
+    const auto [opy, ldy] = cm ? operand(b, false) : operand(a, true);
+    const TN* x = cm ? a.data() : b.data();
+    const TN* y = cm ? b.data() : a.data();
+    const std::size_t ldc = std::max<std::size_t>(1, m);
+
+    with_epilogue(ep, cm, ldc, [&](const auto& tile) { gemm_columns(opx, opy, m, n, k, ep.alpha, x, ldx, y, ldy, ep.beta, c.data(), ldc, tile); });
+}
+
+} // namespace detail
+
+// matmul: c = the epilogue of a * b (by default c = a * b). With ep.beta == 0 a dynamic c of another
+// shape is resized first; otherwise c must already be a.rows() x b.cols(). Logs an error and leaves
+// c unchanged if the shapes do not fit.
+template <int RA, int CA, int RB, int CB, int RC, int CC, typename TN, core::matrix::SDMajor MA, core::matrix::SDMajor MB,
+          core::matrix::SDMajor MC>
+void matmul(const core::matrix::SDDenseMatrix<RA, CA, TN, MA>& a, const core::matrix::SDDenseMatrix<RB, CB, TN, MB>& b,
+            core::matrix::SDDenseMatrix<RC, CC, TN, MC>& c, const Epilogue<TN>& ep = {})
+{
+    if (SENKAID_UNLIKELY(a.cols() != b.rows()))
+    {
+        SENKAID_LOG_ERROR("matmul: inner dimensions differ");
+        return;
+    }
+    if (c.rows() != a.rows() || c.cols() != b.cols())
+    {
+        if (SENKAID_UNLIKELY(ep.beta != TN(0)))
+        {
+            SENKAID_LOG_ERROR("matmul: output shape differs from the product's and beta is not zero");
+            return;
+        }
+        c = core::matrix::SDDenseMatrix<RC, CC, TN, MC>(a.rows(), b.cols());
+    }
+    detail::matmul_into(a, b, c, ep);
+}
+
+// matmul: The epilogue of a * b as a new matrix in a's layout (ep.beta is ignored); an empty matrix
+// if the inner dimensions differ.
+template <int RA, int CA, int RB, int CB, typename TN, core::matrix::SDMajor MA, core::matrix::SDMajor MB>
+core::matrix::SDDenseMatrix<-1, -1, TN, MA> matmul(const core::matrix::SDDenseMatrix<RA, CA, TN, MA>& a,
+                                                   const core::matrix::SDDenseMatrix<RB, CB, TN, MB>& b, Epilogue<TN> ep = {})
+{
+    if (SENKAID_UNLIKELY(a.cols() != b.rows()))
+    {
+        SENKAID_LOG_ERROR("matmul: inner dimensions differ");
+        return {};
+    }
+    core::matrix::SDDenseMatrix<-1, -1, TN, MA> c(a.rows(), b.cols());
+    ep.beta = TN(0);
+    detail::matmul_into(a, b, c, ep);
+    return c;
+}
+
+// PackedMatrix: A matrix w packed once into the panel format of the GEMM kernel, for repeated
+// products x * w (Side::Right) or w * x (Side::Left) whose output is in Major layout (which side of
+// the kernel w feeds depends on both). The pack is a copy: it remembers w's address and layout hash
+// so matches() can tell a reallocated or reshaped w, but not new contents; repack() after writing
+// to w. Panels packed for another kernel configuration are refused by matmul() (current()).
+template <typename TN, core::matrix::SDMajor Major = core::matrix::SDMajor::RowMajor>
+class PackedMatrix
+{
+public:
+    using value_type = TN;
+    using size_type = std::size_t;
+
+    static constexpr core::matrix::SDMajor major = Major;
+
+    PackedMatrix() = default;
+
+    template <int Rows, int Cols, core::matrix::SDMajor M>
+    explicit PackedMatrix(const core::matrix::SDDenseMatrix<Rows, Cols, TN, M>& w, Side side = Side::Right) : _side(side)
+    {
+        repack(w);
+    }
+
+    PackedMatrix(const PackedMatrix& other)
+        : _rows(other._rows), _cols(other._cols), _extent(other._extent), _size(other._size), _side(other._side),
+          _source(other._source), _layout(other._layout), _key(other._key)
+    {
+        _data = allocate(_size);
+        _capacity = _size;
+        if (_data)
+            memory::copy_elements(_data, other._data, _size);
+    }
+
+    PackedMatrix(PackedMatrix&& other) noexcept
+        : _data(std::exchange(other._data, nullptr)), _capacity(std::exchange(other._capacity, 0)), _rows(other._rows),
+          _cols(other._cols), _extent(other._extent), _size(std::exchange(other._size, 0)), _side(other._side),
+          _source(std::exchange(other._source, nullptr)), _layout(other._layout), _key(std::exchange(other._key, 0))
+    {
+    }
+
+    PackedMatrix& operator=(PackedMatrix other) noexcept
+    {
+        std::swap(_data, other._data);
+        std::swap(_capacity, other._capacity);
+        std::swap(_rows, other._rows);
+        std::swap(_cols, other._cols);
+        std::swap(_extent, other._extent);
+        std::swap(_size, other._size);
+        std::swap(_side, other._side);
+        std::swap(_source, other._source);
+        std::swap(_layout, other._layout);
+        std::swap(_key, other._key);
+        return *this;
+    }
+
+    ~PackedMatrix()
+    {
+        core::allocator::aligned_free(_data);
+    }
+
+    // repack: Packs w (of any shape) for the same side, reusing the buffer if it is large enough.
+    template <int Rows, int Cols, core::matrix::SDMajor M>
+    void repack(const core::matrix::SDDenseMatrix<Rows, Cols, TN, M>& w)
+    {
+        // A row-major output is computed as its transpose, which swaps the operands and reads w^T.
+        constexpr bool transposed = Major == core::matrix::SDMajor::RowMajor;
+        const Side role = gemm_side(_side);
+        const size_type tr = transposed ? w.cols() : w.rows(), tc = transposed ? w.rows() : w.cols();
+        const size_type extent = role == Side::Left ? tr : tc, depth = role == Side::Left ? tc : tr;
+        const size_type size = backend::cpu::panels_size<TN>(role, extent, depth);
+
+        if (size > _capacity)
+        {
+            TN* data = allocate(size);
+            core::allocator::aligned_free(_data);
+            _data = data;
+            _capacity = size;
+        }
+        const auto [op, ld] = detail::operand(w, transposed);
+        if (size > 0)
+            backend::cpu::pack_panels(role, op, extent, depth, w.data(), ld, _data);
+
+        _rows = w.rows();
+        _cols = w.cols();
+        _extent = backend::cpu::panels_size<TN>(role, extent, 1);
+        _size = size;
+        _source = w.data();
+        _layout = core::layout::layout_hash(w);
+        _key = backend::cpu::gemm_kernel_key<TN>();
+    }
+
+    // matches: Whether w is, by address and layout, the matrix last packed.
+    template <int Rows, int Cols, core::matrix::SDMajor M>
+    SENKAID_FORCE_INLINE bool matches(const core::matrix::SDDenseMatrix<Rows, Cols, TN, M>& w) const noexcept
+    {
+        return _key != 0 && w.data() == _source && core::layout::layout_hash(w) == _layout;
+    }
+
+    // current: Whether the panels were packed for this build's GEMM kernel (false if never packed).
+    SENKAID_FORCE_INLINE bool current() const noexcept { return _key == backend::cpu::gemm_kernel_key<TN>(); }
+
+    SENKAID_FORCE_INLINE size_type rows() const noexcept { return _rows; }
+    SENKAID_FORCE_INLINE size_type cols() const noexcept { return _cols; }
+    SENKAID_FORCE_INLINE Side side() const noexcept { return _side; }
+
+    // gemm_side: The gemm() operand the pack stands for: A (Side::Left) or B (Side::Right).
+    SENKAID_FORCE_INLINE Side gemm_side() const noexcept { return gemm_side(_side); }
+
+    // panels: The packed operand as backend::cpu::gemm_packed() takes it.
+    SENKAID_FORCE_INLINE backend::cpu::GemmPanels<TN> panels() const noexcept { return {_data, _extent, 0}; }
+
+private:
+    static constexpr Side gemm_side(Side side) noexcept
+    {
+        return (side == Side::Left) == (Major == core::matrix::SDMajor::ColumnMajor) ? Side::Left : Side::Right;
+    }
+
+    static TN* allocate(size_type size)
+    {
+        if (size == 0)
+            return nullptr;
+
+        TN* data = static_cast<TN*>(core::allocator::aligned_malloc(size * sizeof(TN), SENKAID_DEFAULT_ALIGNMENT));
+        if (SENKAID_UNLIKELY(data == nullptr))
+            throw std::bad_alloc();
+        return data;
+    }
+
+    TN* _data = nullptr;
+    size_type _capacity = 0;
+    size_type _rows = 0;
+    size_type _cols = 0;
+    size_type _extent = 0;
+    size_type _size = 0;
+    Side _side = Side::Right;
+    const TN* _source = nullptr;
+    std::uint64_t _layout = 0;
+    std::uint64_t _key = 0;
+};
+
+// pack: w packed for products with it on `side`, output in w's layout.
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+PackedMatrix<TN, Major> pack(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& w, Side side = Side::Right)
+{
+    return PackedMatrix<TN, Major>(w, side);
+}
+
+namespace detail
+{
+
+// packed_fits: Whether w is current and fits x on the side it was packed for; logs the reason if not.
+template <int RX, int CX, typename TN, core::matrix::SDMajor MX, core::matrix::SDMajor Major>
+bool packed_fits(const core::matrix::SDDenseMatrix<RX, CX, TN, MX>& x, const PackedMatrix<TN, Major>& w, Side side)
+{
+    if (SENKAID_UNLIKELY(w.side() != side))
+    {
+        SENKAID_LOG_ERROR("matmul: packed matrix was packed for the other side of the product");
+        return false;
+    }
+    if (SENKAID_UNLIKELY(!w.current()))
+    {
+        SENKAID_LOG_ERROR("matmul: packed matrix is empty or was packed for another kernel");
+        return false;
+    }
+    if (SENKAID_UNLIKELY(side == Side::Right ? x.cols() != w.rows() : w.cols() != x.rows()))
+    {
+        SENKAID_LOG_ERROR("matmul: inner dimensions differ");
+        return false;
+    }
+    return true;
+}
+
+// matmul_packed_into: c = the epilogue of x * w (w.side() is Right) or w * x (Left); w fits and c
+// already has the product's shape.
+template <int RX, int CX, int RC, int CC, typename TN, core::matrix::SDMajor MX, core::matrix::SDMajor Major>
+void matmul_packed_into(const core::matrix::SDDenseMatrix<RX, CX, TN, MX>& x, const PackedMatrix<TN, Major>& w,
+                        core::matrix::SDDenseMatrix<RC, CC, TN, Major>& c, const Epilogue<TN>& ep)
+{
+    // As in matmul_into(): a row-major c is computed as c^T, x then enters as x^T on the other side.
+    constexpr bool cm = Major == core::matrix::SDMajor::ColumnMajor;
+    const bool right = w.side() == Side::Right;
+    const std::size_t m = cm ? c.rows() : c.cols(), n = cm ? c.cols() : c.rows(), k = right ? x.cols() : x.rows();
+    const auto [opx, ldx] = operand(x, !cm);
+    const std::size_t ldc = std::max<std::size_t>(1, m);
+
+    with_epilogue(ep, cm, ldc, [&](const auto& tile) {
+        gemm_columns_packed(w.gemm_side(), opx, m, n, k, ep.alpha, w.panels(), x.data(), ldx, ep.beta, c.data(), ldc, tile);
+    });
+}
+
+// matmul_packed: matmul() with w packed for `side`: c resized as there, or left unchanged after logging.
+template <int RX, int CX, int RC, int CC, typename TN, core::matrix::SDMajor MX, core::matrix::SDMajor Major>
+void matmul_packed(const core::matrix::SDDenseMatrix<RX, CX, TN, MX>& x, const PackedMatrix<TN, Major>& w, Side side,
+                   core::matrix::SDDenseMatrix<RC, CC, TN, Major>& c, const Epilogue<TN>& ep)
+{
+    if (!packed_fits(x, w, side))
+        return;
+    const std::size_t rows = side == Side::Right ? x.rows() : w.rows(), cols = side == Side::Right ? w.cols() : x.cols();
+    if (c.rows() != rows || c.cols() != cols)
+    {
+        if (SENKAID_UNLIKELY(ep.beta != TN(0)))
+        {
+            SENKAID_LOG_ERROR("matmul: output shape differs from the product's and beta is not zero");
+            return;
+        }
+        c = core::matrix::SDDenseMatrix<RC, CC, TN, Major>(rows, cols);
+    }
+    matmul_packed_into(x, w, c, ep);
+}
+
+} // namespace detail
+
+// matmul: c = the epilogue of x * w, w packed for Side::Right, c in the layout w was packed for;
+// otherwise as matmul(a, b, c, ep). Logs an error and leaves c unchanged if w was packed for the
+// left side or another kernel, or the shapes do not fit.
+template <int RX, int CX, int RC, int CC, typename TN, core::matrix::SDMajor MX, core::matrix::SDMajor Major>
+void matmul(const core::matrix::SDDenseMatrix<RX, CX, TN, MX>& x, const PackedMatrix<TN, Major>& w,
+            core::matrix::SDDenseMatrix<RC, CC, TN, Major>& c, const Epilogue<TN>& ep = {})
+{
+    detail::matmul_packed(x, w, Side::Right, c, ep);
+}
+
+// matmul: c = the epilogue of w * x, w packed for Side::Left; as above.
+template <int RX, int CX, int RC, int CC, typename TN, core::matrix::SDMajor MX, core::matrix::SDMajor Major>
+void matmul(const PackedMatrix<TN, Major>& w, const core::matrix::SDDenseMatrix<RX, CX, TN, MX>& x,
+            core::matrix::SDDenseMatrix<RC, CC, TN, Major>& c, const Epilogue<TN>& ep = {})
+{
+    detail::matmul_packed(x, w, Side::Left, c, ep);
+}
+
+// matmul: The epilogue of x * w as a new matrix in the layout w was packed for (ep.beta is ignored);
+// an empty matrix if w does not fit.
+template <int RX, int CX, typename TN, core::matrix::SDMajor MX, core::matrix::SDMajor Major>
+core::matrix::SDDenseMatrix<-1, -1, TN, Major> matmul(const core::matrix::SDDenseMatrix<RX, CX, TN, MX>& x, const PackedMatrix<TN, Major>& w,
+                                                      Epilogue<TN> ep = {})
+{
+    core::matrix::SDDenseMatrix<-1, -1, TN, Major> c;
+    ep.beta = TN(0);
+    detail::matmul_packed(x, w, Side::Right, c, ep);
+    return c;
+}
+
+// matmul: The epilogue of w * x as a new matrix; as above.
+template <int RX, int CX, typename TN, core::matrix::SDMajor MX, core::matrix::SDMajor Major>
+core::matrix::SDDenseMatrix<-1, -1, TN, Major> matmul(const PackedMatrix<TN, Major>& w, const core::matrix::SDDenseMatrix<RX, CX, TN, MX>& x,
+                                                      Epilogue<TN> ep = {})
+{
+    core::matrix::SDDenseMatrix<-1, -1, TN, Major> c;
+    ep.beta = TN(0);
+    detail::matmul_packed(x, w, Side::Left, c, ep);
+    return c;
+}
+
+} // namespace senkaid::ops::linalg
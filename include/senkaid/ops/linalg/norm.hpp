@@ -0,0 +1,122 @@
+#pragma once
+
+// norm.hpp: Matrix norms of dense matrices.
+// Frobenius and Max reduce the storage as one vector (backend/cpu/reduce_cpu.hpp). One (largest
+// column sum of |a(i, j)|) and Inf (largest row sum) depend on the layout: the sums along contiguous
+// lines are plain vector reductions, one per line, spread over the pool by lines; the sums across
+// lines accumulate a row of partial sums per tile of at most norm_tile_width columns, so the
+// partials stay in L1 while the matrix streams through once. Tiles have a fixed shape and their
+// partials are added in order, so results do not depend on the thread count.
+//
+//   double a1 = ops::linalg::norm(a, ops::linalg::MatrixNorm::One);
+
+#include <senkaid/utils/config/root.hpp>
+#include <senkaid/core/matrix/dense.hpp>
+#include <senkaid/backend/simd/simd_reduction.hpp>
+#include <senkaid/backend/cpu/reduce_cpu.hpp>
+#include <senkaid/backend/parallel/parallel_for.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace senkaid::ops::linalg
+{
+
+// MatrixNorm: Which matrix norm norm() computes.
+enum class MatrixNorm : uint8_t
+{
+    Frobenius = 0x01,   // sqrt of the sum of |a(i, j)|^2.
+    One = 0x02,         // Largest column sum of |a(i, j)|.
+    Inf = 0x03,         // Largest row sum of |a(i, j)|.
+    Max = 0x04          // Largest |a(i, j)| (not submultiplicative).
+};
+
+// norm_tile_width: Columns of partial sums one tile keeps while summing across lines.
+inline constexpr std::size_t norm_tile_width = 1024;
+
+namespace detail
+{
+
+// line_sums_max: max over the `lines` contiguous lines of length len of sum |x|.
+template <typename TN>
+TN line_sums_max(const TN* x, std::size_t lines, std::size_t len)
+{
+    std::vector<TN> sums(lines);
+    const std::size_t grain = std::max<std::size_t>(1, backend::cpu::reduce_grain / std::max<std::size_t>(len, 1));
+    backend::parallel::parallel_for(0, lines, grain, [&](std::size_t lo, std::size_t hi) {
+        for (std::size_t i = lo; i < hi; ++i)
+            sums[i] = backend::simd::abs_sum_partial(x + i * len, len).value();
+    });
+    return backend::cpu::max(sums.data(), lines);
+}
+
+// cross_sums_max: max over j < len of sum over the lines i of |x[i * len + j]|.
+template <typename TN>
+TN cross_sums_max(const TN* x, std::size_t lines, std::size_t len)
+{
+    namespace simd = backend::simd;
+
+    const std::size_t width = std::min(len, norm_tile_width);
+    const std::size_t depth = std::max<std::size_t>(1, backend::cpu::reduce_grain / width);
+    const std::size_t bands = (lines + depth - 1) / depth;
+    const std::size_t slices = (len + width - 1) / width;
+
+    // partial[b * len + j]: sum of |x(i, j)| over the lines of band b.
+    std::vector<TN> partial(bands * len, TN(0));
+    backend::parallel::parallel_for(0, bands * slices, 1, [&](std::size_t t0, std::size_t t1) {
+        for (std::size_t t = t0; t < t1; ++t)
+        {
+            const std::size_t b = t / slices, j0 = (t % slices) * width;
+            const std::size_t j1 = std::min(j0 + width, len);
+            TN* acc = partial.data() + b * len;
+            for (std::size_t i = b * depth; i < std::min(lines, (b + 1) * depth); ++i)
+            {
+                const TN* line = x + i * len;
+                simd::for_each_pack<TN>(j0, j1, [&](std::size_t j, auto io) {
+                    io.store(acc + j, io.load(acc + j) + abs(io.load(line + j)));
+                });
+            }
+        }
+    });
+
+    for (std::size_t b = 1; b < bands; ++b)
+        simd::for_each_pack<TN>(0, len, [&](std::size_t j, auto io) {
+            io.store(partial.data() + j, io.load(partial.data() + j) + io.load(partial.data() + b * len + j));
+        });
+    return backend::cpu::max(partial.data(), len);
+}
+
+} // namespace detail
+
+// norm: The `kind` norm of a (default Frobenius); 0 for an empty matrix, NaN if any entry is NaN.
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+TN norm(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a, MatrixNorm kind = MatrixNorm::Frobenius)
+{
+    static_assert(std::is_floating_point_v<TN>, "norm: floating-point element types only");
+
+    if (a.size() == 0)
+        return TN(0);
+
+    // Lines are the contiguous rows (RowMajor) or columns (ColumnMajor) of the storage.
+    constexpr bool row_major = Major == core::matrix::SDMajor::RowMajor;
+    const std::size_t lines = row_major ? a.rows() : a.cols();
+    const std::size_t len = row_major ? a.cols() : a.rows();
+
+    switch (kind)
+    {
+    case MatrixNorm::One:
+        return row_major ? detail::cross_sums_max(a.data(), lines, len) : detail::line_sums_max(a.data(), lines, len);
+    case MatrixNorm::Inf:
+        return row_major ? detail::line_sums_max(a.data(), lines, len) : detail::cross_sums_max(a.data(), lines, len);
+    case MatrixNorm::Max:
+        return backend::cpu::amax(a.data(), a.size());
+    case MatrixNorm::Frobenius:
+    default:
+        return backend::cpu::nrm2(a.data(), a.size());
+    }
+}
+
+} // namespace senkaid::ops::linalg
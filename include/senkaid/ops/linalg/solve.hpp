@@ -0,0 +1,93 @@
+#pragma once
+
+// solve.hpp: Dense linear systems A X = B with one or many right-hand sides.
+// solve() factors A once with the tiled LU of engine/decompose/lu.hpp and finishes with two
+// blocked triangular solves (triangular.hpp), which run as GEMM updates split over the
+// right-hand sides; solve_triangular() is the second half alone, for A already triangular.
+// X comes back in B's shape and layout.
+//
+//   auto x = ops::linalg::solve(a, b);                                       // b: n x nrhs
+//   auto y = ops::linalg::solve_triangular(r, b, ops::linalg::Uplo::Upper);
+
+#include <senkaid/utils/config/root.hpp>
+#include <senkaid/utils/debug/root.hpp>
+#include <senkaid/core/matrix/dense.hpp>
+#include <senkaid/utils/memory/utils.hpp>
+#include <senkaid/engine/decompose/lu.hpp>
+#include "transpose.hpp"
+#include "triangular.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace senkaid::ops::linalg
+{
+
+namespace detail
+{
+
+// column_major_copy: The entries of a in column-major order.
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+std::vector<TN> column_major_copy(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a)
+{
+    std::vector<TN> out(a.size());
+    if constexpr (Major == core::matrix::SDMajor::RowMajor)
+        transpose(a.data(), a.rows(), a.cols(), a.cols(), out.data(), a.rows());
+    else
+        memory::copy_elements(out.data(), a.data(), a.size());
+    return out;
+}
+
+} // namespace detail
+
+// solve_triangular: X with op(a) X = b, a square and triangular as `uplo` (its diagonal not read if
+// diag is Unit). Logs an error and returns an empty matrix if the shapes do not fit.
+template <int RA, int CA, int RB, int CB, typename TN, core::matrix::SDMajor MA, core::matrix::SDMajor MB>
+core::matrix::SDDenseMatrix<-1, -1, TN, MB> solve_triangular(const core::matrix::SDDenseMatrix<RA, CA, TN, MA>& a,
+                                                             const core::matrix::SDDenseMatrix<RB, CB, TN, MB>& b, Uplo uplo,
+                                                             Op op = Op::NoTrans, Diag diag = Diag::NonUnit)
+{
+    core::matrix::SDDenseMatrix<-1, -1, TN, MB> x(b.rows(), b.cols());
+    memory::copy_elements(x.data(), b.data(), b.size());
+    if (!detail::tri_dense<true>(a, x, Side::Left, uplo, op, diag, TN(1)))
+        return {};
+    return x;
+}
+
+// solve: X with a X = b for a square, through LU with partial pivoting. Logs an error and returns
+// an empty matrix if the shapes do not fit or a is exactly singular.
+template <int RA, int CA, int RB, int CB, typename TN, core::matrix::SDMajor MA, core::matrix::SDMajor MB>
+core::matrix::SDDenseMatrix<-1, -1, TN, MB> solve(const core::matrix::SDDenseMatrix<RA, CA, TN, MA>& a,
+                                                  const core::matrix::SDDenseMatrix<RB, CB, TN, MB>& b)
+{
+    const std::size_t n = a.rows(), nrhs = b.cols();
+    if (SENKAID_UNLIKELY(a.cols() != n || b.rows() != n))
+    {
+        SENKAID_LOG_ERROR("solve: matrix is not square or does not fit the right-hand side");
+        return {};
+    }
+
+    std::vector<TN> lu = detail::column_major_copy(a);
+    std::vector<std::size_t> ipiv(n);
+    if (n > 0 && SENKAID_UNLIKELY(engine::decompose::lu(lu.data(), n, n, n, ipiv.data()) != 0))
+    {
+        SENKAID_LOG_ERROR("solve: matrix is singular");
+        return {};
+    }
+
+    std::vector<TN> x = detail::column_major_copy(b);
+    const std::size_t ld = std::max<std::size_t>(1, n);
+    engine::decompose::kernels::laswp(nrhs, x.data(), ld, 0, n, ipiv.data());
+    detail::tri_apply<true>(Side::Left, Uplo::Lower, Op::NoTrans, Diag::Unit, n, nrhs, TN(1), lu.data(), ld, x.data(), ld);
+    detail::tri_apply<true>(Side::Left, Uplo::Upper, Op::NoTrans, Diag::NonUnit, n, nrhs, TN(1), lu.data(), ld, x.data(), ld);
+
+    core::matrix::SDDenseMatrix<-1, -1, TN, MB> out(n, nrhs);
+    if constexpr (MB == core::matrix::SDMajor::RowMajor)
+        transpose(x.data(), nrhs, n, ld, out.data(), std::max<std::size_t>(1, nrhs));
+    else
+        memory::copy_elements(out.data(), x.data(), x.size());
+    return out;
+}
+
+} // namespace senkaid::ops::linalg
@@ -0,0 +1,188 @@
+#pragma once
+
+// transpose.hpp: Out-of-place dense transpose.
+// The raw kernel works on "line-major" buffers: element (i, j) of the rows x cols source is
+// src[i * lds + j] and lands in dst[j * ldd + i]. For a row-major matrix that is the usual
+// transpose; for a column-major one, pass (cols, rows) and the column stride.
+//
+// The index space is split recursively along the longer side until a tile fits in L1
+// (cache-oblivious, so every cache level sees tiles of its own size), and leaf tiles are
+// finished with the in-register block transposes of backend/simd/simd_transpose.hpp.
+// Large transposes write dst with non-temporal stores so the output does not evict the
+// source from cache, and the top level is spread over the thread pool in row stripes.
+
+#include <senkaid/utils/config/root.hpp>
+#include <senkaid/utils/debug/root.hpp>
+#include <senkaid/core/matrix/dense.hpp>
+#include <senkaid/backend/simd/simd_transpose.hpp>
+#include <senkaid/backend/parallel/parallel_for.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+namespace senkaid::ops::linalg
+{
+
+// TransposeStore: How the destination is written.
+enum class TransposeStore : uint8_t
+{
+    Auto = 0x01,        // Streaming once the output exceeds transpose_stream_bytes and dst is aligned.
+    Cached = 0x02,      // Ordinary stores.
+    Stream = 0x03       // Non-temporal stores wherever dst alignment allows.
+};
+
+// TransposeOptions: Execution controls for transpose().
+struct TransposeOptions
+{
+    TransposeStore store = TransposeStore::Auto;
+    bool parallel = true;                                   // false keeps all work on the calling thread.
+    backend::parallel::ThreadPool* pool = nullptr;          // nullptr uses ThreadPool::instance().
+};
+
+// transpose_tile_bytes: Leaf tile footprint; source and destination tiles together stay in L1.
+inline constexpr std::size_t transpose_tile_bytes = 16 * 1024;
+
+// transpose_stream_bytes: Output size from which Auto switches to non-temporal stores
+// (beyond this the destination would not survive in the last-level cache anyway).
+inline constexpr std::size_t transpose_stream_bytes = 8 * 1024 * 1024;
+
+namespace detail
+{
+
+// Leaf: whole blocks through the SIMD kernel, ragged right/bottom edges element by element.
+// Block offsets are multiples of the block edge, so streamed dst lines stay vector aligned.
+template <bool Stream, typename TN>
+void transpose_leaf(const TN* SENKAID_RESTRICT src, std::size_t lds, TN* SENKAID_RESTRICT dst, std::size_t ldd,
+                    std::size_t r0, std::size_t r1, std::size_t c0, std::size_t c1)
+{
+    constexpr std::size_t B = backend::simd::transpose_block_size<TN>;
+
+    const std::size_t rb = r0 + (r1 - r0) / B * B;
+    const std::size_t cb = c0 + (c1 - c0) / B * B;
+
+    for (std::size_t i = r0; i < rb; i += B)
+    {
+        for (std::size_t j = c0; j < cb; j += B)
+            backend::simd::transpose_block<Stream>(src + i * lds + j, lds, dst + j * ldd + i, ldd);
+
+        for (std::size_t j = cb; j < c1; ++j)
+            for (std::size_t k = i; k < i + B; ++k)
+                dst[j * ldd + k] = src[k * lds + j];
+    }
+
+    for (std::size_t i = rb; i < r1; ++i)
+        for (std::size_t j = c0; j < c1; ++j)
+            dst[j * ldd + i] = src[i * lds + j];
+}
+
+// Halves the longer side (at a block boundary) until the tile reaches transpose_tile_bytes.
+template <bool Stream, typename TN>
+void transpose_recursive(const TN* SENKAID_RESTRICT src, std::size_t lds, TN* SENKAID_RESTRICT dst, std::size_t ldd,
+                         std::size_t r0, std::size_t r1, std::size_t c0, std::size_t c1)
+{
+    constexpr std::size_t B = backend::simd::transpose_block_size<TN>;
+
+    const std::size_t rows = r1 - r0;
+    const std::size_t cols = c1 - c0;
+
+    if (rows * cols * sizeof(TN) <= transpose_tile_bytes || (rows <= B && cols <= B))
+    {
+        transpose_leaf<Stream>(src, lds, dst, ldd, r0, r1, c0, c1);
+        return;
+    }
+
+    if (rows >= cols)
+    {
+        const std::size_t mid = r0 + std::max<std::size_t>(rows / 2 / B * B, B);
+        transpose_recursive<Stream>(src, lds, dst, ldd, r0, mid, c0, c1);
+        transpose_recursive<Stream>(src, lds, dst, ldd, mid, r1, c0, c1);
+    }
+    else
+    {
+        const std::size_t mid = c0 + std::max<std::size_t>(cols / 2 / B * B, B);
+        transpose_recursive<Stream>(src, lds, dst, ldd, r0, r1, c0, mid);
+        transpose_recursive<Stream>(src, lds, dst, ldd, r0, r1, mid, c1);
+    }
+}
+
+template <bool Stream, typename TN>
+void transpose_dispatch(const TN* src, std::size_t rows, std::size_t cols, std::size_t lds,
+                        TN* dst, std::size_t ldd, const TransposeOptions& options)
+{
+    constexpr std::size_t B = backend::simd::transpose_block_size<TN>;
+
+    // Stripes of whole blocks, each roughly a few hundred KB so chunks amortize their dispatch.
+    const std::size_t stripe_bytes = std::max<std::size_t>(cols * sizeof(TN) * B, 1);
+    const std::size_t grain = std::max<std::size_t>(1, (256 * 1024) / stripe_bytes);
+    const std::size_t stripes = (rows + B - 1) / B;
+
+    auto run = [&](std::size_t lo, std::size_t hi) {
+        transpose_recursive<Stream>(src, lds, dst, ldd, lo * B, std::min(hi * B, rows), 0, cols);
+    };
+
+    if (options.parallel)
+        backend::parallel::parallel_for(0, stripes, grain, run,
+                                        options.pool ? *options.pool : backend::parallel::ThreadPool::instance());
+    else
+        run(0, stripes);
+
+    if constexpr (Stream)
+        backend::simd::stream_fence();
+}
+
+} // namespace detail
+
+// transpose: dst[j * ldd + i] = src[i * lds + j] for i < rows, j < cols.
+// Parameters:
+//   src, lds  - Source and its line stride (elements, >= cols).
+//   rows, cols - Source extent in lines and elements per line.
+//   dst, ldd  - Destination and its line stride (elements, >= rows); must not overlap src.
+//   options   - Store mode and threading.
+// Streaming requires dst and ldd to be vector aligned; otherwise ordinary stores are used.
+template <typename TN>
+void transpose(const TN* src, std::size_t rows, std::size_t cols, std::size_t lds, TN* dst, std::size_t ldd,
+               const TransposeOptions& options = {})
+{
+    if (rows == 0 || cols == 0)
+        return;
+
+    if (SENKAID_UNLIKELY(lds < cols || ldd < rows))
+    {
+        SENKAID_LOG_ERROR("transpose: leading dimension smaller than the extent");
+        return;
+    }
+
+    constexpr std::size_t vector_bytes = backend::simd::transpose_vector_bytes;
+    const bool aligned = vector_bytes != 0
+                      && reinterpret_cast<std::uintptr_t>(dst) % vector_bytes == 0
+                      && (ldd * sizeof(TN)) % vector_bytes == 0;
+
+    bool stream = false;
+    if (options.store == TransposeStore::Stream)
+        stream = aligned;
+    else if (options.store == TransposeStore::Auto)
+        stream = aligned && rows * cols * sizeof(TN) >= transpose_stream_bytes;
+
+    if (stream)
+        detail::transpose_dispatch<true>(src, rows, cols, lds, dst, ldd, options);
+    else
+        detail::transpose_dispatch<false>(src, rows, cols, lds, dst, ldd, options);
+}
+
+// transpose: Returns the transpose of `a` with the same storage order.
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+core::matrix::SDDenseMatrix<Cols, Rows, TN, Major> transpose(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a,
+                                                             const TransposeOptions& options = {})
+{
+    core::matrix::SDDenseMatrix<Cols, Rows, TN, Major> result(a.cols(), a.rows());
+
+    if constexpr (Major == core::matrix::SDMajor::RowMajor)
+        transpose(a.data(), a.rows(), a.cols(), a.cols(), result.data(), a.rows(), options);
+    else
+        transpose(a.data(), a.cols(), a.rows(), a.rows(), result.data(), a.cols(), options);
+
+    return result;
+}
+
+} // namespace senkaid::ops::linalg
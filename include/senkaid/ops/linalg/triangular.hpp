@@ -0,0 +1,153 @@
+#pragma once
+
+// triangular.hpp: Triangular parts of dense matrices, and triangular solves (TRSM) and products
+// (TRMM) with many right-hand sides.
+// trsm() and trmm() run the blocked kernels of backend/cpu/trsm_cpu.hpp: the diagonal blocks
+// are applied directly and everything else is a packed GEMM update, so with many right-hand
+// sides they run at GEMM speed. The right-hand sides are independent problems and are split
+// over the thread pool in chunks of whole GEMM register tiles. Row-major operands are read as
+// the column-major transpose of themselves (side, triangle and op swapped accordingly), so
+// neither operand is copied.
+//
+//   ops::linalg::trsm(l, b, ops::linalg::Side::Left, ops::linalg::Uplo::Lower);      // b := l^-1 b
+//   auto u = ops::linalg::triu(a);
+
+#include <senkaid/utils/config/root.hpp>
+#include <senkaid/utils/debug/root.hpp>
+#include <senkaid/core/matrix/dense.hpp>
+#include <senkaid/backend/cpu/matmul_cpu.hpp>
+#include <senkaid/backend/cpu/trsm_cpu.hpp>
+#include <senkaid/backend/parallel/parallel_for.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+namespace senkaid::ops::linalg
+{
+
+using Side = backend::cpu::Side;
+using Uplo = backend::cpu::Uplo;
+using Diag = backend::cpu::Diag;
+using Op = backend::cpu::Op;
+
+namespace detail
+{
+
+SENKAID_FORCE_INLINE Op flip(Op op) noexcept
+{
+    return op == Op::NoTrans ? Op::Trans : Op::NoTrans;
+}
+
+// tri_apply: trsm() (Solve) or trmm() on column-major storage, the columns (Left) or rows (Right)
+// of B cut into chunks over the thread pool.
+template <bool Solve, typename TN>
+void tri_apply(Side side, Uplo uplo, Op op, Diag diag, std::size_t m, std::size_t n, TN alpha, const TN* a, std::size_t lda, TN* b,
+               std::size_t ldb)
+{
+    using Blocking = backend::cpu::detail::GemmBlocking<TN>;
+    constexpr std::size_t work = std::size_t(1) << 21;
+
+    const std::size_t k = side == Side::Left ? m : n;
+    const std::size_t count = side == Side::Left ? n : m;
+    const std::size_t unit = side == Side::Left ? Blocking::NR : Blocking::MR;
+    const std::size_t grain = (std::max<std::size_t>(1, work / std::max<std::size_t>(1, k * k)) + unit - 1) / unit * unit;
+
+    backend::parallel::parallel_for(0, count, grain, [&](std::size_t lo, std::size_t hi) {
+        const std::size_t mc = side == Side::Left ? m : hi - lo, nc = side == Side::Left ? hi - lo : n;
+        TN* bc = side == Side::Left ? b + lo * ldb : b + lo;
+        if constexpr (Solve)
+            backend::cpu::trsm(side, uplo, op, diag, mc, nc, alpha, a, lda, bc, ldb);
+        else
+            backend::cpu::trmm(side, uplo, op, diag, mc, nc, alpha, a, lda, bc, ldb);
+    });
+}
+
+// tri_dense: tri_apply() on dense matrices of either layout; false (after logging) if the shapes
+// do not fit.
+template <bool Solve, int RA, int CA, int RB, int CB, typename TN, core::matrix::SDMajor MA, core::matrix::SDMajor MB>
+bool tri_dense(const core::matrix::SDDenseMatrix<RA, CA, TN, MA>& a, core::matrix::SDDenseMatrix<RB, CB, TN, MB>& b, Side side,
+               Uplo uplo, Op op, Diag diag, TN alpha)
+{
+    if (SENKAID_UNLIKELY(a.rows() != a.cols() || a.rows() != (side == Side::Left ? b.rows() : b.cols())))
+    {
+        SENKAID_LOG_ERROR(Solve ? "trsm: triangular operand is not square or does not fit b" : "trmm: triangular operand is not square or does not fit b");
+        return false;
+    }
+
+    // A row-major A is its transpose in column-major storage; a row-major B turns the product
+    // around: op(A) B = (B^T op(A)^T)^T.
+    if constexpr (MA == core::matrix::SDMajor::RowMajor)
+    {
+        uplo = uplo == Uplo::Lower ? Uplo::Upper : Uplo::Lower;
+        op = flip(op);
+    }
+    const std::size_t lda = std::max<std::size_t>(1, a.rows());
+    if constexpr (MB == core::matrix::SDMajor::RowMajor)
+        tri_apply<Solve>(side == Side::Left ? Side::Right : Side::Left, uplo, flip(op), diag, b.cols(), b.rows(), alpha, a.data(), lda,
+                         b.data(), std::max<std::size_t>(1, b.cols()));
+    else
+        tri_apply<Solve>(side, uplo, op, diag, b.rows(), b.cols(), alpha, a.data(), lda, b.data(), std::max<std::size_t>(1, b.rows()));
+    return true;
+}
+
+// keep_band: Zeroes every entry of a outside diagonals [lo, hi] (offsets j - i).
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+void keep_band(core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a, std::ptrdiff_t lo, std::ptrdiff_t hi)
+{
+    constexpr bool row_major = Major == core::matrix::SDMajor::RowMajor;
+    const std::size_t lines = row_major ? a.rows() : a.cols();
+    const std::ptrdiff_t len = static_cast<std::ptrdiff_t>(row_major ? a.cols() : a.rows());
+
+    for (std::size_t l = 0; l < lines; ++l)
+    {
+        // Row i keeps columns [i + lo, i + hi]; column j keeps rows [j - hi, j - lo].
+        const std::ptrdiff_t at = static_cast<std::ptrdiff_t>(l);
+        const std::ptrdiff_t k0 = std::clamp<std::ptrdiff_t>(row_major ? at + lo : at - hi, 0, len);
+        const std::ptrdiff_t k1 = std::clamp<std::ptrdiff_t>(row_major ? at + hi + 1 : at - lo + 1, k0, len);
+        TN* line = a.data() + l * static_cast<std::size_t>(len);
+        std::fill(line, line + k0, TN(0));
+        std::fill(line + k1, line + len, TN(0));
+    }
+}
+
+} // namespace detail
+
+// triu: Copy of a with the entries below diagonal k zeroed (k > 0 above the main diagonal).
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+core::matrix::SDDenseMatrix<Rows, Cols, TN, Major> triu(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a, std::ptrdiff_t k = 0)
+{
+    auto out = a;
+    detail::keep_band(out, k, static_cast<std::ptrdiff_t>(a.cols()));
+    return out;
+}
+
+// tril: Copy of a with the entries above diagonal k zeroed (k < 0 below the main diagonal).
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+core::matrix::SDDenseMatrix<Rows, Cols, TN, Major> tril(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a, std::ptrdiff_t k = 0)
+{
+    auto out = a;
+    detail::keep_band(out, -static_cast<std::ptrdiff_t>(a.rows()), k);
+    return out;
+}
+
+// trsm: b := alpha op(a)^-1 b (Side::Left) or alpha b op(a)^-1 (Side::Right), in place; only the
+// `uplo` triangle of the square a is read, and not its diagonal if diag is Unit. Logs an error and
+// leaves b unchanged if the shapes do not fit. A zero on a non-unit diagonal gives infinities.
+template <int RA, int CA, int RB, int CB, typename TN, core::matrix::SDMajor MA, core::matrix::SDMajor MB>
+void trsm(const core::matrix::SDDenseMatrix<RA, CA, TN, MA>& a, core::matrix::SDDenseMatrix<RB, CB, TN, MB>& b, Side side, Uplo uplo,
+          Op op = Op::NoTrans, Diag diag = Diag::NonUnit, TN alpha = TN(1))
+{
+    detail::tri_dense<true>(a, b, side, uplo, op, diag, alpha);
+}
+
+// trmm: b := alpha op(a) b (Side::Left) or alpha b op(a) (Side::Right), in place, with a read
+// as for trsm().
+template <int RA, int CA, int RB, int CB, typename TN, core::matrix::SDMajor MA, core::matrix::SDMajor MB>
+void trmm(const core::matrix::SDDenseMatrix<RA, CA, TN, MA>& a, core::matrix::SDDenseMatrix<RB, CB, TN, MB>& b, Side side, Uplo uplo,
+          Op op = Op::NoTrans, Diag diag = Diag::NonUnit, TN alpha = TN(1))
+{
+    detail::tri_dense<false>(a, b, side, uplo, op, diag, alpha);
+}
+
+} // namespace senkaid::ops::linalg
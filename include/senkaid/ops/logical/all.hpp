@@ -0,0 +1,30 @@
+#pragma once
+
+// all.hpp: Whether every bit of a mask is set. Scans 64 elements per word and stops at the first
+// word with a clear bit.
+//
+//   bool finite = ops::logical::all(ops::logical::equal(a, a));
+
+#include <senkaid/utils/config/root.hpp>
+#include "bit_mask.hpp"
+
+#include <cstddef>
+
+namespace senkaid::ops::logical
+{
+
+// all: Every element is set; true for an empty mask.
+inline bool all(const BitMask& m) noexcept
+{
+    const std::size_t n = m.words();
+    if (n == 0)
+        return true;
+
+    const BitMask::word_type* w = m.data();
+    for (std::size_t i = 0; i + 1 < n; ++i)
+        if (w[i] != ~BitMask::word_type(0))
+            return false;
+    return w[n - 1] == m.last_word_bits();
+}
+
+} // namespace senkaid::ops::logical
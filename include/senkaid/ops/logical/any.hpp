@@ -0,0 +1,26 @@
+#pragma once
+
+// any.hpp: Whether any bit of a mask is set. Scans 64 elements per word and stops at the first
+// non-zero word.
+//
+//   if (ops::logical::any(ops::logical::is_nan(a))) ...
+
+#include <senkaid/utils/config/root.hpp>
+#include "bit_mask.hpp"
+
+#include <cstddef>
+
+namespace senkaid::ops::logical
+{
+
+// any: Some element is set; false for an empty mask.
+inline bool any(const BitMask& m) noexcept
+{
+    const BitMask::word_type* w = m.data();
+    for (std::size_t i = 0; i < m.words(); ++i)
+        if (w[i] != 0)
+            return true;
+    return false;
+}
+
+} // namespace senkaid::ops::logical
@@ -0,0 +1,266 @@
+#pragma once
+
+// bit_mask.hpp: Bit-packed boolean masks over dense matrices, and the comparisons that build them.
+// A BitMask holds one bit per element in 64-bit words: bit i % 64 of word i / 64 belongs to
+// element i of the matrix's storage order (data()[i]), so a mask over 1e9 elements takes 125 MB
+// instead of the 1 GB of a bool or byte per element. Bits past size() are always zero.
+//
+// Comparisons never materialize a byte per element: each pack is compared to a SIMD lane mask,
+// its bits() are shifted into place, and 64 / lanes of them make one word. Consumers (where,
+// any / all, count_nonzero, compress and the masked reductions) go the other way with
+// mask::from_bits(word >> k), again without unpacking. Words are produced and consumed in
+// parallel over the thread pool.
+//
+//   ops::logical::BitMask m = ops::logical::compare(a, 0.0, ops::logical::Greater{});
+//   std::size_t k = m.count();
+
+#include <senkaid/utils/config/root.hpp>
+#include <senkaid/utils/debug/root.hpp>
+#include <senkaid/core/matrix/dense.hpp>
+#include <senkaid/backend/simd/simd_common.hpp>
+#include <senkaid/backend/parallel/parallel_for.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace senkaid::ops::logical
+{
+
+// mask_word_grain: Mask words per parallel chunk (64K elements).
+inline constexpr std::size_t mask_word_grain = 1024;
+
+// BitMask: rows x cols booleans, one bit per element in the storage order of `major`.
+class BitMask
+{
+public:
+    using word_type = std::uint64_t;
+
+    static constexpr std::size_t word_bits = 64;
+
+    BitMask() = default;
+
+    // All bits clear.
+    BitMask(std::size_t rows, std::size_t cols, core::matrix::SDMajor major = core::matrix::SDMajor::RowMajor)
+        : _rows(rows), _cols(cols), _major(major), _words(words_for(rows * cols), 0)
+    {
+    }
+
+    // words_for: Words holding n bits.
+    static constexpr std::size_t words_for(std::size_t n) noexcept { return (n + word_bits - 1) / word_bits; }
+
+    std::size_t rows() const noexcept { return _rows; }
+    std::size_t cols() const noexcept { return _cols; }
+    std::size_t size() const noexcept { return _rows * _cols; }
+    core::matrix::SDMajor major() const noexcept { return _major; }
+
+    std::size_t words() const noexcept { return _words.size(); }
+    word_type* data() noexcept { return _words.data(); }
+    const word_type* data() const noexcept { return _words.data(); }
+
+    bool test(std::size_t i) const noexcept
+    {
+        SENKAID_ASSERT(i < size(), "BitMask: index out of range");
+        return (_words[i / word_bits] >> (i % word_bits)) & 1;
+    }
+
+    void set(std::size_t i, bool v = true) noexcept
+    {
+        SENKAID_ASSERT(i < size(), "BitMask: index out of range");
+        const word_type bit = word_type(1) << (i % word_bits);
+        _words[i / word_bits] = v ? (_words[i / word_bits] | bit) : (_words[i / word_bits] & ~bit);
+    }
+
+    // last_word_bits: The valid bits of the last word (all ones when size() is a multiple of 64).
+    word_type last_word_bits() const noexcept
+    {
+        const std::size_t r = size() % word_bits;
+        return r == 0 ? ~word_type(0) : (word_type(1) << r) - 1;
+    }
+
+    // count: Number of set bits.
+    std::size_t count() const
+    {
+        std::atomic<std::size_t> total{0};
+        backend::parallel::parallel_for(0, words(), mask_word_grain, [&](std::size_t w0, std::size_t w1) {
+            std::size_t c = 0;
+            for (std::size_t w = w0; w < w1; ++w)
+                c += static_cast<std::size_t>(std::popcount(_words[w]));
+            total.fetch_add(c, std::memory_order_relaxed);
+        });
+        return total.load(std::memory_order_relaxed);
+    }
+
+    // same_shape: Same rows, cols and element order as `other`.
+    bool same_shape(const BitMask& other) const noexcept
+    {
+        return _rows == other._rows && _cols == other._cols && _major == other._major;
+    }
+
+    // fits: Bit i belongs to data()[i] of `a`.
+    template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+    bool fits(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a) const noexcept
+    {
+        return _rows == a.rows() && _cols == a.cols() && (_major == Major || _rows <= 1 || _cols <= 1);
+    }
+
+private:
+    std::size_t _rows = 0;
+    std::size_t _cols = 0;
+    core::matrix::SDMajor _major = core::matrix::SDMajor::RowMajor;
+    std::vector<word_type> _words;
+};
+
+// Comparison functors: a lane mask from two packs (or a bool from two elements). Every ordered
+// comparison with NaN is false and NotEqual is true, as for the built-in operators.
+struct Equal
+{
+    template <typename P>
+    SENKAID_FORCE_INLINE auto operator()(P a, P b) const noexcept { return a == b; }
+};
+
+struct NotEqual
+{
+    template <typename P>
+    SENKAID_FORCE_INLINE auto operator()(P a, P b) const noexcept { return a != b; }
+};
+
+struct Less
+{
+    template <typename P>
+    SENKAID_FORCE_INLINE auto operator()(P a, P b) const noexcept { return a < b; }
+};
+
+struct LessEqual
+{
+    template <typename P>
+    SENKAID_FORCE_INLINE auto operator()(P a, P b) const noexcept { return a <= b; }
+};
+
+struct Greater
+{
+    template <typename P>
+    SENKAID_FORCE_INLINE auto operator()(P a, P b) const noexcept { return b < a; }
+};
+
+struct GreaterEqual
+{
+    template <typename P>
+    SENKAID_FORCE_INLINE auto operator()(P a, P b) const noexcept { return b <= a; }
+};
+
+namespace detail
+{
+
+// for_each_mask_word: body(w, i0, len) for every word w of an n-bit mask, i0 = 64 w being its
+// first element and len <= 64 its number of valid bits; spread over the thread pool.
+template <typename Body>
+void for_each_mask_word(std::size_t n, Body&& body)
+{
+    constexpr std::size_t W = BitMask::word_bits;
+    backend::parallel::parallel_for(0, BitMask::words_for(n), mask_word_grain, [&](std::size_t w0, std::size_t w1) {
+        for (std::size_t w = w0; w < w1; ++w)
+            body(w, w * W, std::min(W, n - w * W));
+    });
+}
+
+// operand_load: Pack of elements [i, i + lanes) of a buffer, or the broadcast scalar *p; masked
+// to m on a ragged end.
+template <bool Stationary, typename P>
+SENKAID_FORCE_INLINE P operand_load(const typename P::value_type* p, std::size_t i) noexcept
+{
+    if constexpr (Stationary)
+        return P(*p);
+    else
+        return P::loadu(p + i);
+}
+
+template <bool Stationary, typename P>
+SENKAID_FORCE_INLINE P operand_load(const typename P::value_type* p, std::size_t i, typename P::mask_type m) noexcept
+{
+    if constexpr (Stationary)
+        return P(*p);
+    else
+        return P::load(p + i, m);
+}
+
+// compare_words: words = op(a, b) bit by bit over n elements; a (b) is a single value if SA (SB).
+template <bool SA, bool SB, typename TN, typename Op>
+void compare_words(const TN* a, const TN* b, std::size_t n, Op op, BitMask::word_type* words)
+{
+    using P = backend::simd::pack<TN>;
+    using M = typename P::mask_type;
+    constexpr std::size_t L = P::lanes;
+    static_assert(BitMask::word_bits % L == 0, "compare: pack lanes must divide the mask word");
+
+    for_each_mask_word(n, [&](std::size_t w, std::size_t i0, std::size_t len) {
+        BitMask::word_type bits = 0;
+        if (SENKAID_LIKELY(len == BitMask::word_bits))
+        {
+            for (std::size_t k = 0; k < BitMask::word_bits; k += L)
+                bits |= op(operand_load<SA, P>(a, i0 + k), operand_load<SB, P>(b, i0 + k)).bits() << k;
+        }
+        else
+        {
+            for (std::size_t k = 0; k < len; k += L)
+            {
+                const M m = M::first_n(len - k);
+                bits |= (op(operand_load<SA, P>(a, i0 + k, m), operand_load<SB, P>(b, i0 + k, m)) & m).bits() << k;
+            }
+        }
+        words[w] = bits;
+    });
+}
+
+// operand_data: Element pointer of a matrix operand, or of the converted scalar in `slot`.
+template <typename TN, typename A>
+SENKAID_FORCE_INLINE const TN* operand_data(const A& a, TN& slot) noexcept
+{
+    if constexpr (core::matrix::Scalar<A>)
+    {
+        slot = static_cast<TN>(a);
+        return &slot;
+    }
+    else
+        return a.data();
+}
+
+} // namespace detail
+
+// compare: Mask of op(a(i, j), b(i, j)); a and b are dense matrices of one shape and layout, or
+// one of them a scalar. Logs an error and returns an empty mask if the shapes differ.
+template <typename Op, typename A, typename B>
+requires (!core::matrix::Scalar<A> || !core::matrix::Scalar<B>)
+BitMask compare(const A& a, const B& b, Op op)
+{
+    using Mx = std::conditional_t<core::matrix::Scalar<A>, B, A>;
+    using TN = typename Mx::value_type;
+
+    const Mx* shape = nullptr;
+    if constexpr (core::matrix::Scalar<A>)
+        shape = &b;
+    else
+        shape = &a;
+
+    if constexpr (!core::matrix::Scalar<A> && !core::matrix::Scalar<B>)
+    {
+        static_assert(A::major == B::major && std::is_same_v<typename A::value_type, typename B::value_type>,
+                      "compare: operands must share element type and layout");
+        if (SENKAID_UNLIKELY(a.rows() != b.rows() || a.cols() != b.cols()))
+        {
+            SENKAID_LOG_ERROR("compare: operand shapes differ");
+            return {};
+        }
+    }
+
+    BitMask out(shape->rows(), shape->cols(), Mx::major);
+    TN sa{}, sb{};
+    detail::compare_words<core::matrix::Scalar<A>, core::matrix::Scalar<B>>(detail::operand_data<TN>(a, sa), detail::operand_data<TN>(b, sb),
+                                                                            out.size(), op, out.data());
+    return out;
+}
+
+} // namespace senkaid::ops::logical
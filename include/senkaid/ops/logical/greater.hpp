@@ -0,0 +1,22 @@
+#pragma once
+
+// greater.hpp: Element-wise a > b as a bit-packed mask (see bit_mask.hpp).
+//
+//   auto m = ops::logical::greater(a, 0.0);
+
+#include <senkaid/utils/config/root.hpp>
+#include <senkaid/core/matrix/dense.hpp>
+#include "bit_mask.hpp"
+
+namespace senkaid::ops::logical
+{
+
+// greater: Mask of a(i, j) > b(i, j); either operand may be a scalar.
+template <typename A, typename B>
+requires (!core::matrix::Scalar<A> || !core::matrix::Scalar<B>)
+BitMask greater(const A& a, const B& b)
+{
+    return compare(a, b, Greater{});
+}
+
+} // namespace senkaid::ops::logical
@@ -0,0 +1,30 @@
+#pragma once
+
+// is_inf.hpp: Mask of the infinite entries of a dense matrix (|x| == inf, one compare per pack).
+//
+//   auto m = ops::logical::is_inf(a);
+
+#include <senkaid/utils/config/root.hpp>
+#include <senkaid/core/matrix/dense.hpp>
+#include "bit_mask.hpp"
+
+#include <limits>
+#include <type_traits>
+
+namespace senkaid::ops::logical
+{
+
+// is_inf: Mask of |a(i, j)| == inf; all clear for integer element types.
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+BitMask is_inf(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a)
+{
+    BitMask out(a.rows(), a.cols(), Major);
+    if constexpr (std::is_floating_point_v<TN>)
+    {
+        const TN inf = std::numeric_limits<TN>::infinity();
+        detail::compare_words<false, true>(a.data(), &inf, a.size(), [](auto x, auto y) { return abs(x) == y; }, out.data());
+    }
+    return out;
+}
+
+} // namespace senkaid::ops::logical
@@ -0,0 +1,21 @@
+#pragma once
+
+// is_nan.hpp: Mask of the NaN entries of a dense matrix (x != x, one compare per pack).
+//
+//   if (ops::logical::is_nan(a).count() != 0) ...
+
+#include <senkaid/utils/config/root.hpp>
+#include <senkaid/core/matrix/dense.hpp>
+#include "bit_mask.hpp"
+
+namespace senkaid::ops::logical
+{
+
+// is_nan: Mask of a(i, j) != a(i, j); all clear for integer element types.
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+BitMask is_nan(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a)
+{
+    return compare(a, a, NotEqual{});
+}
+
+} // namespace senkaid::ops::logical
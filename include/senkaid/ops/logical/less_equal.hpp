@@ -0,0 +1,22 @@
+#pragma once
+
+// less_equal.hpp: Element-wise a <= b as a bit-packed mask (see bit_mask.hpp).
+//
+//   auto m = ops::logical::less_equal(a, 1.0);
+
+#include <senkaid/utils/config/root.hpp>
+#include <senkaid/core/matrix/dense.hpp>
+#include "bit_mask.hpp"
+
+namespace senkaid::ops::logical
+{
+
+// less_equal: Mask of a(i, j) <= b(i, j); either operand may be a scalar.
+template <typename A, typename B>
+requires (!core::matrix::Scalar<A> || !core::matrix::Scalar<B>)
+BitMask less_equal(const A& a, const B& b)
+{
+    return compare(a, b, LessEqual{});
+}
+
+} // namespace senkaid::ops::logical
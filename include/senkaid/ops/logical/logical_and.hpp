@@ -0,0 +1,22 @@
+#pragma once
+
+// logical_and.hpp: a AND b of two bit-packed masks, 64 elements per word operation.
+//
+//   auto m = ops::logical::logical_and(ops::logical::greater(a, 0.0), ops::logical::less(a, 1.0));
+
+#include <senkaid/utils/config/root.hpp>
+#include "bit_mask.hpp"
+#include "mask_ops.hpp"
+
+#include <functional>
+
+namespace senkaid::ops::logical
+{
+
+// logical_and: Bitwise & of two masks of one shape; an empty mask (and an error) if they differ.
+inline BitMask logical_and(const BitMask& a, const BitMask& b)
+{
+    return combine_masks(a, b, std::bit_and<>{});
+}
+
+} // namespace senkaid::ops::logical
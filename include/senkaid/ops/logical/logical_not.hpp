@@ -0,0 +1,20 @@
+#pragma once
+
+// logical_not.hpp: Complement of a bit-packed mask, 64 elements per word operation.
+//
+//   auto m = ops::logical::logical_not(ops::logical::is_nan(a));
+
+#include <senkaid/utils/config/root.hpp>
+#include "bit_mask.hpp"
+#include "mask_ops.hpp"
+
+namespace senkaid::ops::logical
+{
+
+// logical_not: Every element's bit flipped.
+inline BitMask logical_not(const BitMask& m)
+{
+    return invert_mask(m);
+}
+
+} // namespace senkaid::ops::logical
@@ -0,0 +1,22 @@
+#pragma once
+
+// logical_or.hpp: a OR b of two bit-packed masks, 64 elements per word operation.
+//
+//   auto m = ops::logical::logical_or(ops::logical::greater(a, 0.0), ops::logical::less(a, 1.0));
+
+#include <senkaid/utils/config/root.hpp>
+#include "bit_mask.hpp"
+#include "mask_ops.hpp"
+
+#include <functional>
+
+namespace senkaid::ops::logical
+{
+
+// logical_or: Bitwise | of two masks of one shape; an empty mask (and an error) if they differ.
+inline BitMask logical_or(const BitMask& a, const BitMask& b)
+{
+    return combine_masks(a, b, std::bit_or<>{});
+}
+
+} // namespace senkaid::ops::logical
@@ -0,0 +1,333 @@
+#pragma once
+
+// mask_ops.hpp: Mask compaction and mask algebra.
+// flatnonzero / compress return the positions or values selected by a non-zero condition or by
+// a BitMask (bit_mask.hpp); combine_masks / invert_mask work on BitMask words.
+// A native pack is compared against zero, simd::compress moves the selected lanes to the front
+// of the register (vpcompress on AVX-512, a vpermd table on AVX2) and one store appends them to
+// the output. There is no per-element branch, so the cost does not depend on how many elements
+// are selected or on how the selection is distributed. With pool workers available, large inputs
+// take two parallel passes: per-block counts, an exclusive scan of them for output offsets, then
+// each block compacts into its own slice of the output.
+//
+//   std::vector<std::int64_t> idx = ops::logical::flatnonzero(a);   // linear indices into a.data()
+//   std::vector<double> pos = ops::logical::compress(ops::logical::greater(a, 0.0), a);
+
+#include <senkaid/utils/config/root.hpp>
+#include <senkaid/utils/debug/root.hpp>
+#include <senkaid/core/matrix/dense.hpp>
+#include <senkaid/backend/simd/simd_common.hpp>
+#include <senkaid/backend/parallel/parallel_for.hpp>
+#include <senkaid/ops/reduce/count_nonzero.hpp>
+#include "bit_mask.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+namespace senkaid::ops::logical
+{
+
+// compact_grain: Elements per block of the parallel two-pass compaction.
+inline constexpr std::size_t compact_grain = 64 * 1024;
+
+namespace detail
+{
+
+// append: Compacts the active lanes of v to out + count. A full-width store is cheaper than a
+// masked one (much cheaper than AVX2 vpmaskmov), so one is used while out has `cap` elements of
+// room past it; the lanes beyond the new count are overwritten by later appends.
+template <typename T, std::size_t N>
+SENKAID_FORCE_INLINE void append(T* out, std::size_t& count, std::size_t cap,
+                                 backend::simd::pack<T, N> v, backend::simd::mask<T, N> m)
+{
+    if (SENKAID_LIKELY(count + N <= cap))
+    {
+        backend::simd::compress(v, m).storeu(out + count);
+        count += m.count();
+    }
+    else
+        count += backend::simd::compress_store(out + count, v, m);
+}
+
+// flatnonzero_range: Writes the indices i in [lo, hi) with x[i] != 0 to out, which has room for
+// cap indices; returns their count. Each data pack is split into index packs of
+// pack<int64_t>::lanes lanes for compaction.
+template <typename TN>
+std::size_t flatnonzero_range(const TN* x, std::size_t lo, std::size_t hi, std::int64_t* out, std::size_t cap)
+{
+    namespace simd = backend::simd;
+    using P = simd::pack<TN>;
+    using I = simd::pack<std::int64_t>;
+    constexpr std::size_t L = P::lanes;
+
+    std::size_t count = 0;
+    std::size_t i = lo;
+
+    if constexpr (L % I::lanes == 0)
+    {
+        const P z = P::zero();
+        const I lane = simd::iota<I>();
+
+        const auto emit = [&](P v) {
+            std::uint64_t bits = (v != z).bits();
+            for (std::size_t k = 0; bits != 0; k += I::lanes, bits >>= I::lanes)
+                append(out, count, cap, I(static_cast<std::int64_t>(i + k)) + lane, I::mask_type::from_bits(bits));
+        };
+
+        for (; i + L <= hi; i += L)
+            emit(P::loadu(x + i));
+        if (i < hi)
+            emit(P::load(x + i, P::mask_type::first_n(hi - i)));
+        return count;
+    }
+    else
+    {
+        for (; i < hi; ++i)
+            if (x[i] != TN(0))
+                out[count++] = static_cast<std::int64_t>(i);
+        return count;
+    }
+}
+
+// compress_range: Writes x[i] for i in [lo, hi) with cond[i] != 0 to out, which has room for
+// cap elements; returns their count.
+template <typename TN>
+std::size_t compress_range(const TN* cond, const TN* x, std::size_t lo, std::size_t hi, TN* out, std::size_t cap)
+{
+    namespace simd = backend::simd;
+    using P = simd::pack<TN>;
+    constexpr std::size_t L = P::lanes;
+
+    const P z = P::zero();
+    std::size_t count = 0;
+
+    std::size_t i = lo;
+    for (; i + L <= hi; i += L)
+        append(out, count, cap, P::loadu(x + i), P::loadu(cond + i) != z);
+    if (i < hi)
+    {
+        const auto tail = P::mask_type::first_n(hi - i);
+        append(out, count, cap, P::load(x + i, tail), P::load(cond + i, tail) != z);
+    }
+    return count;
+}
+
+// mask_count_range: Set bits of mask words covering [lo, hi); lo is a multiple of 64.
+inline std::size_t mask_count_range(const BitMask::word_type* words, std::size_t lo, std::size_t hi)
+{
+    std::size_t c = 0;
+    for (std::size_t w = lo / BitMask::word_bits; w * BitMask::word_bits < hi; ++w)
+        c += static_cast<std::size_t>(std::popcount(words[w]));
+    return c;
+}
+
+// mask_flatnonzero_range: Writes the indices of the set bits in [lo, hi) to out, which has room
+// for cap indices; returns their count. lo is a multiple of 64.
+inline std::size_t mask_flatnonzero_range(const BitMask::word_type* words, std::size_t lo, std::size_t hi, std::int64_t* out,
+                                          std::size_t cap)
+{
+    namespace simd = backend::simd;
+    using I = simd::pack<std::int64_t>;
+    using IM = typename I::mask_type;
+
+    const I lane = simd::iota<I>();
+    std::size_t count = 0;
+    for (std::size_t i = lo; i < hi; i += BitMask::word_bits)
+    {
+        const BitMask::word_type bits = words[i / BitMask::word_bits];
+        if (bits == 0)
+            continue;
+        for (std::size_t k = 0; k < BitMask::word_bits && (bits >> k) != 0; k += I::lanes)
+            append(out, count, cap, I(static_cast<std::int64_t>(i + k)) + lane, IM::from_bits(bits >> k));
+    }
+    return count;
+}
+
+// mask_compress_range: Writes x[i] for the set bits i in [lo, hi) to out, which has room for cap
+// elements; returns their count. lo is a multiple of 64.
+template <typename TN>
+std::size_t mask_compress_range(const BitMask::word_type* words, const TN* x, std::size_t lo, std::size_t hi, TN* out, std::size_t cap)
+{
+    namespace simd = backend::simd;
+    using P = simd::pack<TN>;
+    using M = typename P::mask_type;
+    constexpr std::size_t L = P::lanes;
+
+    std::size_t count = 0;
+    for (std::size_t i = lo; i < hi; i += BitMask::word_bits)
+    {
+        const BitMask::word_type bits = words[i / BitMask::word_bits];
+        if (bits == 0)
+            continue;
+        const std::size_t len = std::min(BitMask::word_bits, hi - i);
+        for (std::size_t k = 0; k < len && (bits >> k) != 0; k += L)
+        {
+            const M m = M::from_bits(bits >> k);
+            append(out, count, cap, k + L <= len ? P::loadu(x + i + k) : P::load(x + i + k, m), m);
+        }
+    }
+    return count;
+}
+
+// compact: Runs range(lo, hi, offset, cap), which writes the selections of [lo, hi) to the `cap`
+// output elements from position `offset`, over [0, n). count(lo, hi) gives the selections of a
+// block for the parallel first pass; each block's slice is then exactly as large as its count.
+// Returns the total.
+template <typename Count, typename Range>
+std::size_t compact(std::size_t n, Count count, Range range)
+{
+    using backend::parallel::ParallelConfig;
+    using backend::parallel::ThreadPool;
+
+    const std::size_t blocks = (n + compact_grain - 1) / compact_grain;
+    if (blocks < 2 || ThreadPool::instance().size() == 0 || !ParallelConfig::enabled() || ThreadPool::on_worker_thread())
+        return range(0, n, 0, n);
+
+    const auto block = [&](std::size_t b, auto fn) {
+        const std::size_t lo = b * compact_grain;
+        return fn(lo, std::min(lo + compact_grain, n));
+    };
+
+    // offset[b + 1] first holds block b's count; the scan turns it into the start of block b + 1.
+    std::vector<std::size_t> offset(blocks + 1, 0);
+    backend::parallel::parallel_for(0, blocks, 1, [&](std::size_t b0, std::size_t b1) {
+        for (std::size_t b = b0; b < b1; ++b)
+            offset[b + 1] = block(b, count);
+    });
+    std::inclusive_scan(offset.begin(), offset.end(), offset.begin());
+
+    backend::parallel::parallel_for(0, blocks, 1, [&](std::size_t b0, std::size_t b1) {
+        for (std::size_t b = b0; b < b1; ++b)
+            block(b, [&](std::size_t lo, std::size_t hi) { return range(lo, hi, offset[b], offset[b + 1] - offset[b]); });
+    });
+    return offset[blocks];
+}
+
+} // namespace detail
+
+// flatnonzero: Indices i < n with x[i] != 0, ascending, written to out; returns their number.
+// out must have room for n indices. NaN counts as non-zero.
+template <typename TN>
+std::size_t flatnonzero(const TN* x, std::size_t n, std::int64_t* out)
+{
+    return detail::compact(
+        n,
+        [&](std::size_t lo, std::size_t hi) { return reduce::detail::count_nonzero_range(x, lo, hi); },
+        [&](std::size_t lo, std::size_t hi, std::size_t at, std::size_t cap) {
+            return detail::flatnonzero_range(x, lo, hi, out + at, cap);
+        });
+}
+
+// flatnonzero: Linear indices (into data(), in storage order) of the non-zero entries of `a`.
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+std::vector<std::int64_t> flatnonzero(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a)
+{
+    std::vector<std::int64_t> result(a.size());
+    result.resize(flatnonzero(a.data(), a.size(), result.data()));
+    return result;
+}
+
+// compress: x[i] for i < n with cond[i] != 0, in order, written to out; returns their number.
+// out must have room for n elements and must not overlap x or cond.
+template <typename TN>
+std::size_t compress(const TN* cond, const TN* x, std::size_t n, TN* out)
+{
+    return detail::compact(
+        n,
+        [&](std::size_t lo, std::size_t hi) { return reduce::detail::count_nonzero_range(cond, lo, hi); },
+        [&](std::size_t lo, std::size_t hi, std::size_t at, std::size_t cap) {
+            return detail::compress_range(cond, x, lo, hi, out + at, cap);
+        });
+}
+
+// compress: Entries of `a` (storage order) where the same entry of `cond` is non-zero.
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+std::vector<TN> compress(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& cond,
+                         const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a)
+{
+    if (SENKAID_UNLIKELY(cond.rows() != a.rows() || cond.cols() != a.cols()))
+    {
+        SENKAID_LOG_ERROR("compress: condition and matrix shapes differ");
+        return {};
+    }
+
+    std::vector<TN> result(a.size());
+    result.resize(compress(cond.data(), a.data(), a.size(), result.data()));
+    return result;
+}
+
+// flatnonzero: Indices of the set bits of `mask`, ascending (storage order of the masked matrix).
+inline std::vector<std::int64_t> flatnonzero(const BitMask& mask)
+{
+    std::vector<std::int64_t> result(mask.size());
+    result.resize(detail::compact(
+        mask.size(), [&](std::size_t lo, std::size_t hi) { return detail::mask_count_range(mask.data(), lo, hi); },
+        [&](std::size_t lo, std::size_t hi, std::size_t at, std::size_t cap) {
+            return detail::mask_flatnonzero_range(mask.data(), lo, hi, result.data() + at, cap);
+        }));
+    return result;
+}
+
+// compress: Entries of `a` (storage order) whose bit is set in `mask`. Logs an error and returns
+// nothing if the mask does not fit a.
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+std::vector<TN> compress(const BitMask& mask, const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a)
+{
+    if (SENKAID_UNLIKELY(!mask.fits(a)))
+    {
+        SENKAID_LOG_ERROR("compress: mask and matrix shapes differ");
+        return {};
+    }
+
+    std::vector<TN> result(a.size());
+    result.resize(detail::compact(
+        a.size(), [&](std::size_t lo, std::size_t hi) { return detail::mask_count_range(mask.data(), lo, hi); },
+        [&](std::size_t lo, std::size_t hi, std::size_t at, std::size_t cap) {
+            return detail::mask_compress_range(mask.data(), a.data(), lo, hi, result.data() + at, cap);
+        }));
+    return result;
+}
+
+// combine_masks: op(a_word, b_word) for every word, e.g. std::bit_and<>{}; op must map two zero
+// bits to zero so the bits past size() stay clear. Logs an error and returns an empty mask if
+// the shapes differ.
+template <typename Op>
+BitMask combine_masks(const BitMask& a, const BitMask& b, Op op)
+{
+    if (SENKAID_UNLIKELY(!a.same_shape(b)))
+    {
+        SENKAID_LOG_ERROR("combine_masks: mask shapes differ");
+        return {};
+    }
+
+    BitMask out(a.rows(), a.cols(), a.major());
+    const BitMask::word_type* x = a.data();
+    const BitMask::word_type* y = b.data();
+    BitMask::word_type* z = out.data();
+    backend::parallel::parallel_for(0, out.words(), mask_word_grain, [&](std::size_t w0, std::size_t w1) {
+        for (std::size_t w = w0; w < w1; ++w)
+            z[w] = op(x[w], y[w]);
+    });
+    return out;
+}
+
+// invert_mask: Every bit flipped (within size()).
+inline BitMask invert_mask(const BitMask& m)
+{
+    BitMask out(m.rows(), m.cols(), m.major());
+    const BitMask::word_type* x = m.data();
+    BitMask::word_type* z = out.data();
+    backend::parallel::parallel_for(0, out.words(), mask_word_grain, [&](std::size_t w0, std::size_t w1) {
+        for (std::size_t w = w0; w < w1; ++w)
+            z[w] = ~x[w];
+    });
+    if (out.words() != 0)
+        z[out.words() - 1] &= out.last_word_bits();
+    return out;
+}
+
+} // namespace senkaid::ops::logical
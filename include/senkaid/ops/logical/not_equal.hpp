@@ -0,0 +1,22 @@
+#pragma once
+
+// not_equal.hpp: Element-wise a != b as a bit-packed mask (see bit_mask.hpp).
+//
+//   auto m = ops::logical::not_equal(a, 0.0);
+
+#include <senkaid/utils/config/root.hpp>
+#include <senkaid/core/matrix/dense.hpp>
+#include "bit_mask.hpp"
+
+namespace senkaid::ops::logical
+{
+
+// not_equal: Mask of a(i, j) != b(i, j) (true where either is NaN); either operand may be a scalar.
+template <typename A, typename B>
+requires (!core::matrix::Scalar<A> || !core::matrix::Scalar<B>)
+BitMask not_equal(const A& a, const B& b)
+{
+    return compare(a, b, NotEqual{});
+}
+
+} // namespace senkaid::ops::logical
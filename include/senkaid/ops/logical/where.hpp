@@ -0,0 +1,106 @@
+#pragma once
+
+// where.hpp: Element-wise selection by a bit-packed mask: cond ? a : b.
+// Each pack takes its lane mask straight from the mask word (mask::from_bits(word >> k)) and
+// blends the two operands with one select, so the condition is never expanded to a byte or an
+// element per entry. Either operand may be a scalar, which is broadcast into a register once.
+// The one-argument where(cond) gives the positions of the set bits (flatnonzero).
+//
+//   auto relu = ops::logical::where(ops::logical::greater(x, 0.0), x, 0.0);
+
+#include <senkaid/utils/config/root.hpp>
+#include <senkaid/utils/debug/root.hpp>
+#include <senkaid/core/matrix/dense.hpp>
+#include <senkaid/backend/simd/simd_common.hpp>
+#include "bit_mask.hpp"
+#include "mask_ops.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace senkaid::ops::logical
+{
+
+namespace detail
+{
+
+// select_words: out[i] = bit i of words ? a[i] : b[i] over n elements; a (b) is a single value if
+// SA (SB).
+template <bool SA, bool SB, typename TN>
+void select_words(const BitMask::word_type* words, const TN* a, const TN* b, std::size_t n, TN* out)
+{
+    using P = backend::simd::pack<TN>;
+    using M = typename P::mask_type;
+    constexpr std::size_t L = P::lanes;
+
+    for_each_mask_word(n, [&](std::size_t w, std::size_t i0, std::size_t len) {
+        const BitMask::word_type bits = words[w];
+        for (std::size_t k = 0; k < len; k += L)
+        {
+            const M m = M::from_bits(bits >> k);
+            if (SENKAID_LIKELY(k + L <= len))
+                select(m, operand_load<SA, P>(a, i0 + k), operand_load<SB, P>(b, i0 + k)).storeu(out + i0 + k);
+            else
+            {
+                const M t = M::first_n(len - k);
+                select(m, operand_load<SA, P>(a, i0 + k, t), operand_load<SB, P>(b, i0 + k, t)).store(out + i0 + k, t);
+            }
+        }
+    });
+}
+
+} // namespace detail
+
+// where: out = cond ? a(i, j) : b(i, j); a and b are dense matrices of cond's shape and one
+// layout, or scalars (not both), and out has a's or b's type. out may be a or b. A dynamic out is
+// resized to cond's shape; writing into an existing matrix avoids zero-filling a fresh one. Logs
+// an error and leaves out unchanged if the shapes differ.
+template <typename A, typename B, typename R>
+requires (!core::matrix::Scalar<A> || !core::matrix::Scalar<B>) && std::is_same_v<R, std::conditional_t<core::matrix::Scalar<A>, B, A>>
+void where(const BitMask& cond, const A& a, const B& b, R& out)
+{
+    using TN = typename R::value_type;
+
+    if constexpr (!core::matrix::Scalar<A> && !core::matrix::Scalar<B>)
+        static_assert(A::major == B::major && std::is_same_v<typename A::value_type, typename B::value_type>,
+                      "where: operands must share element type and layout");
+
+    const auto fits = [&](const auto& x) {
+        if constexpr (core::matrix::Scalar<std::remove_cvref_t<decltype(x)>>)
+            return true;
+        else
+            return cond.fits(x);
+    };
+    if (SENKAID_UNLIKELY(!fits(a) || !fits(b)))
+    {
+        SENKAID_LOG_ERROR("where: condition and operand shapes differ");
+        return;
+    }
+
+    if (out.rows() != cond.rows() || out.cols() != cond.cols())
+        out = R(cond.rows(), cond.cols());
+    TN sa{}, sb{};
+    detail::select_words<core::matrix::Scalar<A>, core::matrix::Scalar<B>>(cond.data(), detail::operand_data<TN>(a, sa),
+                                                                           detail::operand_data<TN>(b, sb), out.size(), out.data());
+}
+
+// where: cond ? a(i, j) : b(i, j) as a new matrix of a's (or b's) type; a default matrix if the
+// shapes differ.
+template <typename A, typename B>
+requires (!core::matrix::Scalar<A> || !core::matrix::Scalar<B>)
+std::conditional_t<core::matrix::Scalar<A>, B, A> where(const BitMask& cond, const A& a, const B& b)
+{
+    std::conditional_t<core::matrix::Scalar<A>, B, A> out;
+    where(cond, a, b, out);
+    return out;
+}
+
+// where: Linear indices of the set bits of cond, ascending.
+inline std::vector<std::int64_t> where(const BitMask& cond)
+{
+    return flatnonzero(cond);
+}
+
+} // namespace senkaid::ops::logical
@@ -0,0 +1,149 @@
+#pragma once
+
+// arg_reduce.hpp: Positions of the smallest / largest elements, whole or along an axis; the
+// shared implementation of argmin.hpp and argmax.hpp.
+// Values and positions travel together in SIMD registers: one comparison mask blends both the
+// running best values and a pack of step counts, kept in the element type so the mask never
+// changes lane type (backend/simd/simd_reduction.hpp, reduce_argmax). Ties resolve to the first
+// occurrence and a NaN beats every number, so the result is the position of the first NaN if
+// there is one, as in NumPy. Along an axis the traversal follows the layout as in reduce_dim.hpp:
+// one kernel per contiguous line, or across lines a line of best values and positions updated a
+// whole line at a time, in fixed tiles whose bands merge in order. Positions are std::int64_t,
+// -1 for an empty reduction.
+//
+//   std::int64_t i = ops::reduce::argmax(scores.data(), scores.size());
+//   auto labels = ops::reduce::argmax(logits, ops::reduce::Axis::Cols);    // one per row
+
+#include <senkaid/utils/config/root.hpp>
+#include <senkaid/core/matrix/dense.hpp>
+#include <senkaid/backend/simd/simd_reduction.hpp>
+#include <senkaid/backend/simd/simd_load_store.hpp>
+#include <senkaid/backend/cpu/reduce_cpu.hpp>
+#include <senkaid/backend/parallel/parallel_for.hpp>
+#include "reduce_dim.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace senkaid::ops::reduce
+{
+
+namespace detail
+{
+
+// arg_position: The position of r, or -1 if there was none.
+template <typename TN>
+SENKAID_FORCE_INLINE std::int64_t arg_position(const backend::simd::extremum_at<TN>& r) noexcept
+{
+    return r.index == r.npos ? -1 : static_cast<std::int64_t>(r.index);
+}
+
+// arg_whole: Position of the first smallest (largest if Max) element of x[0, n).
+template <bool Max, typename TN>
+std::int64_t arg_whole(const TN* x, std::size_t n)
+{
+    if constexpr (Max)
+        return arg_position(backend::cpu::argmax(x, n));
+    else
+        return arg_position(backend::cpu::argmin(x, n));
+}
+
+// arg_along: out[i] = position within contiguous line i of its extremum.
+template <bool Max, typename TN>
+void arg_along(const TN* x, std::size_t lines, std::size_t len, std::int64_t* out)
+{
+    constexpr std::size_t grain = backend::cpu::reduce_grain;
+
+    if (len >= 2 * grain)
+    {
+        for (std::size_t i = 0; i < lines; ++i)
+            out[i] = arg_whole<Max>(x + i * len, len);
+        return;
+    }
+
+    backend::parallel::parallel_for(0, lines, std::max<std::size_t>(1, grain / len), [&](std::size_t lo, std::size_t hi) {
+        for (std::size_t i = lo; i < hi; ++i)
+            out[i] = arg_position(backend::simd::detail::arg_extremum<Max>(x + i * len, len));
+    });
+}
+
+// arg_across: out[j] = line holding the extremum of x[i * len + j] over the lines i, for j < len.
+// A band holds at most arg_steps lines, so the line offsets it keeps in TN are exact.
+template <bool Max, typename TN>
+void arg_across(const TN* x, std::size_t lines, std::size_t len, std::int64_t* out)
+{
+    namespace simd = backend::simd;
+    using P = simd::pack<TN>;
+
+    const std::size_t width = std::min(len, reduce_dim_tile_width);
+    const std::size_t depth = std::clamp<std::size_t>(backend::cpu::reduce_grain / width, 1, simd::detail::arg_steps<TN>);
+    const std::size_t bands = (lines + depth - 1) / depth;
+    const std::size_t slices = (len + width - 1) / width;
+
+    // Band b keeps its best values in best[b len, (b + 1) len) and their line offsets in step.
+    std::vector<TN> best(bands * len), step(bands * len);
+    backend::parallel::parallel_for(0, bands * slices, 1, [&](std::size_t t0, std::size_t t1) {
+        for (std::size_t t = t0; t < t1; ++t)
+        {
+            const std::size_t b = t / slices, j0 = (t % slices) * width;
+            const std::size_t j1 = std::min(j0 + width, len);
+            const std::size_t i0 = b * depth, i1 = std::min(lines, i0 + depth);
+            TN* bv = best.data() + b * len;
+            TN* bs = step.data() + b * len;
+
+            std::copy(x + i0 * len + j0, x + i0 * len + j1, bv + j0);
+            std::fill(bs + j0, bs + j1, TN(0));
+            for (std::size_t i = i0 + 1; i < i1; ++i)
+            {
+                const P s(static_cast<TN>(i - i0));
+                const TN* line = x + i * len;
+                simd::for_each_pack<TN>(j0, j1, [&](std::size_t j, auto io) {
+                    const P v = io.load(line + j), cur = io.load(bv + j);
+                    const auto m = simd::detail::arg_better<Max>(v, cur);
+                    io.store(bv + j, select(m, v, cur));
+                    io.store(bs + j, select(m, s, io.load(bs + j)));
+                });
+            }
+        }
+    });
+
+    // Later bands hold later lines, so they only win strictly.
+    for (std::size_t j = 0; j < len; ++j)
+    {
+        std::size_t win = 0;
+        for (std::size_t b = 1; b < bands; ++b)
+            if (simd::detail::arg_better<Max>(best[b * len + j], best[win * len + j]))
+                win = b;
+        out[j] = static_cast<std::int64_t>(win * depth + static_cast<std::size_t>(step[win * len + j]));
+    }
+}
+
+// arg_dim: Positions of the extrema along `axis` of a; a 1 x cols row for Axis::Rows (row
+// indices), a rows x 1 column for Axis::Cols (column indices), in a's layout.
+template <bool Max, int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+core::matrix::SDDenseMatrix<-1, -1, std::int64_t, Major> arg_dim(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a, Axis axis)
+{
+    constexpr bool row_major = Major == core::matrix::SDMajor::RowMajor;
+    const std::size_t lines = row_major ? a.rows() : a.cols();
+    const std::size_t len = row_major ? a.cols() : a.rows();
+
+    core::matrix::SDDenseMatrix<-1, -1, std::int64_t, Major> out(axis == Axis::Rows ? 1 : a.rows(), axis == Axis::Rows ? a.cols() : 1);
+    if ((axis == Axis::Cols) == row_major)
+    {
+        if (len == 0)
+            std::fill(out.data(), out.data() + out.size(), std::int64_t(-1));
+        else
+            arg_along<Max>(a.data(), lines, len, out.data());
+    }
+    else if (lines == 0)
+        std::fill(out.data(), out.data() + out.size(), std::int64_t(-1));
+    else if (len > 0)
+        arg_across<Max>(a.data(), lines, len, out.data());
+    return out;
+}
+
+} // namespace detail
+
+} // namespace senkaid::ops::reduce
@@ -0,0 +1,40 @@
+#pragma once
+
+// argmin.hpp: Position of the smallest element of a buffer or dense matrix, whole or along an axis.
+// Value and position lanes are tracked together in SIMD registers (arg_reduce.hpp). Ties give
+// the first occurrence, a NaN beats every number (the first NaN is reported), and an empty
+// input gives -1.
+
+#include <senkaid/utils/config/root.hpp>
+#include <senkaid/core/matrix/dense.hpp>
+#include "arg_reduce.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace senkaid::ops::reduce
+{
+
+// argmin: Position of the first smallest element of x[0, n).
+template <typename TN>
+std::int64_t argmin(const TN* x, std::size_t n)
+{
+    return detail::arg_whole<false>(x, n);
+}
+
+// argmin: Position in storage order (data()[i]) of the first smallest entry of `a`.
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+std::int64_t argmin(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a)
+{
+    return detail::arg_whole<false>(a.data(), a.size());
+}
+
+// argmin: Positions of the smallest entries along `axis` of `a`: row indices in a 1 x cols row for
+// Axis::Rows, column indices in a rows x 1 column for Axis::Cols.
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+core::matrix::SDDenseMatrix<-1, -1, std::int64_t, Major> argmin(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a, Axis axis)
+{
+    return detail::arg_dim<false>(a, axis);
+}
+
+} // namespace senkaid::ops::reduce
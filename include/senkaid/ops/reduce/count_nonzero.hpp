@@ -0,0 +1,80 @@
+#pragma once
+
+// count_nonzero.hpp: Number of non-zero elements of a buffer or dense matrix.
+// Each native pack is compared against zero and the lane mask is counted with one popcount, so
+// there is no per-element branch; the ragged end is one masked load whose inactive lanes read as
+// zero. NaN counts as non-zero and -0.0 as zero. Large buffers are split across the thread pool,
+// one partial count per chunk.
+//
+// A BitMask (ops/logical/bit_mask.hpp) is counted a word at a time.
+//
+//   std::size_t nnz = ops::reduce::count_nonzero(a);
+
+#include <senkaid/utils/config/root.hpp>
+#include <senkaid/core/matrix/dense.hpp>
+#include <senkaid/backend/simd/simd_load_store.hpp>
+#include <senkaid/backend/parallel/parallel_for.hpp>
+#include <senkaid/ops/logical/bit_mask.hpp>
+
+#include <atomic>
+#include <cstddef>
+
+namespace senkaid::ops::reduce
+{
+
+// count_grain: Elements per parallel chunk; counting 64K doubles takes a few microseconds.
+inline constexpr std::size_t count_grain = 64 * 1024;
+
+namespace detail
+{
+
+// count_nonzero_range: Non-zero elements of x[lo, hi) on the calling thread.
+template <typename TN>
+std::size_t count_nonzero_range(const TN* x, std::size_t lo, std::size_t hi)
+{
+    using P = backend::simd::pack<TN>;
+    constexpr std::size_t L = P::lanes;
+
+    const P z = P::zero();
+    std::size_t c0 = 0, c1 = 0;
+
+    std::size_t i = lo;
+    for (; i + 2 * L <= hi; i += 2 * L)
+    {
+        c0 += (P::loadu(x + i) != z).count();
+        c1 += (P::loadu(x + i + L) != z).count();
+    }
+    backend::simd::for_each_pack<TN>(i, hi, [&](std::size_t k, auto io) {
+        c0 += (io.load(x + k) != z).count();
+    });
+
+    return c0 + c1;
+}
+
+} // namespace detail
+
+// count_nonzero: Elements of x[0, n) that compare unequal to zero.
+template <typename TN>
+std::size_t count_nonzero(const TN* x, std::size_t n)
+{
+    std::atomic<std::size_t> total{0};
+    backend::parallel::parallel_for(0, n, count_grain, [&](std::size_t lo, std::size_t hi) {
+        total.fetch_add(detail::count_nonzero_range(x, lo, hi), std::memory_order_relaxed);
+    });
+    return total.load(std::memory_order_relaxed);
+}
+
+// count_nonzero: Non-zero entries of a dense matrix.
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+std::size_t count_nonzero(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a)
+{
+    return count_nonzero(a.data(), a.size());
+}
+
+// count_nonzero: Set bits of a mask.
+inline std::size_t count_nonzero(const logical::BitMask& m)
+{
+    return m.count();
+}
+
+} // namespace senkaid::ops::reduce
@@ -0,0 +1,39 @@
+#pragma once
+
+// max.hpp: The largest element of a buffer or dense matrix.
+// Multi-accumulator vector kernel (backend/simd/simd_reduction.hpp) spread over the thread pool.
+// max(a, axis) reduces along one axis (reduce_dim.hpp).
+// The result is NaN if any element is NaN; an empty input yields -inf (or the integer limit).
+
+#include <senkaid/utils/config/root.hpp>
+#include <senkaid/core/matrix/dense.hpp>
+#include <senkaid/backend/cpu/reduce_cpu.hpp>
+#include "reduce_dim.hpp"
+
+#include <cstddef>
+
+namespace senkaid::ops::reduce
+{
+
+// max: The largest of x[0, n).
+template <typename TN>
+TN max(const TN* x, std::size_t n)
+{
+    return backend::cpu::max(x, n);
+}
+
+// max: The largest entry of `a`.
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+TN max(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a)
+{
+    return backend::cpu::max(a.data(), a.size());
+}
+
+// max: The largest entry along `axis` of `a` (see reduce_dim.hpp).
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+core::matrix::SDDenseMatrix<-1, -1, TN, Major> max(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a, Axis axis)
+{
+    return reduce(a, axis, Max{});
+}
+
+} // namespace senkaid::ops::reduce
@@ -0,0 +1,73 @@
+#pragma once
+
+// mean.hpp: Arithmetic means of buffers and dense matrices, whole or along an axis.
+// Floating-point means divide the blocked sum of backend/cpu/reduce_cpu.hpp by the count, so they
+// are as accurate and as fast as sum(). Integer elements are averaged in double: an integer sum
+// can overflow and a truncated quotient is rarely wanted, so they take the one-pass running mean
+// of moments.hpp instead. The mean of no elements is NaN.
+//
+//   double m = ops::reduce::mean(a);
+//   double k = ops::reduce::mean(counts.data(), counts.size());      // int elements
+//   auto row_means = ops::reduce::mean(a, ops::reduce::Axis::Cols);
+
+#include <senkaid/utils/config/root.hpp>
+#include <senkaid/core/matrix/dense.hpp>
+#include <senkaid/backend/cpu/reduce_cpu.hpp>
+#include "reduce_dim.hpp"
+#include "moments.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace senkaid::ops::reduce
+{
+
+// mean: (x[0] + ... + x[n - 1]) / n.
+template <typename TN>
+moment_type<TN> mean(const TN* x, std::size_t n)
+{
+    if (n == 0)
+        return std::numeric_limits<moment_type<TN>>::quiet_NaN();
+    if constexpr (std::is_floating_point_v<TN>)
+        return backend::cpu::sum(x, n) / static_cast<TN>(n);
+    else
+        return backend::cpu::moments(x, n).mean;
+}
+
+// mean: Mean of every entry of `a`.
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+moment_type<TN> mean(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a)
+{
+    return mean(a.data(), a.size());
+}
+
+// mean: Means along `axis` of `a`; a 1 x cols row for Axis::Rows, a rows x 1 column for Axis::Cols.
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+core::matrix::SDDenseMatrix<-1, -1, moment_type<TN>, Major> mean(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a, Axis axis)
+{
+    using R = moment_type<TN>;
+    const std::size_t count = axis == Axis::Rows ? a.rows() : a.cols();
+
+    core::matrix::SDDenseMatrix<-1, -1, R, Major> out;
+    if constexpr (std::is_floating_point_v<TN>)
+        out = reduce(a, axis, Add{});
+    else
+    {
+        out = core::matrix::SDDenseMatrix<-1, -1, R, Major>(axis == Axis::Rows ? 1 : a.rows(), axis == Axis::Rows ? a.cols() : 1);
+        std::vector<R> m2(out.size());
+        detail::axis_moments(a, axis, out.data(), m2.data());
+    }
+
+    R* o = out.data();
+    if (count == 0)
+        std::fill(o, o + out.size(), std::numeric_limits<R>::quiet_NaN());
+    else if constexpr (std::is_floating_point_v<TN>)
+        for (std::size_t i = 0; i < out.size(); ++i)
+            o[i] /= static_cast<R>(count);
+    return out;
+}
+
+} // namespace senkaid::ops::reduce
@@ -0,0 +1,39 @@
+#pragma once
+
+// min.hpp: The smallest element of a buffer or dense matrix.
+// Multi-accumulator vector kernel (backend/simd/simd_reduction.hpp) spread over the thread pool.
+// min(a, axis) reduces along one axis (reduce_dim.hpp).
+// The result is NaN if any element is NaN; an empty input yields +inf (or the integer limit).
+
+#include <senkaid/utils/config/root.hpp>
+#include <senkaid/core/matrix/dense.hpp>
+#include <senkaid/backend/cpu/reduce_cpu.hpp>
+#include "reduce_dim.hpp"
+
+#include <cstddef>
+
+namespace senkaid::ops::reduce
+{
+
+// min: The smallest of x[0, n).
+template <typename TN>
+TN min(const TN* x, std::size_t n)
+{
+    return backend::cpu::min(x, n);
+}
+
+// min: The smallest entry of `a`.
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+TN min(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a)
+{
+    return backend::cpu::min(a.data(), a.size());
+}
+
+// min: The smallest entry along `axis` of `a` (see reduce_dim.hpp).
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+core::matrix::SDDenseMatrix<-1, -1, TN, Major> min(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a, Axis axis)
+{
+    return reduce(a, axis, Min{});
+}
+
+} // namespace senkaid::ops::reduce
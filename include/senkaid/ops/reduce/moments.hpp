@@ -0,0 +1,236 @@
+#pragma once
+
+// moments.hpp: One-pass, mergeable mean and variance, over a whole buffer or along an axis.
+// The data is read once. Every SIMD lane runs Welford's recurrence and the lanes, blocks and
+// threads are combined with Chan's update (backend/simd/simd_reduction.hpp, moment_parts), so
+// there is neither the second pass of the textbook variance nor the cancellation of
+// sum(x^2) - n mean^2. Moments keeps that state between calls for data arriving in chunks, and
+// two accumulators (threads, shards) merge into the statistics of the union. Along an axis the
+// traversal follows the layout as in reduce_dim.hpp: contiguous lines are reduced one each;
+// across lines, each column keeps a running mean and m2 updated a whole line at a time, in
+// fixed tiles whose bands are merged in order. Integer elements give double statistics.
+//
+//   ops::reduce::Moments<double> m;
+//   for (const auto& chunk : chunks)
+//       m.update(chunk.data(), chunk.size());
+//   double s = m.stddev();
+//   auto col_var = ops::reduce::variance(a, ops::reduce::Axis::Rows);     // variance.hpp
+
+#include <senkaid/utils/config/root.hpp>
+#include <senkaid/core/matrix/dense.hpp>
+#include <senkaid/backend/simd/simd_reduction.hpp>
+#include <senkaid/backend/simd/simd_load_store.hpp>
+#include <senkaid/backend/cpu/reduce_cpu.hpp>
+#include <senkaid/backend/parallel/parallel_for.hpp>
+#include "reduce_dim.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace senkaid::ops::reduce
+{
+
+// moment_type: Element type of means and variances of TN; double for integers.
+template <typename TN>
+using moment_type = backend::simd::moment_value_t<TN>;
+
+// Moments: Count, mean and variance of the values fed to it so far.
+template <typename TN>
+class Moments
+{
+public:
+    using value_type = moment_type<TN>;
+    using parts_type = backend::simd::moment_parts<value_type>;
+
+    Moments() = default;
+
+    explicit Moments(const parts_type& parts) noexcept : _parts(parts) {}
+
+    // update: Adds x[0, n) (one pass over the thread pool), a single value, or every entry of a.
+    Moments& update(const TN* x, std::size_t n)
+    {
+        _parts.merge(backend::cpu::moments(x, n));
+        return *this;
+    }
+
+    Moments& update(TN x) noexcept
+    {
+        _parts.add(static_cast<value_type>(x));
+        return *this;
+    }
+
+    template <int Rows, int Cols, core::matrix::SDMajor Major>
+    Moments& update(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a)
+    {
+        return update(a.data(), a.size());
+    }
+
+    // merge: Adds the values seen by `other`.
+    Moments& merge(const Moments& other) noexcept
+    {
+        _parts.merge(other._parts);
+        return *this;
+    }
+
+    std::size_t count() const noexcept { return _parts.count; }
+
+    // mean: NaN if no value was added.
+    value_type mean() const noexcept
+    {
+        return _parts.count > 0 ? _parts.mean : std::numeric_limits<value_type>::quiet_NaN();
+    }
+
+    // variance: m2 / (count - 1) if unbiased, else m2 / count; NaN with too few values.
+    value_type variance(bool unbiased = true) const noexcept { return _parts.variance(unbiased ? 1 : 0); }
+
+    value_type stddev(bool unbiased = true) const noexcept { return std::sqrt(variance(unbiased)); }
+
+    const parts_type& parts() const noexcept { return _parts; }
+
+private:
+    parts_type _parts;
+};
+
+// moments: Moments of x[0, n), or of every entry of a.
+template <typename TN>
+Moments<TN> moments(const TN* x, std::size_t n)
+{
+    return Moments<TN>(backend::cpu::moments(x, n));
+}
+
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+Moments<TN> moments(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a)
+{
+    return moments(a.data(), a.size());
+}
+
+namespace detail
+{
+
+// moments_along: mean[i] and m2[i] of each of `lines` contiguous lines of length len.
+template <typename TN, typename R>
+void moments_along(const TN* x, std::size_t lines, std::size_t len, R* mean, R* m2)
+{
+    constexpr std::size_t grain = backend::cpu::reduce_grain;
+
+    const auto line = [&](std::size_t i, const backend::simd::moment_parts<R>& p) {
+        mean[i] = p.mean;
+        m2[i] = p.m2;
+    };
+    if (len >= 2 * grain)
+    {
+        for (std::size_t i = 0; i < lines; ++i)
+            line(i, backend::cpu::moments(x + i * len, len));
+        return;
+    }
+
+    backend::parallel::parallel_for(0, lines, std::max<std::size_t>(1, grain / len), [&](std::size_t lo, std::size_t hi) {
+        for (std::size_t i = lo; i < hi; ++i)
+            line(i, backend::simd::moments_partial(x + i * len, len));
+    });
+}
+
+// welford_line: One Welford step of columns [j0, j1) with the line `v` shifted by the line
+// `s`, v being the c-th line of the band.
+template <typename TN, typename R>
+SENKAID_FORCE_INLINE void welford_line(R* mean, R* m2, const TN* v, const TN* s, std::size_t j0, std::size_t j1, std::size_t c)
+{
+    const R w = R(1) / static_cast<R>(c);
+    if constexpr (std::is_same_v<TN, R>)
+    {
+        using P = backend::simd::pack<R>;
+        backend::simd::for_each_pack<R>(j0, j1, [&](std::size_t j, auto io) {
+            const P x = io.load(v + j) - io.load(s + j), m = io.load(mean + j);
+            const P d = x - m, mn = fma(d, P(w), m);
+            io.store(mean + j, mn);
+            io.store(m2 + j, fma(d, x - mn, io.load(m2 + j)));
+        });
+    }
+    else
+        for (std::size_t j = j0; j < j1; ++j)
+        {
+            const R x = static_cast<R>(v[j]) - static_cast<R>(s[j]);
+            const R d = x - mean[j];
+            mean[j] += d * w;
+            m2[j] += d * (x - mean[j]);
+        }
+}
+
+// chan_line: Merges the column states (mb, qb) over nb lines into (ma, qa) over na lines.
+template <typename R>
+SENKAID_FORCE_INLINE void chan_line(R* ma, R* qa, const R* mb, const R* qb, std::size_t len, std::size_t na, std::size_t nb)
+{
+    using P = backend::simd::pack<R>;
+    const R f = static_cast<R>(nb) / static_cast<R>(na + nb);
+    const R g = static_cast<R>(na) * f;
+    backend::simd::for_each_pack<R>(0, len, [&](std::size_t j, auto io) {
+        const P a = io.load(ma + j);
+        const P d = io.load(mb + j) - a;
+        io.store(ma + j, fma(d, P(f), a));
+        io.store(qa + j, fma(d * d, P(g), io.load(qa + j) + io.load(qb + j)));
+    });
+}
+
+// moments_across: mean[j] and m2[j] over the lines i of x[i * len + j], for j < len. Each band
+// works relative to its first line, added back to its means once the band is done.
+template <typename TN, typename R>
+void moments_across(const TN* x, std::size_t lines, std::size_t len, R* mean, R* m2)
+{
+    const std::size_t width = std::min(len, reduce_dim_tile_width);
+    const std::size_t depth = std::max<std::size_t>(1, backend::cpu::reduce_grain / width);
+    const std::size_t bands = (lines + depth - 1) / depth;
+    const std::size_t slices = (len + width - 1) / width;
+
+    // Band 0 runs in mean / m2; band b > 0 in partial[2 (b - 1) len, 2 b len), means first.
+    std::fill(mean, mean + len, R(0));
+    std::fill(m2, m2 + len, R(0));
+    std::vector<R> partial(bands > 1 ? 2 * (bands - 1) * len : 0, R(0));
+    const auto band_mean = [&](std::size_t b) { return b == 0 ? mean : partial.data() + 2 * (b - 1) * len; };
+    const auto band_m2 = [&](std::size_t b) { return b == 0 ? m2 : partial.data() + (2 * b - 1) * len; };
+
+    backend::parallel::parallel_for(0, bands * slices, 1, [&](std::size_t t0, std::size_t t1) {
+        for (std::size_t t = t0; t < t1; ++t)
+        {
+            const std::size_t b = t / slices, j0 = (t % slices) * width;
+            const std::size_t j1 = std::min(j0 + width, len);
+            const std::size_t i0 = b * depth, i1 = std::min(lines, i0 + depth);
+            R* mb = band_mean(b);
+            for (std::size_t i = i0; i < i1; ++i)
+                welford_line(mb, band_m2(b), x + i * len, x + i0 * len, j0, j1, i - i0 + 1);
+            for (std::size_t j = j0; j < j1; ++j)
+                mb[j] += static_cast<R>(x[i0 * len + j]);
+        }
+    });
+
+    for (std::size_t b = 1; b < bands; ++b)
+        chan_line(mean, m2, band_mean(b), band_m2(b), len, b * depth, std::min(lines, (b + 1) * depth) - b * depth);
+}
+
+// axis_moments: mean and m2 along `axis` of a (cols entries for Axis::Rows, rows for Axis::Cols);
+// returns the number of values behind each.
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major, typename R>
+std::size_t axis_moments(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a, Axis axis, R* mean, R* m2)
+{
+    constexpr bool row_major = Major == core::matrix::SDMajor::RowMajor;
+    const std::size_t lines = row_major ? a.rows() : a.cols();
+    const std::size_t len = row_major ? a.cols() : a.rows();
+    const bool along = (axis == Axis::Cols) == row_major;
+
+    if (along)
+    {
+        if (len > 0)
+            moments_along(a.data(), lines, len, mean, m2);
+        return len;
+    }
+    if (len > 0)
+        moments_across(a.data(), lines, len, mean, m2);
+    return lines;
+}
+
+} // namespace detail
+
+} // namespace senkaid::ops::reduce
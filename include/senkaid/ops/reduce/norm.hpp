@@ -0,0 +1,45 @@
+#pragma once
+
+// norm.hpp: Vector p-norms of buffers, and entrywise p-norms of dense matrices.
+// The 2-norm is one pass of Blue's algorithm (backend/simd/simd_reduction.hpp): squares are
+// accumulated unscaled unless a pack holds a magnitude whose square would overflow or underflow,
+// so there is no separate scaling pass, and inputs near the limits of the type still give a
+// correctly scaled result. The 1- and inf-norms are one pass as well; other orders divide by the
+// largest magnitude first. All of them run across the thread pool (backend/cpu/reduce_cpu.hpp).
+// Induced matrix norms (one, inf) live in ops/linalg/norm.hpp.
+//
+//   double r = ops::reduce::norm(x, n);          // 2-norm
+//   double m = ops::reduce::norm(a, 1.0);        // sum of |a(i, j)|
+
+#include <senkaid/utils/config/root.hpp>
+#include <senkaid/utils/debug/root.hpp>
+#include <senkaid/core/matrix/dense.hpp>
+#include <senkaid/backend/cpu/reduce_cpu.hpp>
+
+#include <cstddef>
+#include <limits>
+
+namespace senkaid::ops::reduce
+{
+
+// norm: (|x[0]|^p + ... + |x[n - 1]|^p)^(1/p); p = inf gives max |x[i]|. NaN if any element is
+// NaN, 0 if n == 0. p must be at least 1.
+template <typename TN>
+TN norm(const TN* x, std::size_t n, TN p = TN(2))
+{
+    if (SENKAID_UNLIKELY(!(p >= TN(1))))
+    {
+        SENKAID_LOG_ERROR("norm: order must be at least 1");
+        return std::numeric_limits<TN>::quiet_NaN();
+    }
+    return backend::cpu::norm(x, n, p);
+}
+
+// norm: Entrywise p-norm of `a`; p = 2 is the Frobenius norm.
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+TN norm(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a, TN p = TN(2))
+{
+    return norm(a.data(), a.size(), p);
+}
+
+} // namespace senkaid::ops::reduce
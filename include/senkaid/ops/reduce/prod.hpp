@@ -0,0 +1,42 @@
+#pragma once
+
+// prod.hpp: Products of the elements of a buffer or dense matrix, in full or along one axis.
+// Multi-accumulator vector kernel of reduce_generic.hpp spread over the thread pool; axis
+// products go through reduce_dim.hpp. No rescaling: products overflow and underflow like the
+// scalar loop. An empty input yields 1.
+//
+//   double p = ops::reduce::prod(a);
+//   auto row_prods = ops::reduce::prod(a, ops::reduce::Axis::Cols);
+
+#include <senkaid/utils/config/root.hpp>
+#include <senkaid/core/matrix/dense.hpp>
+#include "reduce_generic.hpp"
+#include "reduce_dim.hpp"
+
+#include <cstddef>
+
+namespace senkaid::ops::reduce
+{
+
+// prod: x[0] * ... * x[n - 1].
+template <typename TN>
+TN prod(const TN* x, std::size_t n)
+{
+    return reduce(x, n, Mul{});
+}
+
+// prod: Product of every entry of `a`.
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+TN prod(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a)
+{
+    return reduce(a.data(), a.size(), Mul{});
+}
+
+// prod: Products along `axis` of `a`.
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+core::matrix::SDDenseMatrix<-1, -1, TN, Major> prod(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a, Axis axis)
+{
+    return reduce(a, axis, Mul{});
+}
+
+} // namespace senkaid::ops::reduce
@@ -0,0 +1,170 @@
+#pragma once
+
+// reduce_dim.hpp: Reductions of a dense matrix along one axis, with the traversal chosen by layout.
+// Axis::Rows collapses the row index (one result per column, a 1 x cols row); Axis::Cols collapses
+// the column index (one result per row, a rows x 1 column). Whether that runs along or across the
+// contiguous lines of the storage decides the kernel:
+//   along  - Each line is one vector reduction (reduce_generic.hpp) into its own result. Lines
+//            are spread over the thread pool; a line of two or more reduce_grain blocks is itself
+//            split over the pool, one line after another.
+//   across - Whole lines are combined pack by pack into a line of partial results, so memory is
+//            read in order. Work is cut into tiles of at most reduce_dim_tile_width columns times a
+//            band of lines; each band keeps its own partials, which are combined in band order.
+// Tile and block shapes are fixed, so results do not depend on the thread count.
+//
+//   auto col_sums = ops::reduce::reduce(a, ops::reduce::Axis::Rows, ops::reduce::Add{});
+//   auto row_max = ops::reduce::max(a, ops::reduce::Axis::Cols);
+
+#include <senkaid/utils/config/root.hpp>
+#include <senkaid/core/matrix/dense.hpp>
+#include <senkaid/backend/simd/simd_reduction.hpp>
+#include <senkaid/backend/simd/simd_load_store.hpp>
+#include <senkaid/backend/cpu/reduce_cpu.hpp>
+#include <senkaid/backend/parallel/parallel_for.hpp>
+#include "reduce_generic.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace senkaid::ops::reduce
+{
+
+// Axis: The index a reduction collapses.
+enum class Axis : uint8_t
+{
+    Rows = 0x01,    // One result per column.
+    Cols = 0x02     // One result per row.
+};
+
+// reduce_dim_tile_width: Columns of partial results one tile keeps while reducing across lines.
+inline constexpr std::size_t reduce_dim_tile_width = 1024;
+
+namespace detail
+{
+
+// line_value: op over one contiguous line on the calling thread; Add, Min and Max use the
+// dedicated kernels of the full reductions.
+template <typename TN, typename Op>
+SENKAID_FORCE_INLINE TN line_value(const TN* x, std::size_t len, const Op& op, TN identity)
+{
+    if constexpr (std::is_arithmetic_v<TN> && std::is_same_v<Op, Add>)
+        return backend::simd::sum_partial(x, len).value();
+    else if constexpr (std::is_arithmetic_v<TN> && std::is_same_v<Op, Min>)
+        return backend::simd::reduce_min(x, len);
+    else if constexpr (std::is_arithmetic_v<TN> && std::is_same_v<Op, Max>)
+        return backend::simd::reduce_max(x, len);
+    else
+        return reduce_serial(x, len, op, identity);
+}
+
+// along_lines: out[i] = op over line i, for `lines` contiguous lines of length len.
+template <typename TN, typename Op>
+void along_lines(const TN* x, std::size_t lines, std::size_t len, TN* out, const Op& op, TN identity)
+{
+    constexpr std::size_t grain = backend::cpu::reduce_grain;
+
+    if (len >= 2 * grain)
+    {
+        for (std::size_t i = 0; i < lines; ++i)
+            out[i] = backend::cpu::detail::reduce_blocks(
+                x + i * len, len, [&](const TN* p, std::size_t m) { return line_value(p, m, op, identity); },
+                [&](TN& acc, TN r) { acc = op(acc, r); });
+        return;
+    }
+
+    backend::parallel::parallel_for(0, lines, std::max<std::size_t>(1, grain / std::max<std::size_t>(len, 1)),
+                                    [&](std::size_t lo, std::size_t hi) {
+                                        for (std::size_t i = lo; i < hi; ++i)
+                                            out[i] = line_value(x + i * len, len, op, identity);
+                                    });
+}
+
+// combine_line: acc[j] = op(acc[j], line[j]) for j in [j0, j1).
+template <typename TN, typename Op>
+SENKAID_FORCE_INLINE void combine_line(TN* acc, const TN* line, std::size_t j0, std::size_t j1, const Op& op)
+{
+    if constexpr (pack_op<Op, TN>)
+        backend::simd::for_each_pack<TN>(j0, j1, [&](std::size_t j, auto io) {
+            io.store(acc + j, op(io.load(acc + j), io.load(line + j)));
+        });
+    else
+        for (std::size_t j = j0; j < j1; ++j)
+            acc[j] = op(acc[j], line[j]);
+}
+
+// across_lines: out[j] = op over the lines i of x[i * len + j], for j < len.
+template <typename TN, typename Op>
+void across_lines(const TN* x, std::size_t lines, std::size_t len, TN* out, const Op& op, TN identity)
+{
+    const std::size_t width = std::min(len, reduce_dim_tile_width);
+    const std::size_t depth = std::max<std::size_t>(1, backend::cpu::reduce_grain / width);
+    const std::size_t bands = (lines + depth - 1) / depth;
+    const std::size_t slices = (len + width - 1) / width;
+
+    // Band 0 accumulates straight into out; band b > 0 into partial[(b - 1) * len, b * len).
+    std::fill(out, out + len, identity);
+    std::vector<TN> partial(bands > 1 ? (bands - 1) * len : 0, identity);
+    const auto band_acc = [&](std::size_t b) { return b == 0 ? out : partial.data() + (b - 1) * len; };
+
+    backend::parallel::parallel_for(0, bands * slices, 1, [&](std::size_t t0, std::size_t t1) {
+        for (std::size_t t = t0; t < t1; ++t)
+        {
+            const std::size_t b = t / slices, j0 = (t % slices) * width;
+            const std::size_t j1 = std::min(j0 + width, len);
+            TN* acc = band_acc(b);
+            for (std::size_t i = b * depth; i < std::min(lines, (b + 1) * depth); ++i)
+                combine_line(acc, x + i * len, j0, j1, op);
+        }
+    });
+
+    for (std::size_t b = 1; b < bands; ++b)
+        combine_line(out, band_acc(b), 0, len, op);
+}
+
+} // namespace detail
+
+// reduce: op along `axis` of a rows x cols matrix stored at x (row-major if row_major), written to
+// out: cols results for Axis::Rows, rows results for Axis::Cols. Empty reductions give identity.
+template <typename TN, typename Op>
+void reduce(const TN* x, std::size_t rows, std::size_t cols, bool row_major, Axis axis, Op op, TN identity, TN* out)
+{
+    // Lines are the contiguous rows (row-major) or columns (column-major) of the storage.
+    const std::size_t lines = row_major ? rows : cols;
+    const std::size_t len = row_major ? cols : rows;
+    const bool along = (axis == Axis::Cols) == row_major;
+
+    if (len == 0)
+    {
+        if (along)
+            std::fill(out, out + lines, identity);
+        return;
+    }
+
+    if (along)
+        detail::along_lines(x, lines, len, out, op, identity);
+    else
+        detail::across_lines(x, lines, len, out, op, identity);
+}
+
+// reduce: op along `axis` of `a`; a 1 x cols row for Axis::Rows, a rows x 1 column for Axis::Cols,
+// in a's layout.
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major, typename Op>
+core::matrix::SDDenseMatrix<-1, -1, TN, Major> reduce(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a, Axis axis, Op op,
+                                                      TN identity)
+{
+    core::matrix::SDDenseMatrix<-1, -1, TN, Major> out(axis == Axis::Rows ? 1 : a.rows(), axis == Axis::Rows ? a.cols() : 1);
+    reduce(a.data(), a.rows(), a.cols(), Major == core::matrix::SDMajor::RowMajor, axis, op, identity, out.data());
+    return out;
+}
+
+// reduce: With one of the functors of reduce_generic.hpp, whose identity is implied.
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major, typename Op>
+core::matrix::SDDenseMatrix<-1, -1, TN, Major> reduce(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a, Axis axis, Op op)
+{
+    return reduce(a, axis, op, Op::template identity<TN>());
+}
+
+} // namespace senkaid::ops::reduce
@@ -0,0 +1,163 @@
+#pragma once
+
+// reduce_generic.hpp: Reductions by a user-supplied associative operation and its identity.
+// op(a, b) is applied to SIMD packs when it is callable with them (the functors below are, and so
+// is any generic lambda, whose body must then compile for packs), with reduction_accumulators
+// independent pack accumulators and the ragged end filled with the identity; an op taking
+// elements only, e.g. [](int a, int b) { ... }, runs a scalar loop. Buffers are cut into fixed
+// blocks spread over the thread pool and the block results are combined in order, so a result
+// does not depend on the thread count. Add, Min and Max go to the dedicated kernels of
+// backend/cpu/reduce_cpu.hpp (blocked summation, NaN propagation).
+//
+//   double p = ops::reduce::reduce(x, n, ops::reduce::Mul{});
+//   int    o = ops::reduce::reduce(v, n, [](int a, int b) { return a | b; }, 0);
+
+#include <senkaid/utils/config/root.hpp>
+#include <senkaid/core/matrix/dense.hpp>
+#include <senkaid/backend/simd/simd_reduction.hpp>
+#include <senkaid/backend/cpu/reduce_cpu.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+namespace senkaid::ops::reduce
+{
+
+// Reduction functors: op(a, b) on packs and single elements, and identity<TN>() with
+// op(identity, x) == x. Min and Max let a NaN on either side win.
+struct Add
+{
+    template <typename TN>
+    static constexpr TN identity() noexcept { return TN(0); }
+
+    template <typename P>
+    SENKAID_FORCE_INLINE P operator()(P a, P b) const noexcept { return a + b; }
+};
+
+struct Mul
+{
+    template <typename TN>
+    static constexpr TN identity() noexcept { return TN(1); }
+
+    template <typename P>
+    SENKAID_FORCE_INLINE P operator()(P a, P b) const noexcept { return a * b; }
+};
+
+struct Min
+{
+    template <typename TN>
+    static constexpr TN identity() noexcept { return backend::simd::detail::extremum_identity<false, TN>(); }
+
+    template <typename P>
+    SENKAID_FORCE_INLINE P operator()(P a, P b) const noexcept
+    {
+        if constexpr (std::is_arithmetic_v<P>)
+            return (b != b || b < a) ? b : a;
+        else
+            return select((b != b) | (b < a), b, a);
+    }
+};
+
+struct Max
+{
+    template <typename TN>
+    static constexpr TN identity() noexcept { return backend::simd::detail::extremum_identity<true, TN>(); }
+
+    template <typename P>
+    SENKAID_FORCE_INLINE P operator()(P a, P b) const noexcept
+    {
+        if constexpr (std::is_arithmetic_v<P>)
+            return (b != b || a < b) ? b : a;
+        else
+            return select((b != b) | (a < b), b, a);
+    }
+};
+
+namespace detail
+{
+
+// pack_op: op combines packs of TN.
+template <typename Op, typename TN>
+concept pack_op = std::is_arithmetic_v<TN> && requires(const Op& op, backend::simd::pack<TN> p) {
+    { op(p, p) } -> std::convertible_to<backend::simd::pack<TN>>;
+};
+
+// reduce_serial: op over x[0, n) starting from identity, on one thread.
+template <typename TN, typename Op>
+TN reduce_serial(const TN* x, std::size_t n, const Op& op, TN identity)
+{
+    if constexpr (pack_op<Op, TN>)
+    {
+        namespace simd = backend::simd;
+        using P = simd::pack<TN>;
+        using M = typename P::mask_type;
+        constexpr std::size_t K = simd::reduction_accumulators;
+
+        P acc[K];
+        for (auto& a : acc)
+            a = P(identity);
+        simd::detail::fold<P, K>(
+            x, n, [&](std::size_t k, P v) { acc[k] = op(acc[k], v); },
+            [&](P v, M m) { acc[0] = op(acc[0], select(m, v, P(identity))); });
+
+        for (std::size_t w = K / 2; w > 0; w /= 2)
+            for (std::size_t k = 0; k < w; ++k)
+                acc[k] = op(acc[k], acc[k + w]);
+
+        alignas(64) TN lanes[P::lanes];
+        acc[0].storeu(lanes);
+        TN r = lanes[0];
+        for (std::size_t l = 1; l < P::lanes; ++l)
+            r = op(r, lanes[l]);
+        return r;
+    }
+    else
+    {
+        TN r = identity;
+        for (std::size_t i = 0; i < n; ++i)
+            r = op(r, x[i]);
+        return r;
+    }
+}
+
+} // namespace detail
+
+// reduce: identity op x[0] op ... op x[n - 1], for an associative op; identity on an empty buffer.
+template <typename TN, typename Op>
+TN reduce(const TN* x, std::size_t n, Op op, TN identity)
+{
+    if (n == 0)
+        return identity;
+    return backend::cpu::detail::reduce_blocks(
+        x, n, [&](const TN* p, std::size_t m) { return detail::reduce_serial(p, m, op, identity); },
+        [&](TN& acc, TN r) { acc = op(acc, r); });
+}
+
+// reduce: With one of the functors above, whose identity is implied.
+template <typename TN, typename Op>
+TN reduce(const TN* x, std::size_t n, Op op)
+{
+    if constexpr (std::is_arithmetic_v<TN> && std::is_same_v<Op, Add>)
+        return backend::cpu::sum(x, n);
+    else if constexpr (std::is_arithmetic_v<TN> && std::is_same_v<Op, Min>)
+        return backend::cpu::min(x, n);
+    else if constexpr (std::is_arithmetic_v<TN> && std::is_same_v<Op, Max>)
+        return backend::cpu::max(x, n);
+    else
+        return reduce(x, n, op, Op::template identity<TN>());
+}
+
+// reduce: Over every entry of `a`.
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major, typename Op>
+TN reduce(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a, Op op, TN identity)
+{
+    return reduce(a.data(), a.size(), op, identity);
+}
+
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major, typename Op>
+TN reduce(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a, Op op)
+{
+    return reduce(a.data(), a.size(), op);
+}
+
+} // namespace senkaid::ops::reduce
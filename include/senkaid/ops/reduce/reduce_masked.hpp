@@ -0,0 +1,202 @@
+#pragma once
+
+// reduce_masked.hpp: Reductions over the entries of a dense matrix selected by a BitMask.
+// The mask is read a 64-bit word at a time and each pack takes its lane mask from the word
+// (mask::from_bits(word >> k)); unselected lanes are replaced by the identity with one select.
+// Words with no bit set skip their 64 elements entirely, so a sparse selection reads little more
+// than the mask itself, and filter-then-reduce (greater(a, t), then masked_sum) makes one pass
+// over `a` after the comparison. masked_sum is blocked like sum(); every reduction runs in fixed
+// blocks over the thread pool merged in order, so results do not depend on the thread count.
+//
+//   auto keep = ops::logical::greater(a, 0.0);
+//   double s = ops::reduce::masked_sum(a, keep);
+//   double m = ops::reduce::masked_mean(a, keep);
+
+#include <senkaid/utils/config/root.hpp>
+#include <senkaid/utils/debug/root.hpp>
+#include <senkaid/core/matrix/dense.hpp>
+#include <senkaid/backend/simd/simd_reduction.hpp>
+#include <senkaid/backend/cpu/reduce_cpu.hpp>
+#include <senkaid/ops/logical/bit_mask.hpp>
+#include "reduce_generic.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+namespace senkaid::ops::reduce
+{
+
+namespace detail
+{
+
+// masked_fold: step(k, v, m) for every pack of x[lo, hi) in a mask word with some bit set; m is
+// the pack's lane mask, v its elements (lanes past hi read as zero) and k cycles over
+// reduction_accumulators. lo is a multiple of 64.
+template <typename TN, typename Step>
+SENKAID_FORCE_INLINE void masked_fold(const TN* x, const logical::BitMask::word_type* words, std::size_t lo, std::size_t hi, Step&& step)
+{
+    using P = backend::simd::pack<TN>;
+    using M = typename P::mask_type;
+    constexpr std::size_t L = P::lanes;
+    constexpr std::size_t W = logical::BitMask::word_bits;
+    constexpr std::size_t K = backend::simd::reduction_accumulators;
+
+    std::size_t k = 0;
+    for (std::size_t i = lo; i < hi; i += W)
+    {
+        const logical::BitMask::word_type bits = words[i / W];
+        if (bits == 0)
+            continue;
+
+        const std::size_t len = std::min(W, hi - i);
+        for (std::size_t j = 0; j < len; j += L)
+        {
+            const M m = M::from_bits(bits >> j);
+            step(k, j + L <= len ? P::loadu(x + i + j) : P::load(x + i + j, M::first_n(len - j)), m);
+            k = (k + 1) % K;
+        }
+    }
+}
+
+// masked_sum_partial: Blocked sum of the selected elements of x[lo, hi).
+template <typename TN>
+backend::simd::sum_parts<TN> masked_sum_partial(const TN* x, const logical::BitMask::word_type* words, std::size_t lo, std::size_t hi)
+{
+    namespace simd = backend::simd;
+    using P = simd::pack<TN>;
+    constexpr std::size_t K = simd::reduction_accumulators;
+
+    simd::sum_parts<TN> total;
+    for (std::size_t b = lo; b < hi; b += simd::sum_block)
+    {
+        P acc[K];
+        for (auto& a : acc)
+            a = P::zero();
+        masked_fold(x, words, b, std::min(b + simd::sum_block, hi), [&](std::size_t k, P v, auto m) {
+            acc[k] = acc[k] + select(m, v, P::zero());
+        });
+
+        for (std::size_t w = K / 2; w > 0; w /= 2)
+            for (std::size_t k = 0; k < w; ++k)
+                acc[k] += acc[k + w];
+        total.add(reduce_add(acc[0]));
+    }
+    return total;
+}
+
+// masked_reduce_partial: op over the selected elements of x[lo, hi), from identity.
+template <typename TN, typename Op>
+TN masked_reduce_partial(const TN* x, const logical::BitMask::word_type* words, std::size_t lo, std::size_t hi, const Op& op, TN identity)
+{
+    if constexpr (pack_op<Op, TN>)
+    {
+        using P = backend::simd::pack<TN>;
+        constexpr std::size_t K = backend::simd::reduction_accumulators;
+
+        P acc[K];
+        for (auto& a : acc)
+            a = P(identity);
+        masked_fold(x, words, lo, hi, [&](std::size_t k, P v, auto m) { acc[k] = op(acc[k], select(m, v, P(identity))); });
+
+        for (std::size_t w = K / 2; w > 0; w /= 2)
+            for (std::size_t k = 0; k < w; ++k)
+                acc[k] = op(acc[k], acc[k + w]);
+
+        alignas(64) TN lanes[P::lanes];
+        acc[0].storeu(lanes);
+        TN r = lanes[0];
+        for (std::size_t l = 1; l < P::lanes; ++l)
+            r = op(r, lanes[l]);
+        return r;
+    }
+    else
+    {
+        constexpr std::size_t W = logical::BitMask::word_bits;
+        TN r = identity;
+        for (std::size_t i = lo; i < hi; ++i)
+            if ((words[i / W] >> (i % W)) & 1)
+                r = op(r, x[i]);
+        return r;
+    }
+}
+
+// masked_blocks: kernel(lo, hi) over the reduce_grain blocks of [0, n), merged in order.
+template <typename TN, typename Kernel, typename Merge>
+auto masked_blocks(const TN* x, std::size_t n, Kernel kernel, Merge merge)
+{
+    return backend::cpu::detail::reduce_blocks(
+        x, n, [&](const TN* p, std::size_t m) {
+            const auto lo = static_cast<std::size_t>(p - x);
+            return kernel(lo, lo + m);
+        },
+        merge);
+}
+
+} // namespace detail
+
+// reduce_masked: identity op (selected entries of a) for an associative op, in storage order;
+// identity if nothing is selected. Logs an error and returns identity if the mask does not fit a.
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major, typename Op>
+TN reduce_masked(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a, const logical::BitMask& mask, Op op, TN identity)
+{
+    if (SENKAID_UNLIKELY(!mask.fits(a)))
+    {
+        SENKAID_LOG_ERROR("reduce_masked: mask and matrix shapes differ");
+        return identity;
+    }
+    if (a.size() == 0)
+        return identity;
+
+    return detail::masked_blocks(
+        a.data(), a.size(),
+        [&](std::size_t lo, std::size_t hi) { return detail::masked_reduce_partial(a.data(), mask.data(), lo, hi, op, identity); },
+        [&](TN& acc, TN r) { acc = op(acc, r); });
+}
+
+// masked_sum: Sum of the selected entries of a; 0 if none (or if the mask does not fit).
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+TN masked_sum(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a, const logical::BitMask& mask)
+{
+    if (SENKAID_UNLIKELY(!mask.fits(a)))
+    {
+        SENKAID_LOG_ERROR("masked_sum: mask and matrix shapes differ");
+        return TN(0);
+    }
+    if (a.size() == 0)
+        return TN(0);
+
+    return detail::masked_blocks(
+               a.data(), a.size(), [&](std::size_t lo, std::size_t hi) { return detail::masked_sum_partial(a.data(), mask.data(), lo, hi); },
+               [](backend::simd::sum_parts<TN>& acc, const backend::simd::sum_parts<TN>& r) { acc.merge(r); })
+        .value();
+}
+
+// masked_mean: Mean of the selected entries of a; NaN if none are selected.
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+TN masked_mean(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a, const logical::BitMask& mask)
+{
+    static_assert(std::is_floating_point_v<TN>, "masked_mean: floating-point element types only");
+
+    const std::size_t count = mask.fits(a) ? mask.count() : 0;
+    if (count == 0)
+        return std::numeric_limits<TN>::quiet_NaN();
+    return masked_sum(a, mask) / static_cast<TN>(count);
+}
+
+// masked_min / masked_max: Smallest / largest selected entry; NaN if a selected entry is NaN,
+// the identity (+inf / -inf, or the integer limits) if none are selected.
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+TN masked_min(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a, const logical::BitMask& mask)
+{
+    return reduce_masked(a, mask, Min{}, Min::identity<TN>());
+}
+
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+TN masked_max(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a, const logical::BitMask& mask)
+{
+    return reduce_masked(a, mask, Max{}, Max::identity<TN>());
+}
+
+} // namespace senkaid::ops::reduce
@@ -0,0 +1,45 @@
+#pragma once
+
+// stddev.hpp: Standard deviation, the square root of variance.hpp's one-pass variance, whole or
+// along an axis. unbiased takes the square root of the sample (n - 1) variance.
+//
+//   double s = ops::reduce::stddev(a);
+//   auto row_sd = ops::reduce::stddev(a, ops::reduce::Axis::Cols, false);
+
+#include <senkaid/utils/config/root.hpp>
+#include <senkaid/core/matrix/dense.hpp>
+#include "variance.hpp"
+
+#include <cmath>
+#include <cstddef>
+
+namespace senkaid::ops::reduce
+{
+
+// stddev: Standard deviation of x[0, n).
+template <typename TN>
+moment_type<TN> stddev(const TN* x, std::size_t n, bool unbiased = true)
+{
+    return std::sqrt(variance(x, n, unbiased));
+}
+
+// stddev: Standard deviation of every entry of `a`.
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+moment_type<TN> stddev(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a, bool unbiased = true)
+{
+    return std::sqrt(variance(a, unbiased));
+}
+
+// stddev: Standard deviations along `axis` of `a`, shaped like variance(a, axis).
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+core::matrix::SDDenseMatrix<-1, -1, moment_type<TN>, Major> stddev(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a, Axis axis,
+                                                                  bool unbiased = true)
+{
+    auto out = variance(a, axis, unbiased);
+    auto* o = out.data();
+    for (std::size_t i = 0; i < out.size(); ++i)
+        o[i] = std::sqrt(o[i]);
+    return out;
+}
+
+} // namespace senkaid::ops::reduce
@@ -0,0 +1,60 @@
+#pragma once
+
+// sum.hpp: Full reductions to a sum or a sum of squares over buffers and dense matrices.
+// Runs the blocked multi-accumulator kernels of backend/simd/simd_reduction.hpp across the thread
+// pool (backend/cpu/reduce_cpu.hpp). Summation::Blocked costs the same as a plain vector loop and
+// keeps the error independent of the length; Summation::Compensated adds a per-lane error term for
+// close to working-precision results and remains memory bound on large inputs.
+//
+//   double s = ops::reduce::sum(a);
+//   double t = ops::reduce::sum<ops::reduce::Summation::Compensated>(a);
+//   auto col_sums = ops::reduce::sum(a, ops::reduce::Axis::Rows);     // reduce_dim.hpp
+
+#include <senkaid/utils/config/root.hpp>
+#include <senkaid/core/matrix/dense.hpp>
+#include <senkaid/backend/cpu/reduce_cpu.hpp>
+#include "reduce_dim.hpp"
+
+#include <cstddef>
+
+namespace senkaid::ops::reduce
+{
+
+using Summation = backend::simd::summation;
+
+// sum: x[0] + ... + x[n - 1].
+template <Summation S = Summation::Blocked, typename TN>
+TN sum(const TN* x, std::size_t n)
+{
+    return backend::cpu::sum<S>(x, n);
+}
+
+// sum: Sum of every entry of `a`.
+template <Summation S = Summation::Blocked, int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+TN sum(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a)
+{
+    return backend::cpu::sum<S>(a.data(), a.size());
+}
+
+// sum_sq: x[0]^2 + ... + x[n - 1]^2 (unscaled).
+template <Summation S = Summation::Blocked, typename TN>
+TN sum_sq(const TN* x, std::size_t n)
+{
+    return backend::cpu::sum_sq<S>(x, n);
+}
+
+// sum_sq: Sum of the squared entries of `a`.
+template <Summation S = Summation::Blocked, int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+TN sum_sq(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a)
+{
+    return backend::cpu::sum_sq<S>(a.data(), a.size());
+}
+
+// sum: Sums along `axis` of `a` (see reduce_dim.hpp).
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+core::matrix::SDDenseMatrix<-1, -1, TN, Major> sum(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a, Axis axis)
+{
+    return reduce(a, axis, Add{});
+}
+
+} // namespace senkaid::ops::reduce
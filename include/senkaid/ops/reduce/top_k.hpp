@@ -0,0 +1,167 @@
+#pragma once
+
+// top_k.hpp: Positions of the k largest (or smallest) elements of a buffer or dense matrix,
+// found by partial selection rather than by sorting.
+// Every reduce_grain block is scanned once against a threshold, the k-th best value found so
+// far: a pack is compared with it in one instruction and only the lanes that are not worse are
+// appended to the candidate list. When the list reaches top_k_slack times k it is cut back to k
+// with nth_element and the threshold rises; blocks share it through an atomic, so after the
+// first block almost every pack is rejected by a single comparison and the scan runs at memory
+// speed. Blocks are scanned in parallel, their candidates are merged, and only the final k are
+// sorted. Elements rank by value, then by position, a NaN ranking ahead of every number as in
+// argmax / argmin. The threshold only decides what is looked at, never what is chosen, so the
+// result does not depend on the thread count.
+//
+//   auto best = ops::reduce::top_k(scores.data(), scores.size(), 100);    // best first
+//   auto low = ops::reduce::top_k(a, 10, false);
+
+#include <senkaid/utils/config/root.hpp>
+#include <senkaid/core/matrix/dense.hpp>
+#include <senkaid/backend/simd/simd_reduction.hpp>
+#include <senkaid/backend/cpu/reduce_cpu.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace senkaid::ops::reduce
+{
+
+// top_k_slack: Candidates kept per block, as a multiple of k, before cutting back to k.
+inline constexpr std::size_t top_k_slack = 2;
+
+namespace detail
+{
+
+// top_k_rank: a comes before b in the selection order.
+template <bool Max>
+struct top_k_rank
+{
+    template <typename TN>
+    SENKAID_FORCE_INLINE bool operator()(const backend::simd::extremum_at<TN>& a, const backend::simd::extremum_at<TN>& b) const noexcept
+    {
+        namespace simd = backend::simd;
+        return simd::detail::arg_better<Max>(a.value, b.value) || (!simd::detail::arg_better<Max>(b.value, a.value) && a.index < b.index);
+    }
+};
+
+// top_k_cut: Keeps the best k of `cand`, unordered; the k-th is the last.
+template <bool Max, typename TN>
+void top_k_cut(std::vector<backend::simd::extremum_at<TN>>& cand, std::size_t k)
+{
+    if (cand.size() <= k)
+        return;
+    std::nth_element(cand.begin(), cand.begin() + static_cast<std::ptrdiff_t>(k - 1), cand.end(), top_k_rank<Max>{});
+    cand.resize(k);
+}
+
+// top_k_block: The best k (at most) of x[0, n) that are not worse than `bound`, positions offset
+// by base, unordered. bound is the k-th best value some block has seen, shared by all blocks:
+// each raises it when its own k-th candidate is better. A tie with the bound is kept, since its
+// position may come first.
+template <bool Max, typename TN>
+std::vector<backend::simd::extremum_at<TN>> top_k_block(const TN* x, std::size_t n, std::size_t base, std::size_t k,
+                                                        std::atomic<TN>& bound)
+{
+    namespace simd = backend::simd;
+    using P = simd::pack<TN>;
+    constexpr std::size_t L = P::lanes;
+    constexpr std::size_t K = simd::reduction_accumulators;
+
+    const std::size_t cap = std::max(top_k_slack * k, k + K * L);
+    std::vector<simd::extremum_at<TN>> cand;
+    cand.reserve(cap + K * L);
+
+    TN threshold = bound.load(std::memory_order_relaxed);
+    const auto cut = [&] {
+        top_k_cut<Max>(cand, k);
+        if (cand.size() < k)
+            return;
+        TN b = bound.load(std::memory_order_relaxed);
+        while (simd::detail::arg_better<Max>(cand.back().value, b) && !bound.compare_exchange_weak(b, cand.back().value, std::memory_order_relaxed))
+        {
+        }
+        threshold = bound.load(std::memory_order_relaxed);
+    };
+    const auto hits = [&](std::size_t at) { return ~simd::detail::arg_better<Max>(P(threshold), P::loadu(x + at)); };
+    const auto take = [&](std::size_t at, std::uint64_t hit) {
+        for (; hit != 0; hit &= hit - 1)
+        {
+            const std::size_t l = static_cast<std::size_t>(std::countr_zero(hit));
+            cand.push_back({x[at + l], base + at + l});
+        }
+        if (cand.size() >= cap)
+            cut();
+    };
+
+    // K packs share one branch; a hit in any of them re-tests each against the current threshold.
+    std::size_t i = 0;
+    for (; i + K * L <= n; i += K * L)
+    {
+        simd::prefetch(x + i + simd::prefetch_distance<TN>);
+        auto any = hits(i);
+        for (std::size_t j = 1; j < K; ++j)
+            any = any | hits(i + j * L);
+        if (SENKAID_LIKELY(any.bits() == 0))
+            continue;
+        for (std::size_t j = 0; j < K; ++j)
+            take(i + j * L, hits(i + j * L).bits());
+    }
+    for (; i + L <= n; i += L)
+        take(i, hits(i).bits());
+    for (; i < n; ++i)
+        if (!simd::detail::arg_better<Max>(threshold, x[i]))
+            cand.push_back({x[i], base + i});
+
+    cut();
+    return cand;
+}
+
+// top_k_impl: Positions of the best k of x[0, n), best first.
+template <bool Max, typename TN>
+std::vector<std::int64_t> top_k_impl(const TN* x, std::size_t n, std::size_t k)
+{
+    using E = backend::simd::extremum_at<TN>;
+
+    k = std::min(k, n);
+    if (k == 0)
+        return {};
+
+    std::atomic<TN> bound{backend::simd::detail::extremum_identity<Max, TN>()};
+    std::vector<E> best = backend::cpu::detail::reduce_blocks(
+        x, n, [&](const TN* p, std::size_t m) { return top_k_block<Max>(p, m, static_cast<std::size_t>(p - x), k, bound); },
+        [&](std::vector<E>& acc, const std::vector<E>& r) {
+            acc.insert(acc.end(), r.begin(), r.end());
+            top_k_cut<Max>(acc, k);
+        });
+    std::sort(best.begin(), best.end(), top_k_rank<Max>{});
+
+    std::vector<std::int64_t> out(best.size());
+    for (std::size_t j = 0; j < best.size(); ++j)
+        out[j] = static_cast<std::int64_t>(best[j].index);
+    return out;
+}
+
+} // namespace detail
+
+// top_k: Positions of the k largest (smallest unless `largest`) elements of x[0, n), best first;
+// all n of them if k >= n.
+template <typename TN>
+std::vector<std::int64_t> top_k(const TN* x, std::size_t n, std::size_t k, bool largest = true)
+{
+    static_assert(std::is_arithmetic_v<TN>, "top_k: arithmetic element types only");
+    return largest ? detail::top_k_impl<true>(x, n, k) : detail::top_k_impl<false>(x, n, k);
+}
+
+// top_k: Positions in storage order (data()[i]) of the k largest (smallest) entries of `a`.
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+std::vector<std::int64_t> top_k(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a, std::size_t k, bool largest = true)
+{
+    return top_k(a.data(), a.size(), k, largest);
+}
+
+} // namespace senkaid::ops::reduce
@@ -0,0 +1,58 @@
+#pragma once
+
+// variance.hpp: Sample and population variance of buffers and dense matrices, whole or along an
+// axis, in one pass over the data (Welford / Chan, see moments.hpp). unbiased divides the sum of
+// squared deviations by n - 1, otherwise by n; too few values give NaN. Integer elements give
+// double results.
+//
+//   double v = ops::reduce::variance(a);
+//   double p = ops::reduce::variance(x, n, false);                   // population variance
+//   auto col_var = ops::reduce::variance(a, ops::reduce::Axis::Rows);
+
+#include <senkaid/utils/config/root.hpp>
+#include <senkaid/core/matrix/dense.hpp>
+#include <senkaid/backend/cpu/reduce_cpu.hpp>
+#include "reduce_dim.hpp"
+#include "moments.hpp"
+
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+namespace senkaid::ops::reduce
+{
+
+// variance: Variance of x[0, n).
+template <typename TN>
+moment_type<TN> variance(const TN* x, std::size_t n, bool unbiased = true)
+{
+    return backend::cpu::moments(x, n).variance(unbiased ? 1 : 0);
+}
+
+// variance: Variance of every entry of `a`.
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+moment_type<TN> variance(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a, bool unbiased = true)
+{
+    return variance(a.data(), a.size(), unbiased);
+}
+
+// variance: Variances along `axis` of `a`; a 1 x cols row for Axis::Rows, a rows x 1 column for
+// Axis::Cols.
+template <int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+core::matrix::SDDenseMatrix<-1, -1, moment_type<TN>, Major> variance(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a, Axis axis,
+                                                                    bool unbiased = true)
+{
+    using R = moment_type<TN>;
+
+    core::matrix::SDDenseMatrix<-1, -1, R, Major> out(axis == Axis::Rows ? 1 : a.rows(), axis == Axis::Rows ? a.cols() : 1);
+    std::vector<R> mean(out.size());
+    const std::size_t count = detail::axis_moments(a, axis, mean.data(), out.data());
+
+    const std::size_t ddof = unbiased ? 1 : 0;
+    R* o = out.data();
+    for (std::size_t i = 0; i < out.size(); ++i)
+        o[i] = count > ddof ? o[i] / static_cast<R>(count - ddof) : std::numeric_limits<R>::quiet_NaN();
+    return out;
+}
+
+} // namespace senkaid::ops::reduce
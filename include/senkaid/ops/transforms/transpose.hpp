@@ -0,0 +1,56 @@
+#pragma once
+
+// transpose.hpp: Storage-order conversion for dense matrices.
+// Converting between SDMajor::RowMajor and SDMajor::ColumnMajor keeps the logical matrix and
+// physically transposes the buffer, so it runs on the same kernel as ops/linalg/transpose.hpp.
+// Use it when handing data to libraries that expect the other order.
+
+#include <senkaid/utils/config/root.hpp>
+#include <senkaid/utils/debug/root.hpp>
+#include <senkaid/utils/memory/utils.hpp>
+#include <senkaid/core/matrix/dense.hpp>
+#include <senkaid/ops/linalg/transpose.hpp>
+
+#include <algorithm>
+
+namespace senkaid::ops::transforms
+{
+
+using linalg::TransposeOptions;
+using linalg::TransposeStore;
+
+// convert_major: Returns `a` stored in the Target order (same rows, cols and values).
+// Parameters:
+//   a       - Source matrix.
+//   options - Store mode and threading of the underlying transpose.
+template <core::matrix::SDMajor Target, int Rows, int Cols, typename TN, core::matrix::SDMajor Major>
+core::matrix::SDDenseMatrix<Rows, Cols, TN, Target> convert_major(const core::matrix::SDDenseMatrix<Rows, Cols, TN, Major>& a,
+                                                                  const TransposeOptions& options = {})
+{
+    core::matrix::SDDenseMatrix<Rows, Cols, TN, Target> result(a.rows(), a.cols());
+
+    if constexpr (Target == Major)
+        memory::copy_elements(result.data(), a.data(), a.rows() * a.cols());
+    else if constexpr (Major == core::matrix::SDMajor::RowMajor)
+        linalg::transpose(a.data(), a.rows(), a.cols(), a.cols(), result.data(), a.rows(), options);
+    else
+        linalg::transpose(a.data(), a.cols(), a.rows(), a.rows(), result.data(), a.cols(), options);
+
+    return result;
+}
+
+// convert_major: Raw-buffer form; `src` is rows x cols in order `From`, `dst` receives the other order.
+// Parameters:
+//   src, ld_src - Source and its leading dimension in `From` order.
+//   dst, ld_dst - Destination and its leading dimension in the opposite order.
+template <core::matrix::SDMajor From, typename TN>
+void convert_major(const TN* src, std::size_t rows, std::size_t cols, std::size_t ld_src, TN* dst, std::size_t ld_dst,
+                   const TransposeOptions& options = {})
+{
+    if constexpr (From == core::matrix::SDMajor::RowMajor)
+        linalg::transpose(src, rows, cols, ld_src, dst, ld_dst, options);
+    else
+        linalg::transpose(src, cols, rows, ld_src, dst, ld_dst, options);
+}
+
+} // namespace senkaid::ops::transforms
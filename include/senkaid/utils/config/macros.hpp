@@ -132,6 +132,25 @@
     #define SENKAID_ENABLE_PGO 0
 #endif
 
+// SENKAID_PREFETCH_DISTANCE: Bytes ahead of the current position that streaming SIMD loops prefetch.
+// Default: 512 (8 cache lines); raise it on machines with high memory latency.
+#ifndef SENKAID_PREFETCH_DISTANCE
+    #define SENKAID_PREFETCH_DISTANCE 512
+#endif
+
+// SENKAID_STREAM_THRESHOLD: Bytes from which memory::zero_memory / copy_memory / fill_memory use
+// non-temporal stores instead of memset / memcpy; set it near the last-level cache size per core.
+// Default: 4 MiB.
+#ifndef SENKAID_STREAM_THRESHOLD
+    #define SENKAID_STREAM_THRESHOLD (std::size_t(4) << 20)
+#endif
+
+// SENKAID_PARALLEL_MEMORY_THRESHOLD: Bytes from which those streaming fills and copies are split
+// across the worker pool. Default: 64 MiB.
+#ifndef SENKAID_PARALLEL_MEMORY_THRESHOLD
+    #define SENKAID_PARALLEL_MEMORY_THRESHOLD (std::size_t(64) << 20)
+#endif
+
 // SENKAID_ENABLE_JIT_KERNEL: Enables JIT kernel compilation for specialized matrix operations.
 // Default: Disabled unless integrated with MLIR/TVM via CMake.
 #ifndef SENKAID_ENABLE_JIT_KERNEL
@@ -5,4 +5,5 @@
 #include "pool.hpp"
 #include "guard.hpp"
 #include "tracker.hpp"
+#include "traits.hpp"
 #include "fallback.hpp"
@@ -0,0 +1,15 @@
+#pragma once
+
+// traits.hpp: Type properties used by the memory utilities (utils.hpp). Kept free of other
+// senkaid includes so that value types in core/ can specialize them cheaply.
+
+#include <type_traits>
+
+namespace senkaid::memory {
+
+// zero_bits: TN() is all-zero bytes, so zero_elements may use zero_memory.
+// Specialize for other types with that property (see core/complex/complex.hpp).
+template <typename TN>
+inline constexpr bool zero_bits = std::is_arithmetic_v<TN>;
+
+} // namespace senkaid::memory
@@ -3,9 +3,19 @@
 // utils.hpp: Basic memory utilities for the senkaid library.
 // Provides low-level memory operations like zeroing, copying, and alignment checks.
 // Uses macros from compiler.hpp for compiler detection and support.
+// Blocks of SENKAID_STREAM_THRESHOLD bytes or more are written with non-temporal stores
+// (backend/asm memcpy_optimized.s / zero_fill.s when linked, intrinsics otherwise), which skip
+// the read-for-ownership of the target lines and leave the caches to the working set; from
+// SENKAID_PARALLEL_MEMORY_THRESHOLD on the work is split across the worker pool.
 
 #include <senkaid/utils/config/root.hpp>
 #include <senkaid/utils/debug/root.hpp>
+#include <senkaid/backend/asm/asm_dispatch.hpp>
+#include <senkaid/backend/parallel/parallel_for.hpp>
+#include "traits.hpp"
+
+#include <algorithm>
+#include <type_traits>
 
 // Conditional includes for portability
 #include "utils/config/root.hpp"
@@ -33,6 +43,10 @@
     #include <memory>
 #endif
 
+#if defined(SENKAID_HAS_SSE2) || defined(SENKAID_HAS_AVX) || defined(SENKAID_HAS_AVX512)
+    #include <immintrin.h>
+#endif
+
 namespace senkaid::memory {
 
 SENKAID_DIAGNOSTIC_PUSH
@@ -41,6 +55,121 @@ SENKAID_IGNORE_WARNING_UNUSED_FUNCTION
 template <typename TN>
 concept NumericType = std::is_arithmetic_v<TN>;
 
+// --- Streaming (Non-Temporal) Host Memory Operations ---
+
+namespace detail {
+
+    // stream_line: Granule of the non-temporal kernels; their destination is aligned to it.
+    inline constexpr std::size_t stream_line = 64;
+
+    // stream_chunk: Bytes per parallel work item (a multiple of stream_line).
+    inline constexpr std::size_t stream_chunk = std::size_t(1) << 20;
+
+    // stream_fill_lines / stream_copy_lines: Non-temporal fill / copy of whole lines.
+    // dst is stream_line aligned and bytes a multiple of stream_line. Fenced on return.
+    SENKAID_FORCE_INLINE void stream_fill_lines(std::uint8_t* dst, std::uint8_t value, std::size_t bytes) {
+    #if defined(SENKAID_ASM_STREAM_AVX512)
+        senkaid_asm_stream_fill_avx512(dst, value, bytes);
+    #elif defined(SENKAID_ASM_STREAM_AVX)
+        senkaid_asm_stream_fill_avx(dst, value, bytes);
+    #elif defined(SENKAID_HAS_AVX512)
+        const __m512i v = _mm512_set1_epi8(static_cast<char>(value));
+        for (std::size_t i = 0; i < bytes; i += stream_line)
+            _mm512_stream_si512(reinterpret_cast<__m512i*>(dst + i), v);
+        _mm_sfence();
+    #elif defined(SENKAID_HAS_AVX)
+        const __m256i v = _mm256_set1_epi8(static_cast<char>(value));
+        for (std::size_t i = 0; i < bytes; i += stream_line) {
+            _mm256_stream_si256(reinterpret_cast<__m256i*>(dst + i), v);
+            _mm256_stream_si256(reinterpret_cast<__m256i*>(dst + i + 32), v);
+        }
+        _mm_sfence();
+    #elif defined(SENKAID_HAS_SSE2)
+        const __m128i v = _mm_set1_epi8(static_cast<char>(value));
+        for (std::size_t i = 0; i < bytes; i += stream_line)
+            for (std::size_t k = 0; k < stream_line; k += 16)
+                _mm_stream_si128(reinterpret_cast<__m128i*>(dst + i + k), v);
+        _mm_sfence();
+    #else
+        std::memset(dst, value, bytes);
+    #endif
+    }
+
+    SENKAID_FORCE_INLINE void stream_copy_lines(std::uint8_t* dst, const std::uint8_t* src, std::size_t bytes) {
+    #if defined(SENKAID_ASM_STREAM_AVX512)
+        senkaid_asm_stream_copy_avx512(dst, src, bytes);
+    #elif defined(SENKAID_ASM_STREAM_AVX)
+        senkaid_asm_stream_copy_avx(dst, src, bytes);
+    #elif defined(SENKAID_HAS_AVX512)
+        for (std::size_t i = 0; i < bytes; i += stream_line)
+            _mm512_stream_si512(reinterpret_cast<__m512i*>(dst + i), _mm512_loadu_si512(src + i));
+        _mm_sfence();
+    #elif defined(SENKAID_HAS_AVX)
+        for (std::size_t i = 0; i < bytes; i += 32)
+            _mm256_stream_si256(reinterpret_cast<__m256i*>(dst + i),
+                                _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i)));
+        _mm_sfence();
+    #elif defined(SENKAID_HAS_SSE2)
+        for (std::size_t i = 0; i < bytes; i += 16)
+            _mm_stream_si128(reinterpret_cast<__m128i*>(dst + i),
+                             _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)));
+        _mm_sfence();
+    #else
+        std::memcpy(dst, src, bytes);
+    #endif
+    }
+
+    // stream_head: Bytes from p up to its first line boundary, at most size.
+    SENKAID_FORCE_INLINE std::size_t stream_head(const void* p, std::size_t size) {
+        const std::size_t misalign = reinterpret_cast<std::uintptr_t>(p) % stream_line;
+        return std::min(size, misalign ? stream_line - misalign : 0);
+    }
+
+    // stream_fill / stream_copy: Any range: plain head up to the first line of dst, streamed
+    // lines, plain tail.
+    inline void stream_fill(std::uint8_t* dst, std::uint8_t value, std::size_t size) {
+        const std::size_t head = stream_head(dst, size);
+        const std::size_t body = (size - head) / stream_line * stream_line;
+        std::memset(dst, value, head);
+        stream_fill_lines(dst + head, value, body);
+        std::memset(dst + head + body, value, size - head - body);
+    }
+
+    inline void stream_copy(std::uint8_t* dst, const std::uint8_t* src, std::size_t size) {
+        const std::size_t head = stream_head(dst, size);
+        const std::size_t body = (size - head) / stream_line * stream_line;
+        std::memcpy(dst, src, head);
+        stream_copy_lines(dst + head, src + head, body);
+        std::memcpy(dst + head + body, src + head + body, size - head - body);
+    }
+
+    // for_each_stream_chunk: fn(lo, hi) over [0, size), in stream_chunk pieces on the worker
+    // pool from SENKAID_PARALLEL_MEMORY_THRESHOLD bytes on, in one call below it.
+    template <typename Fn>
+    void for_each_stream_chunk(std::size_t size, Fn&& fn) {
+        if (size < SENKAID_PARALLEL_MEMORY_THRESHOLD) {
+            fn(std::size_t(0), size);
+            return;
+        }
+        const std::size_t chunks = (size + stream_chunk - 1) / stream_chunk;
+        backend::parallel::parallel_for(0, chunks, 1, [&](std::size_t lo, std::size_t hi) {
+            fn(lo * stream_chunk, std::min(size, hi * stream_chunk));
+        });
+    }
+
+    inline void stream_fill_large(void* ptr, std::uint8_t value, std::size_t size) {
+        auto* p = static_cast<std::uint8_t*>(ptr);
+        for_each_stream_chunk(size, [&](std::size_t lo, std::size_t hi) { stream_fill(p + lo, value, hi - lo); });
+    }
+
+    inline void stream_copy_large(void* dst, const void* src, std::size_t size) {
+        auto* d = static_cast<std::uint8_t*>(dst);
+        const auto* s = static_cast<const std::uint8_t*>(src);
+        for_each_stream_chunk(size, [&](std::size_t lo, std::size_t hi) { stream_copy(d + lo, s + lo, hi - lo); });
+    }
+
+} // namespace detail
+
 // --- Core Host Memory Operations ---
 
 // zero_memory: Fills a block of host memory with zeros.
@@ -52,7 +181,10 @@ SENKAID_FORCE_INLINE void zero_memory(void* ptr, std::size_t size) {
         SENKAID_LOG_WARNING("zero_memory: null pointer");
         return;
     }
-    std::memset(ptr, 0, size);
+    if (size >= SENKAID_STREAM_THRESHOLD)
+        detail::stream_fill_large(ptr, 0, size);
+    else
+        std::memset(ptr, 0, size);
 }
 
 // copy_memory: Copies a block of host memory from source to destination.
@@ -65,7 +197,10 @@ SENKAID_FORCE_INLINE void copy_memory(void* dst, const void* src, std::size_t si
         SENKAID_LOG_WARNING("copy_memory: null pointer");
         return;
     }
-    std::memcpy(dst, src, size);
+    if (size >= SENKAID_STREAM_THRESHOLD)
+        detail::stream_copy_large(dst, src, size);
+    else
+        std::memcpy(dst, src, size);
 }
 
 // fill_memory: Fills a block of host memory with a specific byte value.
@@ -78,7 +213,28 @@ SENKAID_FORCE_INLINE void fill_memory(void* ptr, std::size_t size, std::uint8_t
         SENKAID_LOG_WARNING("fill_memory: null pointer");
         return;
     }
-    std::memset(ptr, static_cast<int>(value), size);
+    if (size >= SENKAID_STREAM_THRESHOLD)
+        detail::stream_fill_large(ptr, value, size);
+    else
+        std::memset(ptr, static_cast<int>(value), size);
+}
+
+// zero_elements: Sets count elements at ptr to TN(0).
+template <typename TN>
+SENKAID_FORCE_INLINE void zero_elements(TN* ptr, std::size_t count) {
+    if constexpr (zero_bits<TN>)
+        zero_memory(ptr, count * sizeof(TN));
+    else
+        std::fill(ptr, ptr + count, TN(0));
+}
+
+// copy_elements: Copies count elements from src to dst (non-overlapping).
+template <typename TN>
+SENKAID_FORCE_INLINE void copy_elements(TN* dst, const TN* src, std::size_t count) {
+    if constexpr (std::is_trivially_copyable_v<TN>)
+        copy_memory(dst, src, count * sizeof(TN));
+    else
+        std::copy(src, src + count, dst);
 }
 
 // --- CUDA-Specific Memory Operations ---
@@ -176,7 +332,7 @@ SENKAID_FORCE_INLINE void fill_memory(void* ptr, std::size_t size, std::uint8_t
             SENKAID_LOG_WARNING("zero_cuda_memory: null pointer");
             return;
         }
-        std::memset(ptr, 0, size * sizeof(T));
+        zero_memory(ptr, size * sizeof(T));
     }
 
     template<NumericType T>
@@ -185,7 +341,7 @@ SENKAID_FORCE_INLINE void fill_memory(void* ptr, std::size_t size, std::uint8_t
             SENKAID_LOG_WARNING("copy_cuda_memory: null pointer");
             return;
         }
-        std::memcpy(dst, src, size * sizeof(T));
+        copy_memory(dst, src, size * sizeof(T));
     }
 
     template<NumericType T>
@@ -194,7 +350,7 @@ SENKAID_FORCE_INLINE void fill_memory(void* ptr, std::size_t size, std::uint8_t
             SENKAID_LOG_WARNING("copy_cuda_device: null pointer");
             return;
         }
-        std::memcpy(dst, src, size * sizeof(T));
+        copy_memory(dst, src, size * sizeof(T));
     }
 
     template<NumericType T>
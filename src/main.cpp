@@ -3,6 +3,7 @@
 #include <array>
 #include <cstddef>
 #include <cstdlib>
+#include <iostream>
 #include <senkaid/core/matrix/dense.hpp>
 #include <tuple>
 #include <chrono>
@@ -0,0 +1,90 @@
+// bench_level1.cpp: dot and axpy, asm kernels against the intrinsic loops.
+// Prints the median time of 21 runs per size for backend/asm/dot_product.s (when the build
+// links it, SENKAID_ENABLE_ASM), the intrinsic loops of backend/cpu/dot_cpu.hpp, and the
+// routed backend::cpu::dot / axpy, for float and double. Without asm only the last two run.
+//
+//   cmake -S . -B build -DSENKAID_ENABLE_ASM=ON && cmake --build build --target bench_level1
+//   ./build/tests/bench_level1
+
+#include <senkaid/backend/asm/asm_dispatch.hpp>
+#include <senkaid/backend/cpu/dot_cpu.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <vector>
+
+namespace cpu = senkaid::backend::cpu;
+
+namespace
+{
+
+constexpr int runs = 21;
+
+// time_ns: Median over `runs` of the mean time of `reps` calls to f, in nanoseconds.
+template <typename F>
+double time_ns(F&& f, int reps)
+{
+    std::vector<double> t(runs);
+    for (double& v : t)
+    {
+        const auto t0 = std::chrono::steady_clock::now();
+        for (int r = 0; r < reps; ++r)
+            f();
+        v = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count() / reps;
+    }
+    std::nth_element(t.begin(), t.begin() + runs / 2, t.end());
+    return t[runs / 2];
+}
+
+#if defined(SENKAID_ASM_DOT_AVX512) || defined(SENKAID_ASM_DOT_AVX2)
+constexpr bool has_asm = true;
+#else
+constexpr bool has_asm = false;
+#endif
+
+template <typename TN>
+void bench(const char* name)
+{
+    std::printf("%s\n%10s %12s %12s %12s | %12s %12s %12s\n", name, "n", "dot asm", "dot intr", "dot", "axpy asm",
+                "axpy intr", "axpy");
+
+    for (std::size_t n : {std::size_t(17), std::size_t(1001), std::size_t(4096), std::size_t(1) << 16,
+                          std::size_t(1) << 18, std::size_t(1) << 20, std::size_t(1) << 23})
+    {
+        std::vector<TN> x(n), y(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            x[i] = TN(i % 7);
+            y[i] = TN(i % 5);
+        }
+        const int reps = static_cast<int>(std::max<std::size_t>(3, (std::size_t(1) << 24) / (n + 64)));
+        const TN a = TN(1e-6);
+        volatile TN sink = TN(0);
+
+        double dot_asm = 0, axpy_asm = 0;
+        if constexpr (has_asm)
+        {
+            dot_asm = time_ns([&] { sink = sink + cpu::detail::asm_dot(x.data(), y.data(), n); }, reps);
+            axpy_asm = time_ns([&] { cpu::detail::asm_axpy(a, x.data(), y.data(), n); }, reps);
+        }
+        const double dot_intr = time_ns([&] { sink = sink + cpu::detail::dot_simd(x.data(), y.data(), n); }, reps);
+        const double dot = time_ns([&] { sink = sink + cpu::dot(x.data(), y.data(), n); }, reps);
+        const double axpy_intr = time_ns([&] { cpu::detail::axpy_simd(a, x.data(), y.data(), n); }, reps);
+        const double axpy = time_ns([&] { cpu::axpy(a, x.data(), y.data(), n); }, reps);
+
+        std::printf("%10zu %12.1f %12.1f %12.1f | %12.1f %12.1f %12.1f\n", n, dot_asm, dot_intr, dot, axpy_asm, axpy_intr, axpy);
+    }
+}
+
+} // namespace
+
+int main()
+{
+    if (!has_asm)
+        std::printf("asm kernels not linked (SENKAID_ENABLE_ASM off or no AVX2/AVX-512); asm columns are 0\n");
+    bench<double>("double (ns)");
+    bench<float>("float (ns)");
+    return 0;
+}